@@ -0,0 +1,506 @@
+/* openhpsdr_e_export.c
+ * Sample export for the OpenHPSDR Ethernet protocol plug-in
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * The samples of every DDC of every radio are written to their own file while
+ * the capture is read, one datagram at a time. Only the open files and one
+ * conversion buffer are kept, a capture of any size is exported with constant
+ * memory.
+ *
+ * File names: <directory>/ddcNN_<radio>_SSS.<extension>
+ *   NN    - DDC number
+ *   radio - Radio address, see openhpsdr_e_export_new()
+ *   SSS   - File number of the DDC. A new file is started when the DDC sample
+ *           rate changes, a WAV file reaches 4 GB or (SigMF) the frequency
+ *           changes.
+ *
+ * The Mic / Line and DDC Audio samples are written to 16 bit PCM WAV files,
+ * micl_<radio>_SSS.wav (one channel) and ddca_<radio>_SSS.wav (left and
+ * right), at 48 kHz. Lost datagrams are written as silence so the audio keeps
+ * its timing.
+ *
+ */
+
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <wsutil/file_util.h>
+
+#include "openhpsdr_e_export.h"
+#include "openhpsdr_e_samples.h"
+
+typedef struct _openhpsdr_e_export_file {
+    FILE    *data;          // Sample file, NULL not open
+    FILE    *annot;         // SigMF annotations, a temporary file
+    gchar   *base;          // Path without the extension
+    gboolean failed;        // Could not open, not tried again for this capture
+    gint     format;        // HPSDR_E_EXPORT_*
+    guint    channels;      // 2 for I&Q
+    guint    frame_bytes;   // Bytes of one sample of every channel
+    guint    segment;       // File number of the DDC
+    guint32  sample_rate;   // sps, 0 unknown
+    guint64  frequency;     // Hz, 0 unknown
+    guint64  samples;       // Samples (frames) in the file
+    guint64  data_bytes;
+    gdouble  start;         // Capture time of the first sample
+    guint32  gaps;
+} openhpsdr_e_export_file_t;
+
+// The export files of one radio.
+struct _openhpsdr_e_export {
+    gchar   *name;          // Radio address, part of the file names
+    openhpsdr_e_export_file_t ddc_files[HPSDR_E_EXPORT_NUM_DDC];
+    openhpsdr_e_export_file_t audio_files[HPSDR_E_EXPORT_NUM_AUDIO];
+};
+
+static GPtrArray *export_radios = NULL;
+static const char *audio_names[HPSDR_E_EXPORT_NUM_AUDIO] = { "micl", "ddca" };
+static guint8 export_buf[HPSDR_E_EXPORT_BUF_LEN];
+
+static void export_put_le16(guint8 *p, guint16 value)
+{
+   p[0] = (guint8)(value & 0xFF);
+   p[1] = (guint8)(value >> 8);
+}
+
+static void export_put_le32(guint8 *p, guint32 value)
+{
+   p[0] = (guint8)(value & 0xFF);
+   p[1] = (guint8)((value >> 8) & 0xFF);
+   p[2] = (guint8)((value >> 16) & 0xFF);
+   p[3] = (guint8)(value >> 24);
+}
+
+// Bytes of one sample of every channel in the export file.
+static guint export_frame_bytes(gint format, guint channels)
+{
+   if ( format == HPSDR_E_EXPORT_RAW_F32 || format == HPSDR_E_EXPORT_SIGMF ) {
+       return 4 * channels;
+   }
+
+   return 2 * channels;
+}
+
+static const char *export_extension(gint format)
+{
+   switch (format) {
+       case HPSDR_E_EXPORT_RAW_F32: return "f32";
+       case HPSDR_E_EXPORT_RAW_I16: return "i16";
+       case HPSDR_E_EXPORT_WAV:     return "wav";
+       case HPSDR_E_EXPORT_SIGMF:   return "sigmf-data";
+       default:                     return "raw";
+   }
+}
+
+// 16 bit PCM. Written with a zero length at the start and again with the real
+// length when the file is closed.
+static void export_wav_header(FILE *fp, guint32 sample_rate, guint channels, guint32 data_bytes)
+{
+   guint8 hdr[HPSDR_E_EXPORT_WAV_HDR];
+
+   memcpy(&hdr[0], "RIFF", 4);
+   export_put_le32(&hdr[4], data_bytes + HPSDR_E_EXPORT_WAV_HDR - 8);
+   memcpy(&hdr[8], "WAVE", 4);
+   memcpy(&hdr[12], "fmt ", 4);
+   export_put_le32(&hdr[16], 16);
+   export_put_le16(&hdr[20], 1);                   // PCM
+   export_put_le16(&hdr[22], (guint16)channels);   // I and Q, left and right
+   export_put_le32(&hdr[24], sample_rate);
+   export_put_le32(&hdr[28], sample_rate * channels * 2); // Bytes per second
+   export_put_le16(&hdr[32], (guint16)(channels * 2));    // Block align
+   export_put_le16(&hdr[34], 16);                  // Bits per sample
+   memcpy(&hdr[36], "data", 4);
+   export_put_le32(&hdr[40], data_bytes);
+
+   fwrite(hdr, 1, sizeof(hdr), fp);
+}
+
+// ISO 8601 UTC time of the SigMF capture.
+static void export_iso_time(gdouble abs_time, gchar *buf, gsize buf_len)
+{
+   time_t secs = (time_t)abs_time;
+   struct tm *utc = gmtime(&secs);
+
+   if ( utc == NULL ) {
+       g_snprintf(buf, (gulong)buf_len, "1970-01-01T00:00:00Z");
+       return;
+   }
+
+   g_snprintf(buf, (gulong)buf_len, "%04d-%02d-%02dT%02d:%02d:%02d.%06uZ",
+       utc->tm_year + 1900, utc->tm_mon + 1, utc->tm_mday, utc->tm_hour, utc->tm_min, utc->tm_sec,
+       (guint)((abs_time - (gdouble)secs) * 1000000.0));
+}
+
+// SigMF metadata of a finished data file. The annotations are copied from the
+// temporary file, they are never all held in memory.
+static void export_sigmf_meta(openhpsdr_e_export_file_t *file, const char *radio, guint ddc)
+{
+   gchar *path = NULL;
+   gchar iso_time[40];
+   FILE *meta = NULL;
+   size_t len = 0;
+
+   path = g_strdup_printf("%s.sigmf-meta", file->base);
+   meta = ws_fopen(path, "w");
+   g_free(path);
+   if ( meta == NULL ) { return; }
+
+   export_iso_time(file->start, iso_time, sizeof(iso_time));
+
+   fprintf(meta, "{\n");
+   fprintf(meta, "  \"global\": {\n");
+   fprintf(meta, "    \"core:datatype\": \"cf32_le\",\n");
+   fprintf(meta, "    \"core:sample_rate\": %u,\n", file->sample_rate);
+   fprintf(meta, "    \"core:version\": \"1.0.0\",\n");
+   fprintf(meta, "    \"core:recorder\": \"Wireshark openHPSDR Ethernet plug-in\",\n");
+   fprintf(meta, "    \"core:description\": \"openHPSDR radio %s DDC %u\"\n", radio, ddc);
+   fprintf(meta, "  },\n");
+   fprintf(meta, "  \"captures\": [\n");
+   fprintf(meta, "    { \"core:sample_start\": 0, \"core:frequency\": %" G_GUINT64_FORMAT ", \"core:datetime\": \"%s\" }\n",
+       file->frequency, iso_time);
+   fprintf(meta, "  ],\n");
+   fprintf(meta, "  \"annotations\": [\n");
+
+   if ( file->annot != NULL ) {
+       rewind(file->annot);
+       while ( (len = fread(export_buf, 1, sizeof(export_buf), file->annot)) > 0 ) {
+           fwrite(export_buf, 1, len, meta);
+       }
+   }
+
+   fprintf(meta, "\n  ]\n");
+   fprintf(meta, "}\n");
+
+   fclose(meta);
+}
+
+static void export_close(openhpsdr_e_export_file_t *file, const char *radio, guint ddc)
+{
+   if ( file->data == NULL ) { return; }
+
+   if ( file->format == HPSDR_E_EXPORT_WAV ) {
+       rewind(file->data);
+       export_wav_header(file->data, file->sample_rate, file->channels, (guint32)file->data_bytes);
+   }
+
+   fclose(file->data);
+   file->data = NULL;
+
+   if ( file->format == HPSDR_E_EXPORT_SIGMF ) {
+       export_sigmf_meta(file, radio, ddc);
+   }
+
+   if ( file->annot != NULL ) {
+       fclose(file->annot);
+       file->annot = NULL;
+   }
+
+   g_free(file->base);
+   file->base = NULL;
+   file->segment++;
+}
+
+// name: file name before the radio, ddcNN, micl or ddca.
+static gboolean export_open(openhpsdr_e_export_file_t *file, const char *dir, const char *name,
+    const char *radio, gint format, guint channels, guint32 sample_rate, guint64 frequency, gdouble abs_time)
+{
+   gchar *path = NULL;
+
+   file->base = g_strdup_printf("%s%s%s_%s_%03u", dir, G_DIR_SEPARATOR_S, name, radio, file->segment);
+   path = g_strdup_printf("%s.%s", file->base, export_extension(format));
+   file->data = ws_fopen(path, "wb");
+   g_free(path);
+
+   if ( file->data == NULL ) {
+       g_free(file->base);
+       file->base = NULL;
+       file->failed = TRUE;
+       return FALSE;
+   }
+
+   file->format = format;
+   file->channels = channels;
+   file->frame_bytes = export_frame_bytes(format, channels);
+   file->sample_rate = sample_rate;
+   file->frequency = frequency;
+   file->samples = 0;
+   file->data_bytes = 0;
+   file->start = abs_time;
+   file->gaps = 0;
+
+   if ( format == HPSDR_E_EXPORT_WAV ) {
+       export_wav_header(file->data, sample_rate, channels, 0);
+   }
+
+   if ( format == HPSDR_E_EXPORT_SIGMF ) {
+       file->annot = tmpfile();
+   }
+
+   return TRUE;
+}
+
+static void export_write_zeros(openhpsdr_e_export_file_t *file, guint64 samples)
+{
+   guint64 bytes = samples * file->frame_bytes;
+   size_t len = 0;
+
+   memset(export_buf, 0, sizeof(export_buf));
+
+   file->samples += samples;
+   file->data_bytes += bytes;
+
+   while ( bytes > 0 ) {
+       len = (size_t)MIN(bytes, (guint64)sizeof(export_buf));
+       fwrite(export_buf, 1, len, file->data);
+       bytes -= len;
+   }
+}
+
+static void export_write_samples(openhpsdr_e_export_file_t *file, const guint8 *samples, guint samples_num,
+    guint sample_bits)
+{
+   guint bytes = sample_bits / 8;
+   guint frame_bytes = file->frame_bytes;
+   guint num_values = samples_num * 2;
+   gint32 values[HPSDR_E_SAMPLES_CHUNK];
+   gfloat fvalues[HPSDR_E_SAMPLES_CHUNK];
+   gint32 value = 0;
+   guint32 fbits = 0;
+   guint pos = 0;
+   guint num = 0;
+   guint i = 0;
+   guint j = 0;
+
+   // I then Q, unpacked a chunk at a time.
+   for ( i = 0; i < num_values; i += num ) {
+       num = MIN(num_values - i, HPSDR_E_SAMPLES_CHUNK);
+
+       if ( frame_bytes == 8 ) {
+           openhpsdr_e_unpack_f32(samples + (i * bytes), num, sample_bits, fvalues);
+       } else {
+           openhpsdr_e_unpack_i32(samples + (i * bytes), num, sample_bits, values);
+       }
+
+       for ( j = 0; j < num; j++ ) {
+           if ( frame_bytes == 8 ) {
+               memcpy(&fbits, &fvalues[j], sizeof(fbits));
+               export_put_le32(&export_buf[pos], fbits);
+               pos += 4;
+           } else {
+               value = values[j];
+               if ( sample_bits > 16 ) {
+                   value >>= (sample_bits - 16);
+               } else if ( sample_bits < 16 ) {
+                   value *= 1 << (16 - sample_bits);
+               }
+               export_put_le16(&export_buf[pos], (guint16)(gint16)value);
+               pos += 2;
+           }
+       }
+
+       if ( pos + (HPSDR_E_SAMPLES_CHUNK * 4) > sizeof(export_buf) ) {
+           fwrite(export_buf, 1, pos, file->data);
+           pos = 0;
+       }
+   }
+
+   if ( pos > 0 ) {
+       fwrite(export_buf, 1, pos, file->data);
+   }
+
+   file->samples += samples_num;
+   file->data_bytes += (guint64)samples_num * frame_bytes;
+}
+
+openhpsdr_e_export_t *openhpsdr_e_export_new(const char *name)
+{
+   openhpsdr_e_export_t *radio_files = g_new0(openhpsdr_e_export_t, 1);
+
+   if ( export_radios == NULL ) {
+       export_radios = g_ptr_array_new();
+   }
+
+   // Address separators are not wanted in a file name.
+   radio_files->name = g_strdelimit(g_strdup(name), ":/\\", '-');
+   g_ptr_array_add(export_radios, radio_files);
+
+   return radio_files;
+}
+
+gboolean openhpsdr_e_export_ddciq(openhpsdr_e_export_t *radio_files, const char *dir, gint format, gint gaps,
+    guint ddc, const guint8 *samples, guint samples_num, guint sample_bits, guint64 lost_samples,
+    guint32 sample_rate, guint64 frequency, gdouble abs_time)
+{
+   openhpsdr_e_export_file_t *file = NULL;
+   guint64 new_bytes = 0;
+   gchar name[8];
+
+   if ( radio_files == NULL || format == HPSDR_E_EXPORT_NONE || dir == NULL || dir[0] == '\0' ||
+        ddc >= HPSDR_E_EXPORT_NUM_DDC ) {
+       return FALSE;
+   }
+
+   if ( sample_bits != 8 && sample_bits != 16 && sample_bits != 24 && sample_bits != 32 ) {
+       return FALSE;
+   }
+
+   // WAV and SigMF need the sample rate from a DDC Command.
+   if ( sample_rate == 0 && ( format == HPSDR_E_EXPORT_WAV || format == HPSDR_E_EXPORT_SIGMF ) ) {
+       return FALSE;
+   }
+
+   file = &radio_files->ddc_files[ddc];
+   if ( file->failed ) { return FALSE; }
+
+   lost_samples = MIN(lost_samples, (guint64)HPSDR_E_EXPORT_MAX_FILL);
+
+   if ( file->data != NULL ) {
+       new_bytes = (samples_num + ( gaps == HPSDR_E_EXPORT_GAPS_ZERO ? lost_samples : 0 )) *
+                   (guint64)export_frame_bytes(format, 2);
+
+       if ( file->format != format || file->sample_rate != sample_rate ||
+            ( format == HPSDR_E_EXPORT_SIGMF && file->frequency != frequency ) ||
+            ( format == HPSDR_E_EXPORT_WAV &&
+              file->data_bytes + new_bytes > G_MAXUINT32 - HPSDR_E_EXPORT_WAV_HDR ) ) {
+           export_close(file, radio_files->name, ddc);
+           lost_samples = 0;
+       }
+   }
+
+   if ( file->data == NULL ) {
+       g_snprintf(name, sizeof(name), "ddc%02u", ddc);
+       if ( !export_open(file, dir, name, radio_files->name, format, 2, sample_rate, frequency, abs_time) ) {
+           return FALSE;
+       }
+       lost_samples = 0;
+   }
+
+   if ( lost_samples > 0 ) {
+       if ( file->annot != NULL ) {
+           fprintf(file->annot, "%s    { \"core:sample_start\": %" G_GUINT64_FORMAT ", \"core:sample_count\": %"
+               G_GUINT64_FORMAT ", \"core:comment\": \"%s\" }",
+               file->gaps ? ",\n" : "", file->samples,
+               gaps == HPSDR_E_EXPORT_GAPS_ZERO ? lost_samples : (guint64)0,
+               gaps == HPSDR_E_EXPORT_GAPS_ZERO ? "Lost datagrams, zero filled" : "Lost datagrams, samples left out");
+       }
+       file->gaps++;
+
+       if ( gaps == HPSDR_E_EXPORT_GAPS_ZERO ) {
+           export_write_zeros(file, lost_samples);
+       }
+   }
+
+   export_write_samples(file, samples, samples_num, sample_bits);
+
+   return TRUE;
+}
+
+gboolean openhpsdr_e_export_audio(openhpsdr_e_export_t *radio_files, const char *dir, guint stream,
+    const guint8 *samples, guint frames, guint channels, guint64 lost_frames, gdouble abs_time)
+{
+   openhpsdr_e_export_file_t *file = NULL;
+   guint64 new_bytes = 0;
+   guint num_values = frames * channels;
+   guint num = 0;
+   guint i = 0;
+   guint j = 0;
+
+   if ( radio_files == NULL || dir == NULL || dir[0] == '\0' || stream >= HPSDR_E_EXPORT_NUM_AUDIO ) {
+       return FALSE;
+   }
+   if ( channels != 1 && channels != 2 ) { return FALSE; }
+
+   file = &radio_files->audio_files[stream];
+   if ( file->failed ) { return FALSE; }
+
+   lost_frames = MIN(lost_frames, (guint64)HPSDR_E_EXPORT_MAX_FILL);
+
+   if ( file->data != NULL ) {
+       new_bytes = (frames + lost_frames) * (guint64)file->frame_bytes;
+       if ( file->channels != channels ||
+            file->data_bytes + new_bytes > G_MAXUINT32 - HPSDR_E_EXPORT_WAV_HDR ) {
+           export_close(file, radio_files->name, stream);
+           lost_frames = 0;
+       }
+   }
+
+   if ( file->data == NULL ) {
+       if ( !export_open(file, dir, audio_names[stream], radio_files->name, HPSDR_E_EXPORT_WAV, channels,
+                HPSDR_E_EXPORT_AUDIO_RATE, 0, abs_time) ) {
+           return FALSE;
+       }
+       lost_frames = 0;
+   }
+
+   if ( lost_frames > 0 ) {
+       file->gaps++;
+       export_write_zeros(file, lost_frames);
+   }
+
+   // Big endian to little endian, a buffer at a time.
+   for ( i = 0; i < num_values; i += num ) {
+       num = MIN(num_values - i, (guint)(sizeof(export_buf) / 2));
+       for ( j = 0; j < num; j++ ) {
+           export_buf[j * 2] = samples[((i + j) * 2) + 1];
+           export_buf[(j * 2) + 1] = samples[(i + j) * 2];
+       }
+       fwrite(export_buf, 1, num * 2, file->data);
+   }
+
+   file->samples += frames;
+   file->data_bytes += (guint64)frames * file->frame_bytes;
+
+   return TRUE;
+}
+
+void openhpsdr_e_export_close_all(void)
+{
+   openhpsdr_e_export_t *radio_files = NULL;
+   guint ddc = 0;
+   guint stream = 0;
+   guint i = 0;
+
+   if ( export_radios == NULL ) { return; }
+
+   for ( i = 0; i < export_radios->len; i++ ) {
+       radio_files = (openhpsdr_e_export_t *)g_ptr_array_index(export_radios, i);
+
+       for ( ddc = 0; ddc < HPSDR_E_EXPORT_NUM_DDC; ddc++ ) {
+           export_close(&radio_files->ddc_files[ddc], radio_files->name, ddc);
+       }
+       for ( stream = 0; stream < HPSDR_E_EXPORT_NUM_AUDIO; stream++ ) {
+           export_close(&radio_files->audio_files[stream], radio_files->name, stream);
+       }
+
+       g_free(radio_files->name);
+       g_free(radio_files);
+   }
+
+   g_ptr_array_free(export_radios, TRUE);
+   export_radios = NULL;
+}
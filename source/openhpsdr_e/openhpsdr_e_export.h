@@ -0,0 +1,88 @@
+/* openhpsdr_e_export.h
+ * Header file for the OpenHPSDR Ethernet sample export
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __OPENHPSDR_E_EXPORT_H__
+#define __OPENHPSDR_E_EXPORT_H__
+
+// EXPORT FILE FORMATS (PREFERENCE)
+#define HPSDR_E_EXPORT_NONE     0 // NO EXPORT
+#define HPSDR_E_EXPORT_RAW_F32  1 // INTERLEAVED I&Q FLOAT32 LITTLE ENDIAN, FULL SCALE 1.0
+#define HPSDR_E_EXPORT_RAW_I16  2 // INTERLEAVED I&Q INT16 LITTLE ENDIAN
+#define HPSDR_E_EXPORT_WAV      3 // TWO CHANNEL 16 BIT PCM WAV, I LEFT, Q RIGHT
+#define HPSDR_E_EXPORT_SIGMF    4 // SIGMF CF32_LE DATA AND METADATA JSON
+
+// LOST DATAGRAMS (PREFERENCE)
+#define HPSDR_E_EXPORT_GAPS_ZERO 0 // ZERO FILL THE LOST SAMPLES
+#define HPSDR_E_EXPORT_GAPS_SKIP 1 // LEAVE THE LOST SAMPLES OUT (SIGMF ANNOTATES)
+
+// ONE EXPORT FILE PER DDC OF EACH RADIO
+#define HPSDR_E_EXPORT_NUM_DDC   80
+
+// AUDIO STREAMS, 16 BIT PCM WAV
+#define HPSDR_E_EXPORT_MICL      0 // MIC / LINE SAMPLES, ONE CHANNEL
+#define HPSDR_E_EXPORT_DDCA      1 // DDC AUDIO, LEFT AND RIGHT
+#define HPSDR_E_EXPORT_NUM_AUDIO 2
+#define HPSDR_E_EXPORT_AUDIO_RATE 48000
+
+// LARGEST ZERO FILL OF ONE GAP, SAMPLES
+#define HPSDR_E_EXPORT_MAX_FILL  (1 << 24)
+
+// CONVERSION BUFFER, BYTES
+#define HPSDR_E_EXPORT_BUF_LEN   8192
+
+// WAV FILE HEADER, BYTES
+#define HPSDR_E_EXPORT_WAV_HDR   44
+
+// The export files of one radio, kept until openhpsdr_e_export_close_all().
+typedef struct _openhpsdr_e_export openhpsdr_e_export_t;
+
+// New radio. name is used for the file names (ddcNN_<name>_SSS).
+openhpsdr_e_export_t *openhpsdr_e_export_new(const char *name);
+
+// One DDC I&Q datagram.
+// samples: big endian I&Q sample pairs from the datagram.
+// lost_samples: samples of the lost datagrams before this datagram.
+// sample_rate: sps from the DDC Command, 0 unknown.
+// frequency: Hz from the High Priority Command, 0 unknown.
+// abs_time: capture time of the datagram, seconds since the epoch.
+gboolean openhpsdr_e_export_ddciq(openhpsdr_e_export_t *radio_files, const char *dir, gint format, gint gaps,
+    guint ddc, const guint8 *samples, guint samples_num, guint sample_bits, guint64 lost_samples,
+    guint32 sample_rate, guint64 frequency, gdouble abs_time);
+
+// One Mic / Line or DDC Audio datagram, stream HPSDR_E_EXPORT_MICL or
+// HPSDR_E_EXPORT_DDCA.
+// samples: frames of channels big endian 16 bit samples from the datagram.
+// lost_frames: frames of the lost datagrams before this datagram, written as
+// silence.
+gboolean openhpsdr_e_export_audio(openhpsdr_e_export_t *radio_files, const char *dir, guint stream,
+    const guint8 *samples, guint frames, guint channels, guint64 lost_frames, gdouble abs_time);
+
+// Finish and close every export file and free the radios, at the end of the
+// capture file.
+void openhpsdr_e_export_close_all(void);
+
+#endif /* __OPENHPSDR_E_EXPORT_H__ */
@@ -0,0 +1,576 @@
+/* openhpsdr_e_samples.c
+ * Sample unpacking for the OpenHPSDR Ethernet protocol plug-in
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * The DDC I&Q, DUC I&Q, wide band, Mic / Line and DDC Audio samples are big
+ * endian two's complement values of 8, 16, 24 or 32 bits. The kernels here
+ * unpack a whole block into int32 or float arrays.
+ *
+ * On x86 built with GCC or Clang the kernel is picked at run time from the
+ * CPU: AVX2, SSSE3 (a byte shuffle is needed for 24 and 32 bit) or SSE2
+ * (8 and 16 bit only). Every vector loop stops where its 16 or 32 byte loads
+ * would read past the block, the rest is done by the portable C kernel.
+ * Every other build uses the portable C kernel.
+ *
+ */
+
+#include <glib.h>
+#include <string.h>
+
+#include "openhpsdr_e_samples.h"
+
+#if !defined(HPSDR_E_SAMPLES_FORCE_SCALAR) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HPSDR_E_SAMPLES_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*openhpsdr_e_unpack_fn)(const guint8 *src, guint num_values, gint32 *dst);
+
+// Running sums of the I&Q statistics.
+typedef struct _openhpsdr_e_iq_acc {
+    gdouble  sum_i;
+    gdouble  sum_q;
+    gdouble  sum_power;
+    gdouble  peak;
+    guint32  clipped;
+} openhpsdr_e_iq_acc_t;
+
+static void unpack8_scalar(const guint8 *src, guint num_values, gint32 *dst);
+static void unpack16_scalar(const guint8 *src, guint num_values, gint32 *dst);
+static void unpack24_scalar(const guint8 *src, guint num_values, gint32 *dst);
+static void unpack32_scalar(const guint8 *src, guint num_values, gint32 *dst);
+
+static gint samples_kernel = HPSDR_E_SAMPLES_SCALAR;
+static openhpsdr_e_unpack_fn unpack8 = unpack8_scalar;
+static openhpsdr_e_unpack_fn unpack16 = unpack16_scalar;
+static openhpsdr_e_unpack_fn unpack24 = unpack24_scalar;
+static openhpsdr_e_unpack_fn unpack32 = unpack32_scalar;
+
+//
+// Portable C
+//
+
+static void unpack8_scalar(const guint8 *src, guint num_values, gint32 *dst)
+{
+   guint i = 0;
+
+   for ( i = 0; i < num_values; i++ ) {
+       dst[i] = (gint8)src[i];
+   }
+}
+
+static void unpack16_scalar(const guint8 *src, guint num_values, gint32 *dst)
+{
+   guint i = 0;
+
+   for ( i = 0; i < num_values; i++, src += 2 ) {
+       dst[i] = (gint16)(((guint16)src[0] << 8) | src[1]);
+   }
+}
+
+static void unpack24_scalar(const guint8 *src, guint num_values, gint32 *dst)
+{
+   guint32 raw = 0;
+   guint i = 0;
+
+   for ( i = 0; i < num_values; i++, src += 3 ) {
+       raw = ((guint32)src[0] << 24) | ((guint32)src[1] << 16) | ((guint32)src[2] << 8);
+       dst[i] = (gint32)raw >> 8;
+   }
+}
+
+static void unpack32_scalar(const guint8 *src, guint num_values, gint32 *dst)
+{
+   guint i = 0;
+
+   for ( i = 0; i < num_values; i++, src += 4 ) {
+       dst[i] = (gint32)(((guint32)src[0] << 24) | ((guint32)src[1] << 16) |
+           ((guint32)src[2] << 8) | src[3]);
+   }
+}
+
+#ifdef HPSDR_E_SAMPLES_X86
+
+//
+// SSE2
+//
+
+// 16 values per 16 byte load: each byte to the top of a 32 bit lane, then an
+// arithmetic shift.
+__attribute__((target("sse2")))
+static void unpack8_sse2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m128i zero = _mm_setzero_si128();
+   __m128i v, w;
+   guint i = 0;
+
+   for ( ; i + 16 <= num_values; i += 16 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + i));
+       w = _mm_unpacklo_epi8(zero, v);
+       _mm_storeu_si128((__m128i *)(dst + i), _mm_srai_epi32(_mm_unpacklo_epi16(zero, w), 24));
+       _mm_storeu_si128((__m128i *)(dst + i + 4), _mm_srai_epi32(_mm_unpackhi_epi16(zero, w), 24));
+       w = _mm_unpackhi_epi8(zero, v);
+       _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_srai_epi32(_mm_unpacklo_epi16(zero, w), 24));
+       _mm_storeu_si128((__m128i *)(dst + i + 12), _mm_srai_epi32(_mm_unpackhi_epi16(zero, w), 24));
+   }
+
+   unpack8_scalar(src + i, num_values - i, dst + i);
+}
+
+// 8 values per 16 byte load: swap the bytes of each 16 bit lane, then sign
+// extend to 32 bits.
+__attribute__((target("sse2")))
+static void unpack16_sse2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m128i zero = _mm_setzero_si128();
+   __m128i v;
+   guint i = 0;
+
+   for ( ; i + 8 <= num_values; i += 8 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + (i * 2)));
+       v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+       _mm_storeu_si128((__m128i *)(dst + i), _mm_srai_epi32(_mm_unpacklo_epi16(zero, v), 16));
+       _mm_storeu_si128((__m128i *)(dst + i + 4), _mm_srai_epi32(_mm_unpackhi_epi16(zero, v), 16));
+   }
+
+   unpack16_scalar(src + (i * 2), num_values - i, dst + i);
+}
+
+//
+// SSSE3
+//
+
+// 4 values per load: the 3 bytes of each value go big endian to the top of a
+// 32 bit lane, the low byte is zeroed, then an arithmetic shift. The load is
+// 16 bytes for 12 bytes of samples.
+__attribute__((target("ssse3")))
+static void unpack24_ssse3(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m128i shuffle = _mm_setr_epi8(-128, 2, 1, 0, -128, 5, 4, 3,
+                                         -128, 8, 7, 6, -128, 11, 10, 9);
+   __m128i v;
+   guint i = 0;
+
+   for ( ; (i + 4) * 3 + 4 <= num_values * 3; i += 4 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + (i * 3)));
+       _mm_storeu_si128((__m128i *)(dst + i), _mm_srai_epi32(_mm_shuffle_epi8(v, shuffle), 8));
+   }
+
+   unpack24_scalar(src + (i * 3), num_values - i, dst + i);
+}
+
+__attribute__((target("ssse3")))
+static void unpack32_ssse3(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m128i shuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                         11, 10, 9, 8, 15, 14, 13, 12);
+   __m128i v;
+   guint i = 0;
+
+   for ( ; i + 4 <= num_values; i += 4 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + (i * 4)));
+       _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, shuffle));
+   }
+
+   unpack32_scalar(src + (i * 4), num_values - i, dst + i);
+}
+
+//
+// AVX2
+//
+
+__attribute__((target("avx2")))
+static void unpack8_avx2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   __m128i v;
+   guint i = 0;
+
+   for ( ; i + 16 <= num_values; i += 16 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + i));
+       _mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepi8_epi32(v));
+       _mm256_storeu_si256((__m256i *)(dst + i + 8), _mm256_cvtepi8_epi32(_mm_srli_si128(v, 8)));
+   }
+
+   unpack8_scalar(src + i, num_values - i, dst + i);
+}
+
+__attribute__((target("avx2")))
+static void unpack16_avx2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m128i shuffle = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                         9, 8, 11, 10, 13, 12, 15, 14);
+   __m128i v;
+   guint i = 0;
+
+   for ( ; i + 8 <= num_values; i += 8 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + (i * 2)));
+       _mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepi16_epi32(_mm_shuffle_epi8(v, shuffle)));
+   }
+
+   unpack16_scalar(src + (i * 2), num_values - i, dst + i);
+}
+
+// 8 values per loop: 12 bytes of samples in each 128 bit lane, the second
+// lane loaded from 12 bytes on. The shuffle works within each lane.
+__attribute__((target("avx2")))
+static void unpack24_avx2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m256i shuffle = _mm256_setr_epi8(-128, 2, 1, 0, -128, 5, 4, 3,
+                                            -128, 8, 7, 6, -128, 11, 10, 9,
+                                            -128, 2, 1, 0, -128, 5, 4, 3,
+                                            -128, 8, 7, 6, -128, 11, 10, 9);
+   __m256i v;
+   guint i = 0;
+
+   for ( ; (i + 8) * 3 + 4 <= num_values * 3; i += 8 ) {
+       v = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(src + (i * 3))));
+       v = _mm256_inserti128_si256(v, _mm_loadu_si128((const __m128i *)(src + (i * 3) + 12)), 1);
+       _mm256_storeu_si256((__m256i *)(dst + i), _mm256_srai_epi32(_mm256_shuffle_epi8(v, shuffle), 8));
+   }
+
+   unpack24_ssse3(src + (i * 3), num_values - i, dst + i);
+}
+
+__attribute__((target("avx2")))
+static void unpack32_avx2(const guint8 *src, guint num_values, gint32 *dst)
+{
+   const __m256i shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                            11, 10, 9, 8, 15, 14, 13, 12,
+                                            3, 2, 1, 0, 7, 6, 5, 4,
+                                            11, 10, 9, 8, 15, 14, 13, 12);
+   __m256i v;
+   guint i = 0;
+
+   for ( ; i + 8 <= num_values; i += 8 ) {
+       v = _mm256_loadu_si256((const __m256i *)(src + (i * 4)));
+       _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(v, shuffle));
+   }
+
+   unpack32_scalar(src + (i * 4), num_values - i, dst + i);
+}
+
+// int32 to float times scale.
+__attribute__((target("avx2")))
+static void to_float_avx2(const gint32 *src, guint num_values, gfloat scale, gfloat *dst)
+{
+   const __m256 vscale = _mm256_set1_ps(scale);
+   __m256 f;
+   guint i = 0;
+
+   for ( ; i + 8 <= num_values; i += 8 ) {
+       f = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(src + i)));
+       _mm256_storeu_ps(dst + i, _mm256_mul_ps(f, vscale));
+   }
+
+   for ( ; i < num_values; i++ ) {
+       dst[i] = (gfloat)src[i] * scale;
+   }
+}
+
+__attribute__((target("sse2")))
+static void to_float_sse2(const gint32 *src, guint num_values, gfloat scale, gfloat *dst)
+{
+   const __m128 vscale = _mm_set1_ps(scale);
+   __m128 f;
+   guint i = 0;
+
+   for ( ; i + 4 <= num_values; i += 4 ) {
+       f = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(src + i)));
+       _mm_storeu_ps(dst + i, _mm_mul_ps(f, vscale));
+   }
+
+   for ( ; i < num_values; i++ ) {
+       dst[i] = (gfloat)src[i] * scale;
+   }
+}
+
+// I&Q statistics of num_values unpacked values, I at the even index. Each
+// lane keeps its own sums, the lanes are added at the end. The pairs of I^2
+// and Q^2 are added with a swap of neighbour lanes for the peak.
+__attribute__((target("avx2")))
+static guint iq_acc_avx2(const gint32 *src, guint num_values, gint32 lo, gint32 hi, gfloat scale,
+    openhpsdr_e_iq_acc_t *acc)
+{
+   const __m256 vscale = _mm256_set1_ps(scale);
+   const __m256i vlo = _mm256_set1_epi32(lo);
+   const __m256i vhi = _mm256_set1_epi32(hi);
+   __m256 sum = _mm256_setzero_ps();
+   __m256 sum_power = _mm256_setzero_ps();
+   __m256 peak = _mm256_setzero_ps();
+   __m256i clipped = _mm256_setzero_si256();
+   __m256i v;
+   __m256 f, p;
+   gfloat lanes[8];
+   gint32 counts[8];
+   guint i = 0;
+   guint j = 0;
+
+   for ( ; i + 8 <= num_values; i += 8 ) {
+       v = _mm256_loadu_si256((const __m256i *)(src + i));
+       clipped = _mm256_sub_epi32(clipped, _mm256_or_si256(_mm256_cmpeq_epi32(v, vlo), _mm256_cmpeq_epi32(v, vhi)));
+       f = _mm256_mul_ps(_mm256_cvtepi32_ps(v), vscale);
+       sum = _mm256_add_ps(sum, f);
+       p = _mm256_mul_ps(f, f);
+       sum_power = _mm256_add_ps(sum_power, p);
+       peak = _mm256_max_ps(peak, _mm256_add_ps(p, _mm256_permute_ps(p, 0xB1)));
+   }
+
+   _mm256_storeu_ps(lanes, sum);
+   for ( j = 0; j < 8; j += 2 ) {
+       acc->sum_i += lanes[j];
+       acc->sum_q += lanes[j + 1];
+   }
+   _mm256_storeu_ps(lanes, sum_power);
+   for ( j = 0; j < 8; j++ ) {
+       acc->sum_power += lanes[j];
+   }
+   _mm256_storeu_ps(lanes, peak);
+   for ( j = 0; j < 8; j++ ) {
+       acc->peak = MAX(acc->peak, lanes[j]);
+   }
+   _mm256_storeu_si256((__m256i *)counts, clipped);
+   for ( j = 0; j < 8; j++ ) {
+       acc->clipped += (guint32)counts[j];
+   }
+
+   return i;
+}
+
+__attribute__((target("sse2")))
+static guint iq_acc_sse2(const gint32 *src, guint num_values, gint32 lo, gint32 hi, gfloat scale,
+    openhpsdr_e_iq_acc_t *acc)
+{
+   const __m128 vscale = _mm_set1_ps(scale);
+   const __m128i vlo = _mm_set1_epi32(lo);
+   const __m128i vhi = _mm_set1_epi32(hi);
+   __m128 sum = _mm_setzero_ps();
+   __m128 sum_power = _mm_setzero_ps();
+   __m128 peak = _mm_setzero_ps();
+   __m128i clipped = _mm_setzero_si128();
+   __m128i v;
+   __m128 f, p;
+   gfloat lanes[4];
+   gint32 counts[4];
+   guint i = 0;
+   guint j = 0;
+
+   for ( ; i + 4 <= num_values; i += 4 ) {
+       v = _mm_loadu_si128((const __m128i *)(src + i));
+       clipped = _mm_sub_epi32(clipped, _mm_or_si128(_mm_cmpeq_epi32(v, vlo), _mm_cmpeq_epi32(v, vhi)));
+       f = _mm_mul_ps(_mm_cvtepi32_ps(v), vscale);
+       sum = _mm_add_ps(sum, f);
+       p = _mm_mul_ps(f, f);
+       sum_power = _mm_add_ps(sum_power, p);
+       peak = _mm_max_ps(peak, _mm_add_ps(p, _mm_shuffle_ps(p, p, 0xB1)));
+   }
+
+   _mm_storeu_ps(lanes, sum);
+   acc->sum_i += lanes[0] + lanes[2];
+   acc->sum_q += lanes[1] + lanes[3];
+   _mm_storeu_ps(lanes, sum_power);
+   acc->sum_power += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+   _mm_storeu_ps(lanes, peak);
+   for ( j = 0; j < 4; j++ ) {
+       acc->peak = MAX(acc->peak, lanes[j]);
+   }
+   _mm_storeu_si128((__m128i *)counts, clipped);
+   acc->clipped += (guint32)(counts[0] + counts[1] + counts[2] + counts[3]);
+
+   return i;
+}
+
+#endif /* HPSDR_E_SAMPLES_X86 */
+
+// The rest of the values from start, an even index.
+static void iq_acc_scalar(const gint32 *src, guint start, guint num_values, gint32 lo, gint32 hi,
+    gfloat scale, openhpsdr_e_iq_acc_t *acc)
+{
+   gfloat fi = 0;
+   gfloat fq = 0;
+   gfloat p = 0;
+   guint i = 0;
+
+   for ( i = start; i + 1 < num_values; i += 2 ) {
+       if ( src[i] == lo || src[i] == hi ) { acc->clipped++; }
+       if ( src[i + 1] == lo || src[i + 1] == hi ) { acc->clipped++; }
+       fi = (gfloat)src[i] * scale;
+       fq = (gfloat)src[i + 1] * scale;
+       p = (fi * fi) + (fq * fq);
+       acc->sum_i += fi;
+       acc->sum_q += fq;
+       acc->sum_power += p;
+       acc->peak = MAX(acc->peak, p);
+   }
+}
+
+static void to_float_scalar(const gint32 *src, guint num_values, gfloat scale, gfloat *dst)
+{
+   guint i = 0;
+
+   for ( i = 0; i < num_values; i++ ) {
+       dst[i] = (gfloat)src[i] * scale;
+   }
+}
+
+void openhpsdr_e_samples_init(void)
+{
+#ifdef HPSDR_E_SAMPLES_X86
+   __builtin_cpu_init();
+
+   if ( __builtin_cpu_supports("avx2") ) {
+       samples_kernel = HPSDR_E_SAMPLES_AVX2;
+       unpack8 = unpack8_avx2;
+       unpack16 = unpack16_avx2;
+       unpack24 = unpack24_avx2;
+       unpack32 = unpack32_avx2;
+   } else if ( __builtin_cpu_supports("ssse3") ) {
+       samples_kernel = HPSDR_E_SAMPLES_SSSE3;
+       unpack8 = unpack8_sse2;
+       unpack16 = unpack16_sse2;
+       unpack24 = unpack24_ssse3;
+       unpack32 = unpack32_ssse3;
+   } else if ( __builtin_cpu_supports("sse2") ) {
+       samples_kernel = HPSDR_E_SAMPLES_SSE2;
+       unpack8 = unpack8_sse2;
+       unpack16 = unpack16_sse2;
+   }
+#endif
+}
+
+gint openhpsdr_e_samples_kernel(void)
+{
+   return samples_kernel;
+}
+
+guint openhpsdr_e_unpack_i32(const guint8 *src, guint num_values, guint sample_bits, gint32 *dst)
+{
+   switch (sample_bits) {
+       case 8:
+           unpack8(src, num_values, dst);
+           break;
+       case 16:
+           unpack16(src, num_values, dst);
+           break;
+       case 24:
+           unpack24(src, num_values, dst);
+           break;
+       case 32:
+           unpack32(src, num_values, dst);
+           break;
+       default:
+           return 0;
+   }
+
+   return num_values;
+}
+
+// The int32 values are unpacked into a stack buffer a chunk at a time, then
+// converted into dst.
+guint openhpsdr_e_unpack_f32(const guint8 *src, guint num_values, guint sample_bits, gfloat *dst)
+{
+   gint32 chunk[HPSDR_E_SAMPLES_CHUNK];
+   gfloat scale = 0;
+   guint num = 0;
+   guint i = 0;
+
+   if ( sample_bits != 8 && sample_bits != 16 && sample_bits != 24 && sample_bits != 32 ) {
+       return 0;
+   }
+
+   // 2^-(bits - 1), exact in a float
+   scale = 1.0f / (gfloat)((guint64)1 << (sample_bits - 1));
+
+   for ( i = 0; i < num_values; i += num ) {
+       num = MIN(num_values - i, HPSDR_E_SAMPLES_CHUNK);
+       openhpsdr_e_unpack_i32(src + (i * (sample_bits / 8)), num, sample_bits, chunk);
+
+#ifdef HPSDR_E_SAMPLES_X86
+       if ( samples_kernel == HPSDR_E_SAMPLES_AVX2 ) {
+           to_float_avx2(chunk, num, scale, dst + i);
+       } else if ( samples_kernel != HPSDR_E_SAMPLES_SCALAR ) {
+           to_float_sse2(chunk, num, scale, dst + i);
+       } else {
+           to_float_scalar(chunk, num, scale, dst + i);
+       }
+#else
+       to_float_scalar(chunk, num, scale, dst + i);
+#endif
+   }
+
+   return num_values;
+}
+
+gboolean openhpsdr_e_iq_stats(const guint8 *src, guint samples_num, guint sample_bits,
+    openhpsdr_e_iq_stats_t *stats)
+{
+   gint32 chunk[HPSDR_E_SAMPLES_CHUNK];
+   openhpsdr_e_iq_acc_t acc;
+   guint num_values = samples_num * 2;
+   guint bytes = sample_bits / 8;
+   gint32 hi = 0;
+   gint32 lo = 0;
+   gfloat scale = 0;
+   guint done = 0;
+   guint num = 0;
+   guint i = 0;
+
+   memset(stats, 0, sizeof(*stats));
+   memset(&acc, 0, sizeof(acc));
+
+   if ( sample_bits != 8 && sample_bits != 16 && sample_bits != 24 && sample_bits != 32 ) {
+       return FALSE;
+   }
+   if ( samples_num == 0 ) { return TRUE; }
+
+   hi = (gint32)(((guint64)1 << (sample_bits - 1)) - 1);
+   lo = -hi - 1;
+   scale = 1.0f / (gfloat)((guint64)1 << (sample_bits - 1));
+
+   // HPSDR_E_SAMPLES_CHUNK is even, every chunk starts with an I value.
+   for ( i = 0; i < num_values; i += num ) {
+       num = MIN(num_values - i, HPSDR_E_SAMPLES_CHUNK);
+       openhpsdr_e_unpack_i32(src + (i * bytes), num, sample_bits, chunk);
+
+       done = 0;
+#ifdef HPSDR_E_SAMPLES_X86
+       if ( samples_kernel == HPSDR_E_SAMPLES_AVX2 ) {
+           done = iq_acc_avx2(chunk, num, lo, hi, scale, &acc);
+       } else if ( samples_kernel != HPSDR_E_SAMPLES_SCALAR ) {
+           done = iq_acc_sse2(chunk, num, lo, hi, scale, &acc);
+       }
+#endif
+       iq_acc_scalar(chunk, done, num, lo, hi, scale, &acc);
+   }
+
+   stats->mean_i = acc.sum_i / samples_num;
+   stats->mean_q = acc.sum_q / samples_num;
+   stats->power = acc.sum_power / samples_num;
+   stats->peak = acc.peak;
+   stats->clipped = acc.clipped;
+
+   return TRUE;
+}
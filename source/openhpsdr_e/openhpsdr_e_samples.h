@@ -0,0 +1,70 @@
+/* openhpsdr_e_samples.h
+ * Header file for the OpenHPSDR Ethernet sample unpacking
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __OPENHPSDR_E_SAMPLES_H__
+#define __OPENHPSDR_E_SAMPLES_H__
+
+// UNPACK KERNELS
+#define HPSDR_E_SAMPLES_SCALAR  0 // PORTABLE C
+#define HPSDR_E_SAMPLES_SSE2    1 // 8 AND 16 BIT SSE2, 24 AND 32 BIT PORTABLE C
+#define HPSDR_E_SAMPLES_SSSE3   2 // SSSE3 BYTE SHUFFLE
+#define HPSDR_E_SAMPLES_AVX2    3 // AVX2 BYTE SHUFFLE, TWO 128 BIT LANES
+
+// VALUES UNPACKED AT A TIME BY THE CALLERS, STACK BUFFERS
+#define HPSDR_E_SAMPLES_CHUNK   256
+
+// I&Q statistics of one block, I and Q scaled to a full scale of 1.0.
+typedef struct _openhpsdr_e_iq_stats {
+    gdouble  mean_i;        // DC offset
+    gdouble  mean_q;
+    gdouble  power;         // Mean of I^2 + Q^2
+    gdouble  peak;          // Largest I^2 + Q^2
+    guint32  clipped;       // I or Q values at full scale
+} openhpsdr_e_iq_stats_t;
+
+// Pick the fastest kernel the CPU supports. Called once at registration.
+// Builds with HPSDR_E_SAMPLES_FORCE_SCALAR defined only use portable C.
+void openhpsdr_e_samples_init(void);
+
+// Kernel in use, HPSDR_E_SAMPLES_*.
+gint openhpsdr_e_samples_kernel(void);
+
+// Unpack num_values big endian two's complement values of sample_bits
+// (8, 16, 24 or 32) bits from src. The values are sign extended into dst.
+// src must hold num_values * sample_bits / 8 bytes. Returns the number of
+// values unpacked, 0 for an unsupported sample_bits.
+guint openhpsdr_e_unpack_i32(const guint8 *src, guint num_values, guint sample_bits, gint32 *dst);
+
+// As openhpsdr_e_unpack_i32, scaled to a full scale of 1.0.
+guint openhpsdr_e_unpack_f32(const guint8 *src, guint num_values, guint sample_bits, gfloat *dst);
+
+// One pass statistics of samples_num interleaved big endian I&Q pairs.
+// Returns FALSE for an unsupported sample_bits.
+gboolean openhpsdr_e_iq_stats(const guint8 *src, guint samples_num, guint sample_bits,
+    openhpsdr_e_iq_stats_t *stats);
+
+#endif /* __OPENHPSDR_E_SAMPLES_H__ */
@@ -0,0 +1,456 @@
+/* openhpsdr_e_spectrum.c
+ * Wide band spectrum analysis for the OpenHPSDR Ethernet protocol plug-in
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * The wide band data is the raw ADC, real samples at the 122.88 MHz sample
+ * clock. Consecutive datagrams of an ADC are put into a frame of fft_len
+ * samples. A full frame gets a Blackman-Harris window and a radix-2 FFT.
+ * Bins are scaled so a full scale sine is 0 dBFS.
+ *
+ * For each frame: the noise floor (median bin), the strongest spurs, the
+ * largest sample and the clipped samples. The power of each bin is averaged
+ * over the frames of the ADC.
+ *
+ * CSV files, when a directory is given:
+ *   wb_<name>_SSS_waterfall.csv - one row per frame: capture time, frame
+ *                                 and HPSDR_E_WB_CSV_BINS columns of dBFS
+ *   wb_<name>_SSS_spectrum.csv  - the average spectrum, written at the end
+ *   SSS - File number of the ADC, a new FFT size starts a new file.
+ *
+ */
+
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <wsutil/file_util.h>
+
+#include "openhpsdr_e_samples.h"
+#include "openhpsdr_e_spectrum.h"
+
+// The ADC sample clock, Hz
+#define WB_SAMPLE_RATE 122880000.0
+
+struct _openhpsdr_e_wb_adc {
+    gchar   *name;
+    guint    fft_len;       // 0 before the first datagram
+    gfloat  *samples;       // Frame being filled, full scale 1.0
+    guint    fill;          // Samples in the frame
+    guint32  clipped;       // Clipped samples in the frame
+    gdouble *average;       // Sum of the power of each bin, fft_len / 2 + 1
+    guint32  frames;        // Frames of the ADC
+    guint32  averaged;      // Frames in average
+    guint32  overloads;     // Frames with clipped samples
+    guint    segment;       // File number
+    gchar   *dir;           // CSV directory of the segment, NULL none
+    FILE    *waterfall;
+    gboolean failed;        // Could not open, not tried again for this segment
+};
+
+static GPtrArray *wb_adcs = NULL;
+
+// Work buffers, sized for the largest FFT in use.
+static guint wb_work_len = 0;
+static gfloat *wb_re = NULL;
+static gfloat *wb_im = NULL;
+static gfloat *wb_window = NULL;
+static gdouble wb_window_sum = 0;
+static gdouble *wb_bins = NULL;
+
+// Twiddle factors of the last FFT size.
+static guint fft_len_tw = 0;
+static gfloat *fft_cos = NULL;
+static gfloat *fft_sin = NULL;
+
+void openhpsdr_e_fft(gfloat *re, gfloat *im, guint n)
+{
+   guint i = 0;
+   guint j = 0;
+   guint k = 0;
+   guint bit = 0;
+   guint half = 0;
+   guint step = 0;
+   guint len = 0;
+   gfloat tr = 0;
+   gfloat ti = 0;
+   gfloat wr = 0;
+   gfloat wi = 0;
+
+   if ( n < 2 ) { return; }
+
+   if ( n != fft_len_tw ) {
+       fft_cos = (gfloat *)g_realloc(fft_cos, (n / 2) * sizeof(gfloat));
+       fft_sin = (gfloat *)g_realloc(fft_sin, (n / 2) * sizeof(gfloat));
+       for ( i = 0; i < n / 2; i++ ) {
+           fft_cos[i] = (gfloat)cos(2.0 * G_PI * i / n);
+           fft_sin[i] = (gfloat)-sin(2.0 * G_PI * i / n);
+       }
+       fft_len_tw = n;
+   }
+
+   // Bit reversed order
+   for ( i = 1, j = 0; i < n; i++ ) {
+       for ( bit = n >> 1; j & bit; bit >>= 1 ) {
+           j ^= bit;
+       }
+       j |= bit;
+       if ( i < j ) {
+           tr = re[i]; re[i] = re[j]; re[j] = tr;
+           ti = im[i]; im[i] = im[j]; im[j] = ti;
+       }
+   }
+
+   // Butterflies
+   for ( len = 2; len <= n; len <<= 1 ) {
+       half = len / 2;
+       step = n / len;
+       for ( i = 0; i < n; i += len ) {
+           for ( k = 0; k < half; k++ ) {
+               wr = fft_cos[k * step];
+               wi = fft_sin[k * step];
+               j = i + k + half;
+               tr = (re[j] * wr) - (im[j] * wi);
+               ti = (re[j] * wi) + (im[j] * wr);
+               re[j] = re[i + k] - tr;
+               im[j] = im[i + k] - ti;
+               re[i + k] += tr;
+               im[i + k] += ti;
+           }
+       }
+   }
+}
+
+static gdouble wb_dbfs(gdouble power)
+{
+   if ( power <= 0 ) { return HPSDR_E_WB_DBFS_FLOOR; }
+   return MAX(10.0 * log10(power), HPSDR_E_WB_DBFS_FLOOR);
+}
+
+static int wb_compare_double(const void *a, const void *b)
+{
+   gdouble da = *(const gdouble *)a;
+   gdouble db = *(const gdouble *)b;
+
+   return (da > db) - (da < db);
+}
+
+// Window and work buffers for an FFT of n samples.
+static void wb_work(guint n)
+{
+   guint i = 0;
+   gdouble x = 0;
+
+   if ( n == wb_work_len ) { return; }
+
+   wb_re = (gfloat *)g_realloc(wb_re, n * sizeof(gfloat));
+   wb_im = (gfloat *)g_realloc(wb_im, n * sizeof(gfloat));
+   wb_window = (gfloat *)g_realloc(wb_window, n * sizeof(gfloat));
+   wb_bins = (gdouble *)g_realloc(wb_bins, ((n / 2) + 1) * sizeof(gdouble));
+
+   // 4 term Blackman-Harris
+   wb_window_sum = 0;
+   for ( i = 0; i < n; i++ ) {
+       x = 2.0 * G_PI * i / n;
+       wb_window[i] = (gfloat)(0.35875 - (0.48829 * cos(x)) + (0.14128 * cos(2 * x)) - (0.01168 * cos(3 * x)));
+       wb_window_sum += wb_window[i];
+   }
+
+   wb_work_len = n;
+}
+
+static void wb_close_files(openhpsdr_e_wb_adc_t *wb)
+{
+   gchar *path = NULL;
+   FILE *fp = NULL;
+   guint i = 0;
+   guint bins = wb->fft_len / 2 + 1;
+
+   if ( wb->waterfall != NULL ) {
+       fclose(wb->waterfall);
+       wb->waterfall = NULL;
+   }
+
+   if ( wb->dir != NULL && wb->averaged > 0 ) {
+       path = g_strdup_printf("%s%swb_%s_%03u_spectrum.csv", wb->dir, G_DIR_SEPARATOR_S, wb->name, wb->segment);
+       fp = ws_fopen(path, "w");
+       if ( fp != NULL ) {
+           fprintf(fp, "frequency_hz,average_dbfs\n");
+           for ( i = 0; i < bins; i++ ) {
+               fprintf(fp, "%.1f,%.2f\n", i * WB_SAMPLE_RATE / wb->fft_len,
+                   wb_dbfs(wb->average[i] / wb->averaged));
+           }
+           fclose(fp);
+       }
+       g_free(path);
+   }
+
+   g_free(wb->dir);
+   wb->dir = NULL;
+   wb->failed = FALSE;
+}
+
+// A new FFT size: finish the files and the average of the old size.
+static void wb_resize(openhpsdr_e_wb_adc_t *wb, guint fft_len)
+{
+   if ( wb->fft_len != 0 ) {
+       wb_close_files(wb);
+       wb->segment++;
+   }
+
+   wb->fft_len = fft_len;
+   wb->samples = (gfloat *)g_realloc(wb->samples, fft_len * sizeof(gfloat));
+   wb->average = (gdouble *)g_realloc(wb->average, ((fft_len / 2) + 1) * sizeof(gdouble));
+   memset(wb->average, 0, ((fft_len / 2) + 1) * sizeof(gdouble));
+   wb->fill = 0;
+   wb->clipped = 0;
+   wb->averaged = 0;
+}
+
+// One waterfall row, the bins combined into HPSDR_E_WB_CSV_BINS columns.
+static void wb_waterfall_row(openhpsdr_e_wb_adc_t *wb, const char *dir, gdouble abs_time, guint32 frame)
+{
+   gchar *path = NULL;
+   guint bins = wb->fft_len / 2;
+   guint cols = MIN(bins, HPSDR_E_WB_CSV_BINS);
+   guint per_col = bins / cols;
+   gdouble value = 0;
+   guint i = 0;
+   guint j = 0;
+
+   if ( dir == NULL || dir[0] == '\0' || wb->failed ) { return; }
+
+   if ( wb->waterfall == NULL ) {
+       g_free(wb->dir);
+       wb->dir = g_strdup(dir);
+       path = g_strdup_printf("%s%swb_%s_%03u_waterfall.csv", dir, G_DIR_SEPARATOR_S, wb->name, wb->segment);
+       wb->waterfall = ws_fopen(path, "w");
+       g_free(path);
+       if ( wb->waterfall == NULL ) {
+           wb->failed = TRUE;
+           return;
+       }
+       // Header: the center frequency of each column
+       fprintf(wb->waterfall, "time,frame");
+       for ( i = 0; i < cols; i++ ) {
+           fprintf(wb->waterfall, ",%.0f", ((i * per_col) + (per_col / 2.0)) * WB_SAMPLE_RATE / wb->fft_len);
+       }
+       fprintf(wb->waterfall, "\n");
+   }
+
+   fprintf(wb->waterfall, "%.6f,%u", abs_time, frame);
+   for ( i = 0; i < cols; i++ ) {
+       value = wb_bins[i * per_col];
+       for ( j = 1; j < per_col; j++ ) {
+           value = MAX(value, wb_bins[(i * per_col) + j]);
+       }
+       fprintf(wb->waterfall, ",%.1f", wb_dbfs(value));
+   }
+   fprintf(wb->waterfall, "\n");
+}
+
+// Analyse the full frame of wb.
+static void wb_analyse(openhpsdr_e_wb_adc_t *wb, const char *dir, gdouble abs_time,
+    openhpsdr_e_wb_frame_t *frame)
+{
+   guint n = wb->fft_len;
+   guint bins = (n / 2) + 1;
+   gdouble scale = 0;
+   gdouble peak = 0;
+   gdouble *sorted = NULL;
+   guint spur_bin[HPSDR_E_WB_SPURS];
+   guint best = 0;
+   guint i = 0;
+   guint j = 0;
+   guint k = 0;
+
+   wb_work(n);
+
+   for ( i = 0; i < n; i++ ) {
+       peak = MAX(peak, fabs(wb->samples[i]));
+       wb_re[i] = wb->samples[i] * wb_window[i];
+       wb_im[i] = 0;
+   }
+
+   openhpsdr_e_fft(wb_re, wb_im, n);
+
+   // A full scale sine of amplitude 1.0 is 0 dBFS.
+   scale = 2.0 / wb_window_sum;
+   scale *= scale;
+   for ( k = 0; k < bins; k++ ) {
+       wb_bins[k] = (((gdouble)wb_re[k] * wb_re[k]) + ((gdouble)wb_im[k] * wb_im[k])) * scale;
+       wb->average[k] += wb_bins[k];
+   }
+   wb->averaged++;
+   wb->frames++;
+   if ( wb->clipped > 0 ) { wb->overloads++; }
+
+   memset(frame, 0, sizeof(*frame));
+   frame->number = wb->frames;
+   frame->fft_len = n;
+   frame->peak_dbfs = peak > 0 ? 20.0 * log10(peak) : HPSDR_E_WB_DBFS_FLOOR;
+   frame->clipped = wb->clipped;
+   frame->overloads = wb->overloads;
+   frame->averaged = wb->averaged;
+
+   // Noise floor, the median bin without DC
+   sorted = (gdouble *)g_memdup(wb_bins + HPSDR_E_WB_SPUR_GUARD,
+       (bins - HPSDR_E_WB_SPUR_GUARD) * sizeof(gdouble));
+   qsort(sorted, bins - HPSDR_E_WB_SPUR_GUARD, sizeof(gdouble), wb_compare_double);
+   frame->noise_floor = wb_dbfs(sorted[(bins - HPSDR_E_WB_SPUR_GUARD) / 2]);
+   g_free(sorted);
+
+   wb_waterfall_row(wb, dir, abs_time, frame->number);
+
+   // Strongest spurs: local maxima, each one more than guard bins away from
+   // the stronger ones.
+   for ( i = 0; i < HPSDR_E_WB_SPURS; i++ ) {
+       best = 0;
+       for ( k = HPSDR_E_WB_SPUR_GUARD; k + 1 < bins; k++ ) {
+           if ( wb_bins[k] <= 0 || wb_bins[k] < wb_bins[k - 1] || wb_bins[k] < wb_bins[k + 1] ) { continue; }
+           if ( best != 0 && wb_bins[k] <= wb_bins[best] ) { continue; }
+           for ( j = 0; j < i; j++ ) {
+               if ( ABS((gint)k - (gint)spur_bin[j]) <= HPSDR_E_WB_SPUR_GUARD ) { break; }
+           }
+           if ( j == i ) { best = k; }
+       }
+       if ( best == 0 ) { break; }
+
+       spur_bin[i] = best;
+       frame->spur_freq[i] = best * WB_SAMPLE_RATE / n;
+       frame->spur_dbfs[i] = wb_dbfs(wb_bins[best]);
+       frame->spurs_num++;
+   }
+}
+
+openhpsdr_e_wb_adc_t *openhpsdr_e_wb_new(const char *name)
+{
+   openhpsdr_e_wb_adc_t *wb = g_new0(openhpsdr_e_wb_adc_t, 1);
+   const gchar *other = NULL;
+   size_t len = strlen(name);
+   guint same = 0;
+   guint i = 0;
+
+   if ( wb_adcs == NULL ) {
+       wb_adcs = g_ptr_array_new();
+   }
+
+   // The same ADC of another radio gets a number, the files are not shared.
+   for ( i = 0; i < wb_adcs->len; i++ ) {
+       other = ((openhpsdr_e_wb_adc_t *)g_ptr_array_index(wb_adcs, i))->name;
+       if ( strncmp(other, name, len) == 0 && ( other[len] == '\0' || other[len] == '_' ) ) {
+           same++;
+       }
+   }
+
+   wb->name = same ? g_strdup_printf("%s_%u", name, same + 1) : g_strdup(name);
+   g_ptr_array_add(wb_adcs, wb);
+
+   return wb;
+}
+
+gboolean openhpsdr_e_wb_add(openhpsdr_e_wb_adc_t *wb, const guint8 *samples, guint samples_num,
+    guint sample_bits, guint fft_len, gboolean restart, const char *dir, gdouble abs_time,
+    openhpsdr_e_wb_frame_t *frame)
+{
+   gint32 chunk[HPSDR_E_SAMPLES_CHUNK];
+   gint32 hi = 0;
+   guint num = 0;
+   guint i = 0;
+   guint j = 0;
+
+   if ( wb == NULL || fft_len < HPSDR_E_WB_FFT_MIN || fft_len > HPSDR_E_WB_FFT_MAX ||
+        ( fft_len & (fft_len - 1) ) != 0 ) {
+       return FALSE;
+   }
+   if ( sample_bits != 8 && sample_bits != 16 && sample_bits != 24 && sample_bits != 32 ) {
+       return FALSE;
+   }
+
+   if ( fft_len != wb->fft_len ) {
+       wb_resize(wb, fft_len);
+   } else if ( restart ) {
+       wb->fill = 0;
+       wb->clipped = 0;
+   }
+
+   // A datagram that does not fit is the start of the next frame.
+   samples_num = MIN(samples_num, wb->fft_len - wb->fill);
+
+   hi = (gint32)(((guint64)1 << (sample_bits - 1)) - 1);
+   for ( i = 0; i < samples_num; i += num ) {
+       num = MIN(samples_num - i, HPSDR_E_SAMPLES_CHUNK);
+       openhpsdr_e_unpack_i32(samples + (i * (sample_bits / 8)), num, sample_bits, chunk);
+       for ( j = 0; j < num; j++ ) {
+           if ( chunk[j] >= hi || chunk[j] < -hi ) { wb->clipped++; }
+       }
+   }
+   openhpsdr_e_unpack_f32(samples, samples_num, sample_bits, wb->samples + wb->fill);
+   wb->fill += samples_num;
+
+   if ( wb->fill < wb->fft_len ) { return FALSE; }
+
+   wb_analyse(wb, dir, abs_time, frame);
+   wb->fill = 0;
+   wb->clipped = 0;
+
+   return TRUE;
+}
+
+void openhpsdr_e_wb_close_all(void)
+{
+   openhpsdr_e_wb_adc_t *wb = NULL;
+   guint i = 0;
+
+   if ( wb_adcs != NULL ) {
+       for ( i = 0; i < wb_adcs->len; i++ ) {
+           wb = (openhpsdr_e_wb_adc_t *)g_ptr_array_index(wb_adcs, i);
+           wb_close_files(wb);
+           g_free(wb->name);
+           g_free(wb->samples);
+           g_free(wb->average);
+           g_free(wb);
+       }
+       g_ptr_array_free(wb_adcs, TRUE);
+       wb_adcs = NULL;
+   }
+
+   g_free(wb_re);
+   g_free(wb_im);
+   g_free(wb_window);
+   g_free(wb_bins);
+   g_free(fft_cos);
+   g_free(fft_sin);
+   wb_re = NULL;
+   wb_im = NULL;
+   wb_window = NULL;
+   wb_bins = NULL;
+   fft_cos = NULL;
+   fft_sin = NULL;
+   wb_work_len = 0;
+   fft_len_tw = 0;
+}
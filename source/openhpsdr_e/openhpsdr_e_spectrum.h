@@ -0,0 +1,83 @@
+/* openhpsdr_e_spectrum.h
+ * Header file for the OpenHPSDR Ethernet wide band spectrum analysis
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __OPENHPSDR_E_SPECTRUM_H__
+#define __OPENHPSDR_E_SPECTRUM_H__
+
+// FFT SIZE, POWER OF TWO SAMPLES
+#define HPSDR_E_WB_FFT_MIN      512
+#define HPSDR_E_WB_FFT_MAX      65536
+
+// STRONGEST SPURS REPORTED FOR EACH FRAME
+#define HPSDR_E_WB_SPURS        3
+// BINS EACH SIDE OF A SPUR LEFT OUT OF THE NEXT SPUR SEARCH, AND BINS FROM DC
+// LEFT OUT OF THE SEARCH. THE BLACKMAN-HARRIS MAIN LOBE IS 4 BINS EACH SIDE.
+#define HPSDR_E_WB_SPUR_GUARD   8
+
+// COLUMNS OF THE WATERFALL CSV, BINS ARE COMBINED BY THEIR LARGEST VALUE
+#define HPSDR_E_WB_CSV_BINS     512
+
+// dBFS OF AN EMPTY BIN
+#define HPSDR_E_WB_DBFS_FLOOR   (-200.0)
+
+// Result of one full spectrum (FFT frame) of an ADC.
+typedef struct _openhpsdr_e_wb_frame {
+    guint32  number;        // Frame of the ADC, from 1
+    guint    fft_len;       // Samples in the frame
+    gdouble  noise_floor;   // Median bin, dBFS
+    gdouble  peak_dbfs;     // Largest sample of the frame, dBFS
+    guint32  clipped;       // Samples at full scale in the frame
+    guint32  overloads;     // Frames of the ADC with clipped samples, this one included
+    guint32  averaged;      // Frames in the average spectrum
+    guint    spurs_num;
+    gdouble  spur_freq[HPSDR_E_WB_SPURS];   // Hz
+    gdouble  spur_dbfs[HPSDR_E_WB_SPURS];
+} openhpsdr_e_wb_frame_t;
+
+// Spectrum analysis state of one ADC.
+typedef struct _openhpsdr_e_wb_adc openhpsdr_e_wb_adc_t;
+
+// In place forward FFT of n complex values, n a power of two.
+void openhpsdr_e_fft(gfloat *re, gfloat *im, guint n);
+
+// New ADC state. name is used for the CSV files (wb_<name>_...).
+openhpsdr_e_wb_adc_t *openhpsdr_e_wb_new(const char *name);
+
+// Add one wide band datagram of samples_num big endian samples of sample_bits.
+// restart: the datagram does not follow the previous one (lost datagrams, a
+// sequence restart), a partial frame is dropped. A new fft_len starts a new frame
+// and a new average. dir: CSV directory, NULL or empty for none.
+// Returns TRUE and fills frame when the datagram completed a frame.
+gboolean openhpsdr_e_wb_add(openhpsdr_e_wb_adc_t *wb, const guint8 *samples, guint samples_num,
+    guint sample_bits, guint fft_len, gboolean restart, const char *dir, gdouble abs_time,
+    openhpsdr_e_wb_frame_t *frame);
+
+// Write the average spectrum CSV of every ADC, close the files and free the
+// states. At the end of the capture file.
+void openhpsdr_e_wb_close_all(void);
+
+#endif /* __OPENHPSDR_E_SPECTRUM_H__ */
@@ -0,0 +1,295 @@
+/* openhpsdr_e_telemetry.c
+ * High Priority Status telemetry for the OpenHPSDR Ethernet protocol plug-in
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * The exciter, forward and reverse power readings are 12 bit ADC counts of
+ * the power bridge. With the reference voltage, the bridge voltage and the
+ * ADC offset of the board:
+ *   volts = (counts - offset) / 4095 * reference
+ *   watts = volts^2 / bridge
+ * The supply reading is the ADC counts of a 4.7k / 0.82k divider on a 3.3 V
+ * reference. SWR is (1 + p) / (1 - p), p = sqrt(reverse / forward).
+ *
+ * The time series combines the readings of each interval into one row: the
+ * readings, the PTT readings, the average and largest exciter, forward and
+ * reverse power, the largest SWR and the lowest and average supply voltage.
+ * Intervals without readings have no row.
+ *
+ * Files: <directory>/telem_<name>_SSS.csv or .jsonl (one JSON object a line)
+ *   SSS - File number of the series, a new format or directory starts a
+ *         new file.
+ *
+ */
+
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <wsutil/file_util.h>
+
+#include "openhpsdr_e_telemetry.h"
+
+// Power bridge of a board.
+typedef struct _telem_cal {
+    guint8   board_id;
+    gdouble  reference;     // ADC reference, V
+    gdouble  bridge;        // Bridge voltage, V^2 per W
+    guint16  offset;        // ADC counts at no power
+} telem_cal_t;
+
+// The calibrations of the common host programs. The first is used for an
+// unknown board.
+static const telem_cal_t telem_cals[] = {
+    { 0x01, 3.3, 0.095, 6 },     // Hermes (ANAN-10, 100)
+    { 0x02, 3.3, 0.095, 6 },     // Hermes (ANAN-10E, 100B)
+    { 0x03, 3.3, 0.095, 6 },     // Angelia (ANAN-100D)
+    { 0x04, 5.0, 0.108, 4 },     // Orion (ANAN-200D)
+    { 0x05, 5.0, 0.080, 18 },    // Orion Mk II (ANAN-8000DLE)
+    { 0x06, 3.3, 1.500, 6 },     // Hermes-Lite
+};
+
+// Supply voltage divider, 4.7k over 0.82k, on a 3.3 V reference
+#define TELEM_SUPPLY_SCALE (3.3 * ((4.7 + 0.82) / 0.82))
+
+struct _openhpsdr_e_telem_series {
+    gchar   *name;
+    FILE    *fp;            // NULL not open
+    gint     format;        // HPSDR_E_TELEM_* of the open file
+    gchar   *dir;           // Directory of the open file
+    guint    segment;       // File number
+    gboolean failed;        // Could not open, not tried again for this segment
+    // Row being combined
+    gboolean have_row;
+    gdouble  row_start;     // Capture time of the start of the interval
+    guint32  readings;
+    guint32  ptt;
+    gdouble  exciter_sum;
+    gdouble  exciter_max;
+    gdouble  forward_sum;
+    gdouble  forward_max;
+    gdouble  reverse_sum;
+    gdouble  reverse_max;
+    gdouble  swr_max;
+    gdouble  supply_sum;
+    gdouble  supply_min;
+};
+
+static GPtrArray *telem_series = NULL;
+
+static gdouble telem_watts(const telem_cal_t *cal, guint16 counts)
+{
+   gdouble volts = 0;
+
+   if ( counts <= cal->offset ) { return 0; }
+
+   volts = ( (gdouble)( counts - cal->offset ) / HPSDR_E_TELEM_ADC_MAX ) * cal->reference;
+   return ( volts * volts ) / cal->bridge;
+}
+
+void openhpsdr_e_telem_convert(guint8 board_id, guint16 exciter, guint16 forward, guint16 reverse,
+    guint16 supply, openhpsdr_e_telem_t *telem)
+{
+   const telem_cal_t *cal = &telem_cals[0];
+   gdouble rho = 0;
+   guint i = 0;
+
+   memset(telem, 0, sizeof(*telem));
+   telem->assumed = TRUE;
+
+   for ( i = 0; i < G_N_ELEMENTS(telem_cals); i++ ) {
+       if ( telem_cals[i].board_id == board_id ) {
+           cal = &telem_cals[i];
+           telem->assumed = FALSE;
+           break;
+       }
+   }
+
+   telem->board_id = cal->board_id;
+   telem->exciter = telem_watts(cal, exciter);
+   telem->forward = telem_watts(cal, forward);
+   telem->reverse = telem_watts(cal, reverse);
+   telem->supply = ( supply / HPSDR_E_TELEM_ADC_MAX ) * TELEM_SUPPLY_SCALE;
+
+   if ( telem->forward > 0 ) {
+       if ( telem->reverse >= telem->forward ) {
+           telem->swr = HPSDR_E_TELEM_SWR_MAX;
+       } else {
+           rho = sqrt(telem->reverse / telem->forward);
+           telem->swr = MIN(( 1.0 + rho ) / ( 1.0 - rho ), HPSDR_E_TELEM_SWR_MAX);
+       }
+   }
+}
+
+static void telem_close_file(openhpsdr_e_telem_series_t *series)
+{
+   if ( series->fp != NULL ) {
+       fclose(series->fp);
+       series->fp = NULL;
+       series->segment++;
+   }
+
+   g_free(series->dir);
+   series->dir = NULL;
+   series->failed = FALSE;
+}
+
+static void telem_open_file(openhpsdr_e_telem_series_t *series, const char *dir, gint format)
+{
+   gchar *path = NULL;
+
+   path = g_strdup_printf("%s%stelem_%s_%03u.%s", dir, G_DIR_SEPARATOR_S, series->name, series->segment,
+              ( format == HPSDR_E_TELEM_JSON ) ? "jsonl" : "csv");
+   series->fp = ws_fopen(path, "w");
+   g_free(path);
+
+   series->dir = g_strdup(dir);
+   series->format = format;
+
+   if ( series->fp == NULL ) {
+       series->failed = TRUE;
+       return;
+   }
+
+   if ( format == HPSDR_E_TELEM_CSV ) {
+       fprintf(series->fp, "time,readings,ptt,exciter_w,exciter_max_w,forward_w,forward_max_w,"
+           "reverse_w,reverse_max_w,swr_max,supply_min_v,supply_v\n");
+   }
+}
+
+// Write the combined row and start a new one.
+static void telem_write_row(openhpsdr_e_telem_series_t *series)
+{
+   gdouble n = 0;
+
+   if ( !series->have_row ) { return; }
+   series->have_row = FALSE;
+
+   if ( series->fp == NULL || series->readings == 0 ) { return; }
+
+   n = series->readings;
+   if ( series->format == HPSDR_E_TELEM_JSON ) {
+       fprintf(series->fp, "{\"time\":%.6f,\"readings\":%u,\"ptt\":%u,\"exciter_w\":%.3f,"
+           "\"exciter_max_w\":%.3f,\"forward_w\":%.3f,\"forward_max_w\":%.3f,\"reverse_w\":%.3f,"
+           "\"reverse_max_w\":%.3f,\"swr_max\":%.2f,\"supply_min_v\":%.2f,\"supply_v\":%.2f}\n",
+           series->row_start, series->readings, series->ptt, series->exciter_sum / n, series->exciter_max,
+           series->forward_sum / n, series->forward_max, series->reverse_sum / n, series->reverse_max,
+           series->swr_max, series->supply_min, series->supply_sum / n);
+   } else {
+       fprintf(series->fp, "%.6f,%u,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%.2f\n",
+           series->row_start, series->readings, series->ptt, series->exciter_sum / n, series->exciter_max,
+           series->forward_sum / n, series->forward_max, series->reverse_sum / n, series->reverse_max,
+           series->swr_max, series->supply_min, series->supply_sum / n);
+   }
+}
+
+openhpsdr_e_telem_series_t *openhpsdr_e_telem_new(const char *name)
+{
+   openhpsdr_e_telem_series_t *series = g_new0(openhpsdr_e_telem_series_t, 1);
+
+   if ( telem_series == NULL ) {
+       telem_series = g_ptr_array_new();
+   }
+
+   // Address separators are not wanted in a file name.
+   series->name = g_strdelimit(g_strdup(name), ":/\\", '-');
+   g_ptr_array_add(telem_series, series);
+
+   return series;
+}
+
+void openhpsdr_e_telem_add(openhpsdr_e_telem_series_t *series, const openhpsdr_e_telem_t *telem,
+    gboolean ptt, gdouble abs_time, const char *dir, gint format, guint interval_ms)
+{
+   gdouble interval = interval_ms / 1000.0;
+   gdouble row_start = abs_time;
+
+   if ( series == NULL || dir == NULL || dir[0] == '\0' || format == HPSDR_E_TELEM_NONE ) { return; }
+
+   if ( series->fp != NULL && ( format != series->format || strcmp(dir, series->dir) != 0 ) ) {
+       telem_write_row(series);
+       telem_close_file(series);
+   }
+   if ( series->fp == NULL ) {
+       if ( series->failed ) { return; }
+       telem_open_file(series, dir, format);
+       if ( series->fp == NULL ) { return; }
+   }
+
+   // Rows start on a multiple of the interval.
+   if ( interval > 0 ) {
+       row_start = floor(abs_time / interval) * interval;
+   }
+   if ( series->have_row && ( interval <= 0 || row_start != series->row_start ) ) {
+       telem_write_row(series);
+   }
+
+   if ( !series->have_row ) {
+       series->have_row = TRUE;
+       series->row_start = row_start;
+       series->readings = 0;
+       series->ptt = 0;
+       series->exciter_sum = 0;
+       series->exciter_max = 0;
+       series->forward_sum = 0;
+       series->forward_max = 0;
+       series->reverse_sum = 0;
+       series->reverse_max = 0;
+       series->swr_max = 0;
+       series->supply_sum = 0;
+       series->supply_min = telem->supply;
+   }
+
+   series->readings++;
+   if ( ptt ) { series->ptt++; }
+   series->exciter_sum += telem->exciter;
+   series->exciter_max = MAX(series->exciter_max, telem->exciter);
+   series->forward_sum += telem->forward;
+   series->forward_max = MAX(series->forward_max, telem->forward);
+   series->reverse_sum += telem->reverse;
+   series->reverse_max = MAX(series->reverse_max, telem->reverse);
+   series->swr_max = MAX(series->swr_max, telem->swr);
+   series->supply_sum += telem->supply;
+   series->supply_min = MIN(series->supply_min, telem->supply);
+}
+
+void openhpsdr_e_telem_close_all(void)
+{
+   openhpsdr_e_telem_series_t *series = NULL;
+   guint i = 0;
+
+   if ( telem_series != NULL ) {
+       for ( i = 0; i < telem_series->len; i++ ) {
+           series = (openhpsdr_e_telem_series_t *)g_ptr_array_index(telem_series, i);
+           telem_write_row(series);
+           telem_close_file(series);
+           g_free(series->name);
+           g_free(series);
+       }
+       g_ptr_array_free(telem_series, TRUE);
+       telem_series = NULL;
+   }
+}
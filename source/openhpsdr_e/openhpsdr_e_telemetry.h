@@ -0,0 +1,74 @@
+/* openhpsdr_e_telemetry.h
+ * Header file for the OpenHPSDR Ethernet High Priority Status telemetry
+ *
+ * This file is part of the OpenHPSDR-Ethernet (Protocol 2) Plug-in
+ * for Wireshark.
+ * By Matthew J. Wolf <matthew.wolf.hpsdr@speciosus.net>
+ * Copyright 2019 Matthew J. Wolf
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation,
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * The OpenHPSDR-Ethernet Plug-in for Wireshark is distributed in the hope that
+ * it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the OpenHPSDR-Ethernet Plug-in for Wireshark.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __OPENHPSDR_E_TELEMETRY_H__
+#define __OPENHPSDR_E_TELEMETRY_H__
+
+// TIME SERIES EXPORT FORMATS (PREFERENCE)
+#define HPSDR_E_TELEM_NONE      0 // NO EXPORT
+#define HPSDR_E_TELEM_CSV       1 // CSV, ONE ROW PER INTERVAL
+#define HPSDR_E_TELEM_JSON      2 // JSON LINES, ONE OBJECT PER INTERVAL
+
+// FULL SCALE OF THE 12 BIT POWER AND SUPPLY ADC READINGS
+#define HPSDR_E_TELEM_ADC_MAX   4095.0
+
+// SWR WHEN THE REVERSE POWER IS AT LEAST THE FORWARD POWER
+#define HPSDR_E_TELEM_SWR_MAX   99.9
+
+// Converted readings of one High Priority Status.
+typedef struct _openhpsdr_e_telem {
+    guint8   board_id;      // Calibration used, discovery board ID
+    gboolean assumed;       // Board not known, the Hermes calibration
+    gdouble  exciter;       // Exciter power 0, W
+    gdouble  forward;       // Alex 0 forward power, W
+    gdouble  reverse;       // Alex 0 reverse power, W
+    gdouble  swr;           // 0 without forward power
+    gdouble  supply;        // Supply voltage, V
+} openhpsdr_e_telem_t;
+
+// Time series of one radio.
+typedef struct _openhpsdr_e_telem_series openhpsdr_e_telem_series_t;
+
+// Convert the raw readings with the calibration of the discovery board_id.
+void openhpsdr_e_telem_convert(guint8 board_id, guint16 exciter, guint16 forward, guint16 reverse,
+    guint16 supply, openhpsdr_e_telem_t *telem);
+
+// New series. name is used for the file names (telem_<name>_SSS).
+openhpsdr_e_telem_series_t *openhpsdr_e_telem_new(const char *name);
+
+// Add the readings of one datagram. The readings of interval_ms are combined
+// into one row (0 writes every datagram), a row is written when a datagram
+// falls past it. A new format or directory starts a new file. dir: export
+// directory, NULL or empty for none.
+void openhpsdr_e_telem_add(openhpsdr_e_telem_series_t *series, const openhpsdr_e_telem_t *telem,
+    gboolean ptt, gdouble abs_time, const char *dir, gint format, guint interval_ms);
+
+// Write the last row of every series, close the files and free the series.
+// At the end of the capture file.
+void openhpsdr_e_telem_close_all(void);
+
+#endif /* __OPENHPSDR_E_TELEMETRY_H__ */
@@ -57,11 +57,18 @@
 #include <epan/packet.h>
 #include <epan/expert.h>
 #include <epan/prefs.h>
+#include <epan/proto_data.h>
+#include <epan/tap.h>
+#include <epan/stats_tree.h>
 
 #include <stdlib.h>
-//#include <string.h>
-//#include <math.h>
+#include <string.h>
+#include <math.h>
+#include "openhpsdr_e_spectrum.h"
+#include "openhpsdr_e_telemetry.h"
 #include "packet_openhpsdr_e.h"
+#include "openhpsdr_e_export.h"
+#include "openhpsdr_e_samples.h"
 
 
 //Port definitions in packet_openhpsd_er.h header
@@ -87,6 +94,7 @@
 
 // Protocol Variables
 static int proto_openhpsdr_e = -1;
+static int openhpsdr_e_tap = -1;
 
 // Subtree State Variables
 // - Using two letter abbreviations for protocol type.
@@ -107,18 +115,37 @@ static gint ett_openhpsdr_e_ddcc_ditram = -1;
 static gint ett_openhpsdr_e_ddcc_state = -1;
 static gint ett_openhpsdr_e_ddcc_config = -1;
 static gint ett_openhpsdr_e_ddcc_sync = -1;
+static gint ett_openhpsdr_e_ddcc_ditram_flags = -1;
+static gint ett_openhpsdr_e_ddcc_state_flags = -1;
+static gint ett_openhpsdr_e_ddcc_sync_flags = -1;
 static gint ett_openhpsdr_e_hps = -1;
+static gint ett_openhpsdr_e_hps_flags = -1;
 static gint ett_openhpsdr_e_ducc = -1;
 static gint ett_openhpsdr_e_micl = -1;
 static gint ett_openhpsdr_e_hpc = -1;
 static gint ett_openhpsdr_e_hpc_cwx0 = -1;
 static gint ett_openhpsdr_e_hpc_ddc_fp = -1;
 static gint ett_openhpsdr_e_hpc_alex0 = -1;
+static gint ett_openhpsdr_e_hpc_alex0_flags = -1;
+static gint ett_openhpsdr_e_hpc_flags = -1;
 static gint ett_openhpsdr_e_wbd = -1;
 static gint ett_openhpsdr_e_ddca = -1;
 static gint ett_openhpsdr_e_duciq = -1;
 static gint ett_openhpsdr_e_ddciq = -1;
 static gint ett_openhpsdr_e_mem = -1;
+static gint ett_openhpsdr_e_samples = -1;
+static gint ett_openhpsdr_e_seq = -1;
+static gint ett_openhpsdr_e_config = -1;
+static gint ett_openhpsdr_e_delta = -1;
+static gint ett_openhpsdr_e_ts = -1;
+static gint ett_openhpsdr_e_rate = -1;
+static gint ett_openhpsdr_e_budget = -1;
+static gint ett_openhpsdr_e_iq_stats = -1;
+static gint ett_openhpsdr_e_wb_spectrum = -1;
+static gint ett_openhpsdr_e_pacing = -1;
+static gint ett_openhpsdr_e_fifo = -1;
+static gint ett_openhpsdr_e_tx = -1;
+static gint ett_openhpsdr_e_cw = -1;
 
 // Fields
 // - Using two letter abbreviations for protocol type.
@@ -137,6 +164,140 @@ static gint ett_openhpsdr_e_mem = -1;
 
 static int hf_openhpsdr_e_reserved = -1;
 
+// Sample Block Summary (Compact Display)
+static int hf_openhpsdr_e_samples_summary = -1;
+static int hf_openhpsdr_e_samples_count = -1;
+static int hf_openhpsdr_e_samples_bits = -1;
+static int hf_openhpsdr_e_samples_min = -1;
+static int hf_openhpsdr_e_samples_max = -1;
+static int hf_openhpsdr_e_samples_rms = -1;
+
+// Sequence Analysis (Calculated)
+static int hf_openhpsdr_e_seq_analysis = -1;
+static int hf_openhpsdr_e_seq_first = -1;
+static int hf_openhpsdr_e_seq_expected = -1;
+static int hf_openhpsdr_e_seq_delta = -1;
+static int hf_openhpsdr_e_seq_lost = -1;
+static int hf_openhpsdr_e_seq_lost_total = -1;
+static int hf_openhpsdr_e_seq_duplicate = -1;
+static int hf_openhpsdr_e_seq_out_of_order = -1;
+static int hf_openhpsdr_e_seq_restart = -1;
+
+// Configuration in Effect (Calculated)
+static int hf_openhpsdr_e_config = -1;
+static int hf_openhpsdr_e_config_frame = -1;
+static int hf_openhpsdr_e_config_ddc_enabled = -1;
+static int hf_openhpsdr_e_config_adc = -1;
+static int hf_openhpsdr_e_config_rate = -1;
+static int hf_openhpsdr_e_config_sample_bits = -1;
+static int hf_openhpsdr_e_config_freq_phase = -1;
+static int hf_openhpsdr_e_config_alex = -1;
+static int hf_openhpsdr_e_config_att = -1;
+
+// Delta View (Calculated)
+static int hf_openhpsdr_e_delta = -1;
+static int hf_openhpsdr_e_delta_changed = -1;
+static int hf_openhpsdr_e_delta_prev_frame = -1;
+static int hf_openhpsdr_e_delta_same_since = -1;
+
+// DDC I&Q Timestamp Analysis (Calculated)
+static int hf_openhpsdr_e_ts = -1;
+static int hf_openhpsdr_e_ts_first = -1;
+static int hf_openhpsdr_e_ts_expected = -1;
+static int hf_openhpsdr_e_ts_delta = -1;
+static int hf_openhpsdr_e_ts_gap = -1;
+static int hf_openhpsdr_e_ts_overlap = -1;
+static int hf_openhpsdr_e_ts_reset = -1;
+static int hf_openhpsdr_e_ts_rate = -1;
+static int hf_openhpsdr_e_ts_drift = -1;
+
+// DDC I&Q Data Rate Analysis (Calculated)
+static int hf_openhpsdr_e_rate = -1;
+static int hf_openhpsdr_e_rate_expected = -1;
+static int hf_openhpsdr_e_rate_observed = -1;
+static int hf_openhpsdr_e_rate_window = -1;
+static int hf_openhpsdr_e_rate_datagrams = -1;
+static int hf_openhpsdr_e_rate_deviation = -1;
+
+// Bandwidth Budget (Calculated)
+static int hf_openhpsdr_e_budget = -1;
+static int hf_openhpsdr_e_budget_ddciq = -1;
+static int hf_openhpsdr_e_budget_wbd = -1;
+static int hf_openhpsdr_e_budget_micl = -1;
+static int hf_openhpsdr_e_budget_hw_to_host = -1;
+static int hf_openhpsdr_e_budget_duciq = -1;
+static int hf_openhpsdr_e_budget_ddca = -1;
+static int hf_openhpsdr_e_budget_host_to_hw = -1;
+static int hf_openhpsdr_e_budget_link = -1;
+static int hf_openhpsdr_e_budget_load = -1;
+
+// Inter-arrival Time (Calculated)
+static int hf_openhpsdr_e_iat = -1;
+static int hf_openhpsdr_e_iat_burst = -1;
+
+// I&Q Statistics (Calculated), indexed by HPSDR_E_IQSTATS_*
+static int hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_NUM] = { -1, -1, -1, -1, -1, -1 };
+static int hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_NUM] = { -1, -1, -1, -1, -1, -1 };
+
+// Wide Band Spectrum Analysis (Calculated)
+static int hf_openhpsdr_e_wb_spectrum = -1;
+static int hf_openhpsdr_e_wb_frame = -1;
+static int hf_openhpsdr_e_wb_fft_len = -1;
+static int hf_openhpsdr_e_wb_noise_floor = -1;
+static int hf_openhpsdr_e_wb_peak = -1;
+static int hf_openhpsdr_e_wb_clipped = -1;
+static int hf_openhpsdr_e_wb_overloads = -1;
+static int hf_openhpsdr_e_wb_averaged = -1;
+static int hf_openhpsdr_e_wb_spur_freq = -1;
+static int hf_openhpsdr_e_wb_spur_dbfs = -1;
+
+// Audio Pacing Analysis (Calculated)
+static int hf_openhpsdr_e_pacing = -1;
+static int hf_openhpsdr_e_pacing_lateness = -1;
+static int hf_openhpsdr_e_pacing_depth = -1;
+static int hf_openhpsdr_e_pacing_underrun = -1;
+static int hf_openhpsdr_e_pacing_overrun = -1;
+static int hf_openhpsdr_e_pacing_underruns = -1;
+static int hf_openhpsdr_e_pacing_overruns = -1;
+
+// DUC I&Q FIFO Model (Calculated)
+static int hf_openhpsdr_e_fifo = -1;
+static int hf_openhpsdr_e_fifo_rate = -1;
+static int hf_openhpsdr_e_fifo_interval = -1;
+static int hf_openhpsdr_e_fifo_expected = -1;
+static int hf_openhpsdr_e_fifo_fill = -1;
+static int hf_openhpsdr_e_fifo_fill_ms = -1;
+static int hf_openhpsdr_e_fifo_behind = -1;
+static int hf_openhpsdr_e_fifo_ahead = -1;
+static int hf_openhpsdr_e_fifo_underrun = -1;
+static int hf_openhpsdr_e_fifo_starved = -1;
+static int hf_openhpsdr_e_fifo_overflow = -1;
+static int hf_openhpsdr_e_fifo_underruns = -1;
+static int hf_openhpsdr_e_fifo_overflows = -1;
+
+// Transmit Latency (Calculated)
+static int hf_openhpsdr_e_tx = -1;
+static int hf_openhpsdr_e_tx_event = -1;
+static int hf_openhpsdr_e_tx_key_frame = -1;
+static int hf_openhpsdr_e_tx_ptt = -1;
+static int hf_openhpsdr_e_tx_duciq = -1;
+static int hf_openhpsdr_e_tx_rf = -1;
+
+// CW Keying (Calculated)
+static int hf_openhpsdr_e_cw = -1;
+static int hf_openhpsdr_e_cw_key = -1;
+static int hf_openhpsdr_e_cw_element = -1;
+static int hf_openhpsdr_e_cw_length = -1;
+static int hf_openhpsdr_e_cw_resolution = -1;
+static int hf_openhpsdr_e_cw_wpm = -1;
+static int hf_openhpsdr_e_cw_weight = -1;
+static int hf_openhpsdr_e_cw_expected = -1;
+static int hf_openhpsdr_e_cw_error = -1;
+static int hf_openhpsdr_e_cw_off_timing = -1;
+static int hf_openhpsdr_e_cw_jitter = -1;
+static int hf_openhpsdr_e_cw_key_frame = -1;
+static int hf_openhpsdr_e_cw_latency = -1;
+
 static int hf_openhpsdr_e_cr_banner = -1;
 static int hf_openhpsdr_e_cr_sequence_num = -1;
 static int hf_openhpsdr_e_cr_command = -1;
@@ -282,1145 +443,22 @@ static int hf_openhpsdr_e_ddcc_banner = -1;
 static int hf_openhpsdr_e_ddcc_sequence_num = -1;
 static int hf_openhpsdr_e_ddcc_adc_num = -1;
 static int hf_openhpsdr_e_ddcc_ditram_sub = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither0 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither1 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither2 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither3 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither4 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither5 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither6 = -1;
-static int hf_openhpsdr_e_ddcc_adc_dither7 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random0 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random1 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random2 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random3 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random4 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random5 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random6 = -1;
-static int hf_openhpsdr_e_ddcc_adc_random7 = -1;
+static int hf_openhpsdr_e_ddcc_adc_dither_flags = -1;
+static int hf_openhpsdr_e_ddcc_adc_random_flags = -1;
+static int hf_openhpsdr_e_ddcc_adc_dither[HPSDR_E_NUM_ADC];
+static int hf_openhpsdr_e_ddcc_adc_random[HPSDR_E_NUM_ADC];
 static int hf_openhpsdr_e_ddcc_state_sub = -1;
-static int hf_openhpsdr_e_ddcc_ddc0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc79 = -1;
+static int hf_openhpsdr_e_ddcc_ddc_state_flags[HPSDR_E_NUM_DDC / 8];
+static int hf_openhpsdr_e_ddcc_ddc[HPSDR_E_NUM_DDC];
 static int hf_openhpsdr_e_ddcc_config_sub = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_asign79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_rate79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic1_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_cic2_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_size79 = -1;
+static int hf_openhpsdr_e_ddcc_ddc_asign[HPSDR_E_NUM_DDC];
+static int hf_openhpsdr_e_ddcc_ddc_rate[HPSDR_E_NUM_DDC];
+static int hf_openhpsdr_e_ddcc_ddc_cic1[HPSDR_E_NUM_DDC];
+static int hf_openhpsdr_e_ddcc_ddc_cic2[HPSDR_E_NUM_DDC];
+static int hf_openhpsdr_e_ddcc_ddc_size[HPSDR_E_NUM_DDC];
 static int hf_openhpsdr_e_ddcc_sync_sub = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync0_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync1_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync2_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync3_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync4_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync5_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync6_79 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_0 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_1 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_2 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_3 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_4 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_5 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_6 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_7 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_8 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_9 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_10 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_11 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_12 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_13 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_14 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_15 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_16 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_17 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_18 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_19 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_20 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_21 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_22 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_23 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_24 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_25 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_26 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_27 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_28 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_29 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_30 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_31 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_32 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_33 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_34 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_35 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_36 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_37 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_38 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_39 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_40 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_41 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_42 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_43 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_44 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_45 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_46 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_47 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_48 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_49 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_50 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_51 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_52 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_53 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_54 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_55 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_56 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_57 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_58 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_59 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_60 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_61 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_62 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_63 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_64 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_65 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_66 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_67 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_68 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_69 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_70 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_71 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_72 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_73 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_74 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_75 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_76 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_77 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_78 = -1;
-static int hf_openhpsdr_e_ddcc_ddc_sync7_79 = -1;
+static int hf_openhpsdr_e_ddcc_ddc_sync_flags[HPSDR_E_NUM_DDC];
+static int hf_openhpsdr_e_ddcc_ddc_sync[HPSDR_E_NUM_SYNC_BITS][HPSDR_E_NUM_DDC];
 
 static int hf_openhpsdr_e_hps_banner = -1;
 static int hf_openhpsdr_e_hps_sequence_num = -1;
@@ -1435,14 +473,9 @@ static int hf_openhpsdr_e_hps_fifo_empty = -1;
 // Remove at some point ?
 // 3.7 - No longer supported
 static int hf_openhpsdr_e_hps_fifo_full = -1;
-static int hf_openhpsdr_e_hps_adc0_ol = -1;
-static int hf_openhpsdr_e_hps_adc1_ol = -1;
-static int hf_openhpsdr_e_hps_adc2_ol = -1;
-static int hf_openhpsdr_e_hps_adc3_ol = -1;
-static int hf_openhpsdr_e_hps_adc4_ol = -1;
-static int hf_openhpsdr_e_hps_adc5_ol = -1;
-static int hf_openhpsdr_e_hps_adc6_ol = -1;
-static int hf_openhpsdr_e_hps_adc7_ol = -1;
+static int hf_openhpsdr_e_hps_status_flags = -1;
+static int hf_openhpsdr_e_hps_adc_ol_flags = -1;
+static int hf_openhpsdr_e_hps_adc_ol[HPSDR_E_NUM_ADC];
 static int hf_openhpsdr_e_hps_ex_power0 = -1;
 static int hf_openhpsdr_e_hps_ex_power1 = -1;
 static int hf_openhpsdr_e_hps_ex_power2 = -1;
@@ -1456,6 +489,12 @@ static int hf_openhpsdr_e_hps_rp_alex1 = -1;
 static int hf_openhpsdr_e_hps_rp_alex2 = -1;
 static int hf_openhpsdr_e_hps_rp_alex3 = -1;
 static int hf_openhpsdr_e_hps_supp_vol = -1;
+static int hf_openhpsdr_e_hps_cal_board = -1;
+static int hf_openhpsdr_e_hps_ex_watts = -1;
+static int hf_openhpsdr_e_hps_fp_watts = -1;
+static int hf_openhpsdr_e_hps_rp_watts = -1;
+static int hf_openhpsdr_e_hps_swr = -1;
+static int hf_openhpsdr_e_hps_supply_volts = -1;
 static int hf_openhpsdr_e_hps_user_adc3 = -1;
 static int hf_openhpsdr_e_hps_user_adc2 = -1;
 static int hf_openhpsdr_e_hps_user_adc1 = -1;
@@ -1510,6 +549,7 @@ static int hf_openhpsdr_e_hpc_ptt0 = -1;
 static int hf_openhpsdr_e_hpc_ptt1 = -1;
 static int hf_openhpsdr_e_hpc_ptt2 = -1;
 static int hf_openhpsdr_e_hpc_ptt3 = -1;
+static int hf_openhpsdr_e_hpc_run_ptt_flags = -1;
 static int hf_openhpsdr_e_hpc_cwx0_sub =-1;
 static int hf_openhpsdr_e_hpc_cwx0_cwx = -1;
 static int hf_openhpsdr_e_hpc_cwx0_dot = -1;
@@ -1518,86 +558,7 @@ static int hf_openhpsdr_e_hpc_cwx1 = -1;
 static int hf_openhpsdr_e_hpc_cwx2 = -1;
 static int hf_openhpsdr_e_hpc_cwx3 = -1;
 static int hf_openhpsdr_e_hpc_ddc_fp_sub =-1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc0 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc1 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc2 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc3 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc4 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc5 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc6 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc7 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc8 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc9 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc10 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc11 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc12 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc13 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc14 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc15 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc16 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc17 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc18 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc19 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc20 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc21 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc22 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc23 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc24 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc25 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc26 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc27 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc28 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc29 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc30 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc31 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc32 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc33 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc34 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc35 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc36 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc37 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc38 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc39 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc40 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc41 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc42 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc43 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc44 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc45 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc46 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc47 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc48 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc49 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc50 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc51 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc52 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc53 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc54 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc55 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc56 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc57 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc58 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc59 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc60 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc61 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc62 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc63 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc64 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc65 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc66 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc67 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc68 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc69 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc70 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc71 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc72 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc73 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc74 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc75 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc76 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc77 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc78 = -1;
-static int hf_openhpsdr_e_hpc_freq_phase_ddc79 = -1;
+static int hf_openhpsdr_e_hpc_freq_phase_ddc[HPSDR_E_NUM_DDC];
 static int hf_openhpsdr_e_hpc_freq_phase_duc0 = -1;
 static int hf_openhpsdr_e_hpc_freq_phase_duc1 = -1;
 static int hf_openhpsdr_e_hpc_freq_phase_duc2 = -1;
@@ -1606,8 +567,10 @@ static int hf_openhpsdr_e_hpc_drive_duc0 = -1;
 static int hf_openhpsdr_e_hpc_drive_duc1 = -1;
 static int hf_openhpsdr_e_hpc_drive_duc2 = -1;
 static int hf_openhpsdr_e_hpc_drive_duc3 = -1;
+static int hf_openhpsdr_e_hpc_orion2_flags = -1;
 static int hf_openhpsdr_e_hpc_orion2_xvtr = -1;
 static int hf_openhpsdr_e_hpc_orion2_IO1 = -1;
+static int hf_openhpsdr_e_hpc_open_col_flags = -1;
 static int hf_openhpsdr_e_hpc_open_col1 = -1;
 static int hf_openhpsdr_e_hpc_open_col2 = -1;
 static int hf_openhpsdr_e_hpc_open_col3 = -1;
@@ -1615,10 +578,12 @@ static int hf_openhpsdr_e_hpc_open_col4 = -1;
 static int hf_openhpsdr_e_hpc_open_col5 = -1;
 static int hf_openhpsdr_e_hpc_open_col6 = -1;
 static int hf_openhpsdr_e_hpc_open_col7 = -1;
+static int hf_openhpsdr_e_hpc_db9_flags = -1;
 static int hf_openhpsdr_e_hpc_db9_out1 = -1;
 static int hf_openhpsdr_e_hpc_db9_out2 = -1;
 static int hf_openhpsdr_e_hpc_db9_out3 = -1;
 static int hf_openhpsdr_e_hpc_db9_out4 = -1;
+static int hf_openhpsdr_e_hpc_merc_att_flags = -1;
 static int hf_openhpsdr_e_hpc_merc_att1 = -1;
 static int hf_openhpsdr_e_hpc_merc_att2 = -1;
 static int hf_openhpsdr_e_hpc_merc_att3 = -1;
@@ -1631,6 +596,7 @@ static int hf_openhpsdr_e_hpc_alex3 = -1;
 static int hf_openhpsdr_e_hpc_alex2 = -1;
 static int hf_openhpsdr_e_hpc_alex1 = -1;
 static int hf_openhpsdr_e_hpc_alex0_sub = -1;
+static int hf_openhpsdr_e_hpc_alex0_flags[4] = { -1, -1, -1, -1 };
 static int hf_openhpsdr_e_hpc_alex0_lpf_17_15 = -1;
 static int hf_openhpsdr_e_hpc_alex0_lpf_12_10 = -1;
 static int hf_openhpsdr_e_hpc_alex0_6m_bypass = -1;
@@ -1660,14 +626,7 @@ static int hf_openhpsdr_e_hpc_alex0_6m_amp = -1;
 static int hf_openhpsdr_e_hpc_alex0_hpf_20 = -1;
 static int hf_openhpsdr_e_hpc_alex0_hpf_13 = -1;
 static int hf_openhpsdr_e_hpc_alex0_yel_led0 = -1;
-static int hf_openhpsdr_e_hpc_att7 = -1;
-static int hf_openhpsdr_e_hpc_att6 = -1;
-static int hf_openhpsdr_e_hpc_att5 = -1;
-static int hf_openhpsdr_e_hpc_att4 = -1;
-static int hf_openhpsdr_e_hpc_att3 = -1;
-static int hf_openhpsdr_e_hpc_att2 = -1;
-static int hf_openhpsdr_e_hpc_att1 = -1;
-static int hf_openhpsdr_e_hpc_att0 = -1;
+static int hf_openhpsdr_e_hpc_att[HPSDR_E_NUM_ADC];
 
 static int hf_openhpsdr_e_wbd_banner = -1;
 static int hf_openhpsdr_e_wbd_sequence_num = -1;
@@ -1719,27 +678,268 @@ static int hf_openhpsdr_e_mem_address = -1;
 static int hf_openhpsdr_e_mem_data = -1;
 
 // Expert Items
+// Flag byte bitmask tables
+// One table per flag byte, used with proto_tree_add_bitmask_with_flags(). The
+// bits are listed in the order they were shown before the tables were used.
+// The DDCC state and synchronization tables use the indexed field ids, so
+// they are filled in by openhpsdr_e_register_indexed_fields().
+static int * const openhpsdr_e_ddcc_dither_bits[] = {
+   &hf_openhpsdr_e_ddcc_adc_dither[0],
+   &hf_openhpsdr_e_ddcc_adc_dither[1],
+   &hf_openhpsdr_e_ddcc_adc_dither[2],
+   &hf_openhpsdr_e_ddcc_adc_dither[3],
+   &hf_openhpsdr_e_ddcc_adc_dither[4],
+   &hf_openhpsdr_e_ddcc_adc_dither[5],
+   &hf_openhpsdr_e_ddcc_adc_dither[6],
+   &hf_openhpsdr_e_ddcc_adc_dither[7],
+   NULL
+};
+static int * const openhpsdr_e_ddcc_random_bits[] = {
+   &hf_openhpsdr_e_ddcc_adc_random[0],
+   &hf_openhpsdr_e_ddcc_adc_random[1],
+   &hf_openhpsdr_e_ddcc_adc_random[2],
+   &hf_openhpsdr_e_ddcc_adc_random[3],
+   &hf_openhpsdr_e_ddcc_adc_random[4],
+   &hf_openhpsdr_e_ddcc_adc_random[5],
+   &hf_openhpsdr_e_ddcc_adc_random[6],
+   &hf_openhpsdr_e_ddcc_adc_random[7],
+   NULL
+};
+static int *openhpsdr_e_ddcc_state_bits[HPSDR_E_NUM_DDC / 8][9];
+static int *openhpsdr_e_ddcc_sync_bits[HPSDR_E_NUM_DDC][HPSDR_E_NUM_SYNC_BITS + 1];
+static int * const openhpsdr_e_hps_status_bits[] = {
+   &hf_openhpsdr_e_hps_ptt,
+   &hf_openhpsdr_e_hps_dot,
+   &hf_openhpsdr_e_hps_dash,
+   &hf_openhpsdr_e_hps_empty,
+   &hf_openhpsdr_e_hps_pll,
+   &hf_openhpsdr_e_hps_fifo_empty,
+   &hf_openhpsdr_e_hps_fifo_full,
+   NULL
+};
+static int * const openhpsdr_e_hps_adc_ol_bits[] = {
+   &hf_openhpsdr_e_hps_adc_ol[0],
+   &hf_openhpsdr_e_hps_adc_ol[1],
+   &hf_openhpsdr_e_hps_adc_ol[2],
+   &hf_openhpsdr_e_hps_adc_ol[3],
+   &hf_openhpsdr_e_hps_adc_ol[4],
+   &hf_openhpsdr_e_hps_adc_ol[5],
+   &hf_openhpsdr_e_hps_adc_ol[6],
+   &hf_openhpsdr_e_hps_adc_ol[7],
+   NULL
+};
+static int * const openhpsdr_e_hpc_run_ptt_bits[] = {
+   &hf_openhpsdr_e_hpc_run,
+   &hf_openhpsdr_e_hpc_ptt0,
+   &hf_openhpsdr_e_hpc_ptt1,
+   &hf_openhpsdr_e_hpc_ptt2,
+   &hf_openhpsdr_e_hpc_ptt3,
+   NULL
+};
+static int * const openhpsdr_e_hpc_cwx0_bits[] = {
+   &hf_openhpsdr_e_hpc_cwx0_cwx,
+   &hf_openhpsdr_e_hpc_cwx0_dot,
+   &hf_openhpsdr_e_hpc_cwx0_dash,
+   NULL
+};
+static int * const openhpsdr_e_hpc_orion2_bits[] = {
+   &hf_openhpsdr_e_hpc_orion2_xvtr,
+   &hf_openhpsdr_e_hpc_orion2_IO1,
+   NULL
+};
+static int * const openhpsdr_e_hpc_open_col_bits[] = {
+   &hf_openhpsdr_e_hpc_open_col1,
+   &hf_openhpsdr_e_hpc_open_col2,
+   &hf_openhpsdr_e_hpc_open_col3,
+   &hf_openhpsdr_e_hpc_open_col4,
+   &hf_openhpsdr_e_hpc_open_col5,
+   &hf_openhpsdr_e_hpc_open_col6,
+   &hf_openhpsdr_e_hpc_open_col7,
+   NULL
+};
+static int * const openhpsdr_e_hpc_db9_bits[] = {
+   &hf_openhpsdr_e_hpc_db9_out1,
+   &hf_openhpsdr_e_hpc_db9_out2,
+   &hf_openhpsdr_e_hpc_db9_out3,
+   &hf_openhpsdr_e_hpc_db9_out4,
+   NULL
+};
+static int * const openhpsdr_e_hpc_merc_att_bits[] = {
+   &hf_openhpsdr_e_hpc_merc_att1,
+   &hf_openhpsdr_e_hpc_merc_att2,
+   &hf_openhpsdr_e_hpc_merc_att3,
+   &hf_openhpsdr_e_hpc_merc_att4,
+   NULL
+};
+static int * const openhpsdr_e_hpc_alex0_bits0[] = {
+   &hf_openhpsdr_e_hpc_alex0_lpf_17_15,
+   &hf_openhpsdr_e_hpc_alex0_lpf_12_10,
+   &hf_openhpsdr_e_hpc_alex0_6m_bypass,
+   &hf_openhpsdr_e_hpc_alex0_red_led1,
+   &hf_openhpsdr_e_hpc_alex0_tx_rx,
+   &hf_openhpsdr_e_hpc_alex0_ant3,
+   &hf_openhpsdr_e_hpc_alex0_ant2,
+   &hf_openhpsdr_e_hpc_alex0_ant1,
+   NULL
+};
+static int * const openhpsdr_e_hpc_alex0_bits1[] = {
+   &hf_openhpsdr_e_hpc_alex0_lpf_160,
+   &hf_openhpsdr_e_hpc_alex0_lpf_80,
+   &hf_openhpsdr_e_hpc_alex0_lpf_60_40,
+   &hf_openhpsdr_e_hpc_alex0_lpf_30_20,
+   &hf_openhpsdr_e_hpc_alex0_yel_led1,
+   &hf_openhpsdr_e_hpc_alex0_orion2_txrx,
+   NULL
+};
+static int * const openhpsdr_e_hpc_alex0_bits2[] = {
+   &hf_openhpsdr_e_hpc_alex0_red_led0,
+   &hf_openhpsdr_e_hpc_alex0_att_10,
+   &hf_openhpsdr_e_hpc_alex0_att_20,
+   &hf_openhpsdr_e_hpc_alex0_hf_bypass,
+   &hf_openhpsdr_e_hpc_alex0_bypass,
+   &hf_openhpsdr_e_hpc_alex0_ext2,
+   &hf_openhpsdr_e_hpc_alex0_ext1,
+   &hf_openhpsdr_e_hpc_alex0_ddc_xvtr_in,
+   NULL
+};
+static int * const openhpsdr_e_hpc_alex0_bits3[] = {
+   &hf_openhpsdr_e_hpc_alex0_hpf_1_5,
+   &hf_openhpsdr_e_hpc_alex0_hpf_6_5,
+   &hf_openhpsdr_e_hpc_alex0_hpf_9_5,
+   &hf_openhpsdr_e_hpc_alex0_6m_amp,
+   &hf_openhpsdr_e_hpc_alex0_hpf_20,
+   &hf_openhpsdr_e_hpc_alex0_hpf_13,
+   &hf_openhpsdr_e_hpc_alex0_yel_led0,
+   NULL
+};
+static int * const *openhpsdr_e_hpc_alex0_bits[4] = {
+   openhpsdr_e_hpc_alex0_bits0,
+   openhpsdr_e_hpc_alex0_bits1,
+   openhpsdr_e_hpc_alex0_bits2,
+   openhpsdr_e_hpc_alex0_bits3
+};
+
 static expert_field ei_cr_extra_length = EI_INIT;
 static expert_field ei_ddciq_larger_then_mtu = EI_INIT;
+static expert_field ei_seq_lost = EI_INIT;
+static expert_field ei_seq_duplicate = EI_INIT;
+static expert_field ei_seq_out_of_order = EI_INIT;
+static expert_field ei_seq_restart = EI_INIT;
+static expert_field ei_ts_gap = EI_INIT;
+static expert_field ei_ts_overlap = EI_INIT;
+static expert_field ei_ts_reset = EI_INIT;
+static expert_field ei_rate_deviation = EI_INIT;
+static expert_field ei_budget_over = EI_INIT;
+static expert_field ei_wb_overload = EI_INIT;
+static expert_field ei_pacing_underrun = EI_INIT;
+static expert_field ei_pacing_overrun = EI_INIT;
+static expert_field ei_fifo_underrun = EI_INIT;
+static expert_field ei_fifo_overflow = EI_INIT;
+static expert_field ei_cw_timing = EI_INIT;
+static expert_field ei_cw_jitter = EI_INIT;
 
 // Preferences
 static gboolean openhpsdr_e_strict_size = TRUE;
 static gboolean openhpsdr_e_strict_pad = TRUE;
 static gboolean openhpsdr_e_ddciq_mtu_check = TRUE;
+static gint openhpsdr_e_sample_display = HPSDR_E_SAMPLES_FULL;
+static guint openhpsdr_e_sample_max_items = 16;
+static gboolean openhpsdr_e_delta_view = FALSE;
+static guint openhpsdr_e_rate_tolerance = 5;
+static guint openhpsdr_e_link_speed = 1000;
+static guint openhpsdr_e_mtu = 1500;
+static gint openhpsdr_e_export_format = HPSDR_E_EXPORT_NONE;
+static const char *openhpsdr_e_export_dir = NULL;
+static gint openhpsdr_e_export_gaps = HPSDR_E_EXPORT_GAPS_ZERO;
+static gboolean openhpsdr_e_wb_spectrum = TRUE;
+static const char *openhpsdr_e_wb_spectrum_dir = NULL;
+static gboolean openhpsdr_e_audio_wav = FALSE;
+static guint openhpsdr_e_pacing_buffer = 20;
+static guint openhpsdr_e_duc_fifo = 4096;
+static gint openhpsdr_e_telem_format = HPSDR_E_TELEM_NONE;
+static guint openhpsdr_e_telem_interval = 1000;
+
+static const enum_val_t sample_display_vals[] = {
+    { "full",    "Full - Every sample",             HPSDR_E_SAMPLES_FULL },
+    { "compact", "Compact - Summary and first samples", HPSDR_E_SAMPLES_COMPACT },
+    { NULL, NULL, 0 }
+};
+
+static const enum_val_t export_format_vals[] = {
+    { "none",  "None - No export",                  HPSDR_E_EXPORT_NONE },
+    { "f32",   "Raw - Interleaved float32",         HPSDR_E_EXPORT_RAW_F32 },
+    { "i16",   "Raw - Interleaved int16",           HPSDR_E_EXPORT_RAW_I16 },
+    { "wav",   "WAV - 16 bit, I left, Q right",     HPSDR_E_EXPORT_WAV },
+    { "sigmf", "SigMF - cf32_le and metadata",      HPSDR_E_EXPORT_SIGMF },
+    { NULL, NULL, 0 }
+};
+
+static const enum_val_t telem_format_vals[] = {
+    { "none",  "None - No export",                  HPSDR_E_TELEM_NONE },
+    { "csv",   "CSV - One row per interval",        HPSDR_E_TELEM_CSV },
+    { "json",  "JSON Lines - One object per interval", HPSDR_E_TELEM_JSON },
+    { NULL, NULL, 0 }
+};
+
+static const enum_val_t export_gaps_vals[] = {
+    { "zero", "Zero fill",                          HPSDR_E_EXPORT_GAPS_ZERO },
+    { "skip", "Leave out (SigMF annotation only)",  HPSDR_E_EXPORT_GAPS_SKIP },
+    { NULL, NULL, 0 }
+};
 
 //Tracking Variables
-static guint16 openhpsdr_e_cr_ddcc_port = -1;
-static guint16 openhpsdr_e_cr_hps_port = -1;
-static guint16 openhpsdr_e_cr_ducc_port = -1;
-static guint16 openhpsdr_e_cr_micl_port = -1;
-static guint16 openhpsdr_e_cr_hpc_port = -1;
-static guint16 openhpsdr_e_cr_wbd_base_port = -1;
-static guint16 openhpsdr_e_cr_ddca_port = -1;
-static guint16 openhpsdr_e_cr_duciq_base_port = -1;
-static guint16 openhpsdr_e_cr_ddciq_base_port = -1;
-static guint16 openhpsdr_e_cr_mem_host_port = -1;
-static guint16 openhpsdr_e_cr_mem_hw_port = -1;
-static guint8  board_id = -1;
+// Default ports only port map and its port lookup tables. Built once in
+// proto_reg_handoff_openhpsdr_e(). Used for a host and radio pair without
+// a Command Reply (CR) General datagram.
+static guint8 openhpsdr_e_default_dest_port_type[HPSDR_E_NUM_UDP_PORTS];
+static guint8 openhpsdr_e_default_src_port_type[HPSDR_E_NUM_UDP_PORTS];
+static openhpsdr_e_port_map_t openhpsdr_e_default_ports = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    openhpsdr_e_default_dest_port_type, openhpsdr_e_default_src_port_type
+};
+
+// Host and radio pairs, openhpsdr_e_radio_key_t to openhpsdr_e_radio_t.
+// Created for every capture file in openhpsdr_e_init().
+static wmem_map_t *openhpsdr_e_radios = NULL;
+
+// Radios with their own port map (non-default ports in a CR General
+// datagram). While 0 the heuristic never looks a radio up.
+static guint openhpsdr_e_port_maps = 0;
+
+// Sequence analysis streams, openhpsdr_e_stream_key_t to openhpsdr_e_stream_t.
+// Created for every capture file in openhpsdr_e_init().
+static wmem_map_t *openhpsdr_e_streams = NULL;
+
+// Datagram type names of the stats tree.
+static const value_string openhpsdr_e_dg_type_vals[] = {
+    { HPSDR_E_DG_CR,    "Command Reply" },
+    { HPSDR_E_DG_DDCC,  "DDC Command" },
+    { HPSDR_E_DG_HPS,   "High Priority Status" },
+    { HPSDR_E_DG_DUCC,  "DUC Command" },
+    { HPSDR_E_DG_MICL,  "Mic / Line Samples" },
+    { HPSDR_E_DG_HPC,   "High Priority Command" },
+    { HPSDR_E_DG_WBD,   "Wide Band Data" },
+    { HPSDR_E_DG_DDCA,  "DDC Audio" },
+    { HPSDR_E_DG_DUCIQ, "DUC I&Q" },
+    { HPSDR_E_DG_DDCIQ, "DDC I&Q" },
+    { HPSDR_E_DG_MEM,   "Memory Mapped" },
+    {0, NULL}
+};
+
+// Stats trees "hpsdr-e,streams" and "hpsdr-e,iat"
+static const gchar *st_str_streams = "openHPSDR Streams";
+static int st_node_streams = -1;
+static const gchar *st_str_iat = "openHPSDR Inter-arrival Time (uS)";
+static int st_node_iat = -1;
+static const gchar *st_str_pacing = "openHPSDR Pacing";
+static int st_node_pacing = -1;
+static const gchar *st_str_tx = "openHPSDR Transmit Latency (uS)";
+static int st_node_tx = -1;
+static const gchar *st_str_cw = "openHPSDR CW Keying (uS)";
+static int st_node_cw = -1;
+// Stream state of each open stats tree:
+// stats_tree to (stream node id to openhpsdr_e_st_stream_t).
+static GHashTable *openhpsdr_e_st_data = NULL;
 
 static const value_string cr_disc_board_id[] = {
     { 0x00, "Atlas" },
@@ -1772,6 +972,16 @@ static const value_string cr_gen_10mhz[] = {
     {0, NULL}
 };
 
+static const value_string cw_elements[] = {
+    { HPSDR_E_CW_NONE,  "First Edge" },
+    { HPSDR_E_CW_DOT,   "Dot" },
+    { HPSDR_E_CW_DASH,  "Dash" },
+    { HPSDR_E_CW_MARK,  "Mark" },
+    { HPSDR_E_CW_SPACE, "Element Space" },
+    { HPSDR_E_CW_GAP,   "Character Space" },
+    {0, NULL}
+};
+
 static const value_string codec_audio_channels[] = {
     { 0x00, "NO - Not Supported" },
     { 0x01, "Mono" },
@@ -1831,6 +1041,115 @@ const true_false_string local_supported_notsupported = { "Supported", "Not Suppo
 const true_false_string local_phase_frequency = { "Phase Word", "Frequency" };
 const true_false_string local_variable_fixed = { "Variable", "Fixed" };
 
+// Fill one runtime built field entry. The name and abbrev strings are
+// allocated by the caller and live as long as the field registration.
+static void openhpsdr_e_set_hf(hf_register_info *hf_entry, int *p_id, char *name, char *abbrev,
+   enum ftenum type, int display, const void *strings, guint64 bitmask)
+{
+   static const hf_register_info hf_empty = {
+       NULL, { NULL, NULL, FT_NONE, BASE_NONE, NULL, ZERO_MASK, NULL, HFILL }
+   };
+
+   *hf_entry = hf_empty;
+   *p_id = -1;
+   hf_entry->p_id = p_id;
+   hf_entry->hfinfo.name = name;
+   hf_entry->hfinfo.abbrev = abbrev;
+   hf_entry->hfinfo.type = type;
+   hf_entry->hfinfo.display = display;
+   hf_entry->hfinfo.strings = strings;
+   hf_entry->hfinfo.bitmask = bitmask;
+}
+
+// The per DDC and per ADC fields only differ by their index, so they are
+// registered from loops. The names and abbreviations are the same as the
+// hand written entries they replace, display filters are not changed.
+static void openhpsdr_e_register_indexed_fields(void)
+{
+   hf_register_info *hf_indexed = NULL;
+   int num_fields = (HPSDR_E_NUM_ADC * 4) + (HPSDR_E_NUM_DDC * 8) +
+       (HPSDR_E_NUM_DDC * HPSDR_E_NUM_SYNC_BITS) + (HPSDR_E_NUM_DDC / 8);
+   int n = 0;
+   int i = -1;
+   int bit = -1;
+
+   // Kept for the life of the program, as Wireshark keeps pointers into it.
+   hf_indexed = g_new0(hf_register_info, num_fields);
+
+   for (i=0;i<HPSDR_E_NUM_ADC;i++) {
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_adc_dither[i],
+           g_strdup_printf("ADC %d Dither", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.adc-dither-%d", i),
+           FT_BOOLEAN, BOOLEAN_MASK, TFS(&local_enabled_disabled), 1 << i);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_adc_random[i],
+           g_strdup_printf("ADC %d Random", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.adc-random-%d", i),
+           FT_BOOLEAN, BOOLEAN_MASK, TFS(&local_enabled_disabled), 1 << i);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_hps_adc_ol[i],
+           g_strdup_printf("ADC %d Overload", i),
+           g_strdup_printf("openhpsdr-e.hps.adc%d-ol", i),
+           FT_BOOLEAN, BOOLEAN_MASK, TFS(&local_set_notset), 1 << i);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_hpc_att[i],
+           g_strdup_printf("Step Atten. %d", i),
+           g_strdup_printf("openhpsdr-e.hpc.att%d", i),
+           FT_UINT8, BASE_DEC, NULL, ZERO_MASK);
+   }
+
+   for (i=0;i<HPSDR_E_NUM_DDC / 8;i++) {
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_state_flags[i],
+           g_strdup_printf("DDC %d-%d State", i * 8, (i * 8) + 7),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-state-%d", i),
+           FT_UINT8, BASE_HEX, NULL, ZERO_MASK);
+   }
+
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc[i],
+           g_strdup_printf("DDC %2d", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-%d", i),
+           FT_BOOLEAN, BOOLEAN_MASK, TFS(&local_enabled_disabled), 1 << (i % 8));
+       openhpsdr_e_ddcc_state_bits[i / 8][i % 8] = &hf_openhpsdr_e_ddcc_ddc[i];
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_sync_flags[i],
+           g_strdup_printf("DDC %d Synchronization", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-sync-%d", i),
+           FT_UINT8, BASE_HEX, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_asign[i],
+           g_strdup_printf("DDC %2d  ADC Assignment", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-asign-%d", i),
+           FT_UINT8, BASE_DEC, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_rate[i],
+           g_strdup_printf("DDC %2d     Sample Rate", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-rate-%d", i),
+           FT_UINT16, BASE_DEC, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_cic1[i],
+           g_strdup_printf("DDC %2d       CIC1 Rate", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-cic1-%d", i),
+           FT_UINT8, BASE_DEC, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_cic2[i],
+           g_strdup_printf("DDC %2d       CIC2 Rate", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-cic2-%d", i),
+           FT_UINT8, BASE_DEC, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_size[i],
+           g_strdup_printf("DDC %2d I&Q Sample Size", i),
+           g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-size-%d", i),
+           FT_UINT8, BASE_DEC, NULL, ZERO_MASK);
+       openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_hpc_freq_phase_ddc[i],
+           g_strdup_printf("DDC %2d Frequency / Phase Word", i),
+           g_strdup_printf("openhpsdr-e.hpc.freq-phase-ddc%d", i),
+           FT_UINT32, BASE_DEC, NULL, ZERO_MASK);
+
+       for (bit=0;bit<HPSDR_E_NUM_SYNC_BITS;bit++) {
+           openhpsdr_e_set_hf(&hf_indexed[n++], &hf_openhpsdr_e_ddcc_ddc_sync[bit][i],
+               g_strdup_printf("DDC %d Synchronized With DDC %d", i, bit),
+               g_strdup_printf("openhpsdr-e.cr.ddcc.ddc-sync%d-%d", bit, i),
+               FT_BOOLEAN, BOOLEAN_MASK, TFS(&local_on_off), 1 << bit);
+           openhpsdr_e_ddcc_sync_bits[i][bit] = &hf_openhpsdr_e_ddcc_ddc_sync[bit][i];
+       }
+   }
+
+   DISSECTOR_ASSERT(n == num_fields);
+   proto_register_field_array(proto_openhpsdr_e, hf_indexed, num_fields);
+}
+
 // Using two letter abbreviations for protocol type.
 // cr - Command Reply (port 1024)
 // ddcc - DDC Command (Host to Hardware - dest port 1025)
@@ -1854,18 +1173,37 @@ void proto_register_openhpsdr_e(void)
         &ett_openhpsdr_e_ddcc_state,
         &ett_openhpsdr_e_ddcc_config,
         &ett_openhpsdr_e_ddcc_sync,
+        &ett_openhpsdr_e_ddcc_ditram_flags,
+        &ett_openhpsdr_e_ddcc_state_flags,
+        &ett_openhpsdr_e_ddcc_sync_flags,
         &ett_openhpsdr_e_hps,
+        &ett_openhpsdr_e_hps_flags,
         &ett_openhpsdr_e_ducc,
         &ett_openhpsdr_e_micl,
         &ett_openhpsdr_e_hpc,
         &ett_openhpsdr_e_hpc_cwx0,
         &ett_openhpsdr_e_hpc_ddc_fp,
         &ett_openhpsdr_e_hpc_alex0,
+        &ett_openhpsdr_e_hpc_alex0_flags,
+        &ett_openhpsdr_e_hpc_flags,
         &ett_openhpsdr_e_wbd,
         &ett_openhpsdr_e_ddca,
         &ett_openhpsdr_e_duciq,
         &ett_openhpsdr_e_ddciq,
-        &ett_openhpsdr_e_mem
+        &ett_openhpsdr_e_mem,
+        &ett_openhpsdr_e_samples,
+        &ett_openhpsdr_e_seq,
+        &ett_openhpsdr_e_config,
+        &ett_openhpsdr_e_delta,
+        &ett_openhpsdr_e_ts,
+        &ett_openhpsdr_e_rate,
+        &ett_openhpsdr_e_budget,
+        &ett_openhpsdr_e_iq_stats,
+        &ett_openhpsdr_e_wb_spectrum,
+        &ett_openhpsdr_e_pacing,
+        &ett_openhpsdr_e_fifo,
+        &ett_openhpsdr_e_tx,
+        &ett_openhpsdr_e_cw
    };
 
    // Protocol expert items
@@ -1878,6 +1216,70 @@ void proto_register_openhpsdr_e(void)
            { "openhpsdr-e.ei.ddciq.larger-then-mtu", PI_MALFORMED, PI_WARN,
              "Larger then maximum MTU", EXPFILL }
        },
+       { &ei_seq_lost,
+           { "openhpsdr-e.ei.seq.lost", PI_SEQUENCE, PI_WARN,
+             "Lost datagrams", EXPFILL }
+       },
+       { &ei_seq_duplicate,
+           { "openhpsdr-e.ei.seq.duplicate", PI_SEQUENCE, PI_WARN,
+             "Duplicate sequence number", EXPFILL }
+       },
+       { &ei_seq_out_of_order,
+           { "openhpsdr-e.ei.seq.out-of-order", PI_SEQUENCE, PI_WARN,
+             "Out of order datagram", EXPFILL }
+       },
+       { &ei_seq_restart,
+           { "openhpsdr-e.ei.seq.restart", PI_SEQUENCE, PI_NOTE,
+             "Sequence number restarted at zero", EXPFILL }
+       },
+       { &ei_ts_gap,
+           { "openhpsdr-e.ei.ts.gap", PI_SEQUENCE, PI_WARN,
+             "DDC I&Q timestamp gap", EXPFILL }
+       },
+       { &ei_ts_overlap,
+           { "openhpsdr-e.ei.ts.overlap", PI_SEQUENCE, PI_WARN,
+             "DDC I&Q timestamp overlap", EXPFILL }
+       },
+       { &ei_ts_reset,
+           { "openhpsdr-e.ei.ts.reset", PI_SEQUENCE, PI_NOTE,
+             "DDC I&Q timestamp reset", EXPFILL }
+       },
+       { &ei_rate_deviation,
+           { "openhpsdr-e.ei.rate.deviation", PI_SEQUENCE, PI_WARN,
+             "DDC I&Q data rate differs from the DDC Command sample rate", EXPFILL }
+       },
+       { &ei_budget_over,
+           { "openhpsdr-e.ei.budget.over", PI_PROTOCOL, PI_WARN,
+             "Configuration needs more bandwidth than the link speed", EXPFILL }
+       },
+       { &ei_wb_overload,
+           { "openhpsdr-e.ei.wb.overload", PI_PROTOCOL, PI_WARN,
+             "ADC overload, clipped samples in the wide band spectrum frame", EXPFILL }
+       },
+       { &ei_pacing_underrun,
+           { "openhpsdr-e.ei.pacing.underrun", PI_SEQUENCE, PI_WARN,
+             "Audio datagram later than the jitter buffer, under-run", EXPFILL }
+       },
+       { &ei_pacing_overrun,
+           { "openhpsdr-e.ei.pacing.overrun", PI_SEQUENCE, PI_NOTE,
+             "Audio datagram earlier than the jitter buffer can hold, over-run", EXPFILL }
+       },
+       { &ei_fifo_underrun,
+           { "openhpsdr-e.ei.fifo.underrun", PI_SEQUENCE, PI_WARN,
+             "Likely DUC FIFO under-run, the host fell behind the DUC sample rate", EXPFILL }
+       },
+       { &ei_fifo_overflow,
+           { "openhpsdr-e.ei.fifo.overflow", PI_SEQUENCE, PI_NOTE,
+             "DUC FIFO overflow, the host burst ahead of the DUC sample rate", EXPFILL }
+       },
+       { &ei_cw_timing,
+           { "openhpsdr-e.ei.cw.timing", PI_SEQUENCE, PI_NOTE,
+             "CW element length off the keyer speed and weight", EXPFILL }
+       },
+       { &ei_cw_jitter,
+           { "openhpsdr-e.ei.cw.jitter", PI_SEQUENCE, PI_NOTE,
+             "CW key edge resolution coarse, datagram spacing above a quarter dot", EXPFILL }
+       },
 
    };
 
@@ -1892,9908 +1294,6174 @@ void proto_register_openhpsdr_e(void)
     };
 
 
-    // Command Reply Field Arrary
-    static hf_register_info hf_cr[] = {
-       { &hf_openhpsdr_e_cr_banner,
-           { "openHPSDR Ethernet - Command Reply" , "openhpsdr-e.cr.banner",
-            FT_STRING , BASE_NONE,
+    // Sample Block Summary Field Arrary
+    static hf_register_info hf_samples[] = {
+       { &hf_openhpsdr_e_samples_summary,
+           { "Sample Block Summary", "openhpsdr-e.samples",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_sequence_num,
-           { "Sequence Number", "openhpsdr-e.cr.squence-num",
-            FT_UINT32, BASE_DEC,
+       { &hf_openhpsdr_e_samples_count,
+           { "Number of Samples", "openhpsdr-e.samples.count",
+            FT_UINT16, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_command,
-           { "Command", "openhpsdr-e.cr.command",
-            FT_UINT8, BASE_HEX,
+       { &hf_openhpsdr_e_samples_bits,
+           { "Bits Per Sample", "openhpsdr-e.samples.bits",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_ei,
-           { "CR Expert" , "openhpsdr-e.cr.ei",
-            FT_STRING , BASE_NONE,
+       { &hf_openhpsdr_e_samples_min,
+           { "Minimum Sample Value", "openhpsdr-e.samples.min",
+            FT_INT32, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_pad,
-           { "Zero Pad" , "openhpsdr-e.cr.zero",
-            FT_STRING , BASE_NONE,
+       { &hf_openhpsdr_e_samples_max,
+           { "Maximum Sample Value", "openhpsdr-e.samples.max",
+            FT_INT32, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_desc,
-           { "DC Description" , "openhpsdr-e.cr.desc",
-            FT_STRING , BASE_NONE,
+       { &hf_openhpsdr_e_samples_rms,
+           { "RMS Sample Value", "openhpsdr-e.samples.rms",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_mac,
-           { "Board MAC Address " , "openhpsdr-e.cr.discovery.mac",
-            FT_ETHER, BASE_NONE,
+    };
+
+    // Sequence Analysis Field Arrary
+    static hf_register_info hf_seq[] = {
+       { &hf_openhpsdr_e_seq_analysis,
+           { "Sequence Analysis", "openhpsdr-e.seq",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
-            "Hardware Address", HFILL }
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_board,
-           { "Board Type        ", "openhpsdr-e.cr.discovery.board",
-            FT_UINT8, BASE_DEC,
-            VALS(cr_disc_board_id), ZERO_MASK,
+       { &hf_openhpsdr_e_seq_first,
+           { "First Datagram of Stream", "openhpsdr-e.seq.first",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_proto_ver,
-           { "Supported Potocol Version", "openhpsdr-e.cr.discovery.proto-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_seq_expected,
+           { "Expected Sequence Number", "openhpsdr-e.seq.expected",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_fw_ver,
-           { "Firmware Version", "openhpsdr-e.cr.discovery.fw-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_seq_delta,
+           { "Sequence Delta", "openhpsdr-e.seq.delta",
+            FT_INT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Sequence number minus the highest previous sequence number of the stream", HFILL }
+       },
+       { &hf_openhpsdr_e_seq_lost,
+           { "Lost Datagrams", "openhpsdr-e.seq.lost",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Datagrams lost before this datagram", HFILL }
+       },
+       { &hf_openhpsdr_e_seq_lost_total,
+           { "Lost Datagrams in Stream", "openhpsdr-e.seq.lost-total",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Datagrams lost in the stream up to this datagram", HFILL }
+       },
+       { &hf_openhpsdr_e_seq_duplicate,
+           { "Duplicate", "openhpsdr-e.seq.duplicate",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_merc0_ver,
-           { "Mercury0 Version", "openhpsdr-e.cr.discovery.merc0-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_seq_out_of_order,
+           { "Out of Order", "openhpsdr-e.seq.out-of-order",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_merc1_ver,
-           { "Mercury1 Version", "openhpsdr-e.cr.discovery.merc1-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_seq_restart,
+           { "Sequence Restart", "openhpsdr-e.seq.restart",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_merc2_ver,
-           { "Mercury2 Version", "openhpsdr-e.cr.discovery.merc2-ver",
-            FT_UINT8, BASE_DEC,
+    };
+
+    // Configuration in Effect Field Array
+    static hf_register_info hf_config[] = {
+       { &hf_openhpsdr_e_config,
+           { "Configuration in Effect", "openhpsdr-e.config",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_merc3_ver,
-           { "Mercury3 Version", "openhpsdr-e.cr.discovery.merc3-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_config_frame,
+           { "Changed in Frame", "openhpsdr-e.config.frame",
+            FT_FRAMENUM, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_penny_ver,
-           { "Penny   Version ", "openhpsdr-e.cr.discovery.penny-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_config_ddc_enabled,
+           { "DDC Enabled", "openhpsdr-e.config.ddc-enabled",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_metis_ver,
-           { "Metis   Version ", "openhpsdr-e.cr.discovery.metis-ver",
+       { &hf_openhpsdr_e_config_adc,
+           { "ADC Assignment", "openhpsdr-e.config.adc",
             FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_ddc_num,
-           { "Number of DDC Implemented", "openhpsdr-e.cr.discovery.metis-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_config_rate,
+           { "Sample Rate", "openhpsdr-e.config.rate",
+            FT_UINT16, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_freq_phase,
-           { "Frequency or Phase Word" , "openhpsdr-e.cr.discovery.freq-phase",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&phase_freq), BOOLEAN_B0,
+       { &hf_openhpsdr_e_config_sample_bits,
+           { "I&Q Sample Size", "openhpsdr-e.config.sample-bits",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_big_endian,
-           {"             Big-Endian", "openhpsdr-e.cr.discovery.big-endian",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_config_freq_phase,
+           { "Frequency / Phase Word", "openhpsdr-e.config.freq-phase",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_little_endian,
-           {"          Little-Endian", "openhpsdr-e.cr.discovery.little-endian",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B1,
+       { &hf_openhpsdr_e_config_alex,
+           { "Alex Word", "openhpsdr-e.config.alex",
+            FT_UINT32, BASE_HEX,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_three_byte_ddciq,
-           {"     3 Byte DDC IQ Data", "openhpsdr-e.cr.discovery.3-byte-dcciq",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B2,
+       { &hf_openhpsdr_e_config_att,
+           { "Step Atten.", "openhpsdr-e.config.att",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_float_ddciq,
-           {"      Float DDC IQ Data", "openhpsdr-e.cr.discovery.float-dcciq",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B3,
+    };
+
+
+    // Delta View Field Array
+    static hf_register_info hf_delta[] = {
+       { &hf_openhpsdr_e_delta,
+           { "Delta View", "openhpsdr-e.delta",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_double_ddciq,
-           {"     Double DDC IQ Data", "openhpsdr-e.cr.discovery.double-dcciq",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B4,
+       { &hf_openhpsdr_e_delta_changed,
+           { "Changed", "openhpsdr-e.delta.changed",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_beta_ver,
-           { "Beta Version", "openhpsdr-e.cr.discovery.beta-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_delta_prev_frame,
+           { "Previous Command", "openhpsdr-e.delta.prev-frame",
+            FT_FRAMENUM, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_hpsdr_fw,
-           { "OpenHPSDR Firmware Update", "openhpsdr-e.cr.discovery.full-hw.fw",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_delta_same_since,
+           { "Unchanged Since Frame", "openhpsdr-e.delta.unchanged-since",
+            FT_FRAMENUM, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_udp_ports,
-           { "    Non-Default UDP Ports", "openhpsdr-e.cr.discovery.full-hw.udp-ports",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+    };
+
+
+    // DDC I&Q Timestamp Analysis Field Array
+    static hf_register_info hf_ts[] = {
+       { &hf_openhpsdr_e_ts,
+           { "Timestamp Analysis", "openhpsdr-e.ts",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_fixed_ip,
-           { "         Fixed IP Address", "openhpsdr-e.cr.discovery.full-hw.fixed-ip",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_first,
+           { "First Timestamp of Stream", "openhpsdr-e.ts.first",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_mem,
-           { "   Memory Maped Registers", "openhpsdr-e.cr.discovery.full-hw.mem",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_expected,
+           { "Expected Timestamp", "openhpsdr-e.ts.expected",
+            FT_UINT64, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_alex_rx_filters,
-           { "     Alex Receive Filters", "openhpsdr-e.cr.discovery.full-hw.alex-rx-filters",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_delta,
+           { "Timestamp Delta (Samples)", "openhpsdr-e.ts.delta",
+            FT_INT64, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_alex_tx_filters,
-           { "    Alex Transmit Filters", "openhpsdr-e.cr.discovery.full-hw.alex-tx-filters",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_gap,
+           { "Gap", "openhpsdr-e.ts.gap",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_vita_49,
-           { "         Vita-49 Protocol", "openhpsdr-e.cr.discovery.full-hw.vita-49",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_overlap,
+           { "Overlap", "openhpsdr-e.ts.overlap",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_dsp_clock,
-           { "DSP Clock Frequency   ", "openhpsdr-e.cr.discovery.full-hw.dsp-clock",
-            FT_UINT32, BASE_DEC,
+       { &hf_openhpsdr_e_ts_reset,
+           { "Timestamp Reset", "openhpsdr-e.ts.reset",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_adc_num,
-           { "Number of ADC         ", "openhpsdr-e.cr.discovery.full-hw.adc-num",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_ts_rate,
+           { "Estimated Sample Clock (sps)", "openhpsdr-e.ts.rate",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_adc_dither,
-           { "ADC Dither", "openhpsdr-e.cr.discovery.full-hw.adc-dither",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_ts_drift,
+           { "Sample Clock Drift (ppm)", "openhpsdr-e.ts.drift-ppm",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_adc_random,
-           { "ADC Random", "openhpsdr-e.cr.discovery.full-hw.adc-random",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+    };
+
+    // DDC I&Q Data Rate Analysis Field Array
+    static hf_register_info hf_rate[] = {
+       { &hf_openhpsdr_e_rate,
+           { "Data Rate Analysis", "openhpsdr-e.rate",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_num,
-           { "Number of DDC                          ", "openhpsdr-e.cr.discovery.full-hw.ddc-num",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_rate_expected,
+           { "Expected Datagrams per Second", "openhpsdr-e.rate.expected",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_freq_phase,
-           { "DDC Frequency or Phase Word", "openhpsdr-e.cr.discovery.full-hw.ddc-freq-phase",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_phase_frequency), BOOLEAN_B0,
+       { &hf_openhpsdr_e_rate_observed,
+           { "Observed Datagrams per Second", "openhpsdr-e.rate.observed",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_atten,
-           { "Receive (DDC) Attenuator   ", "openhpsdr-e.cr.discovery.full-hw.ddc-atten",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_rate_window,
+           { "Measurement Window (Seconds)", "openhpsdr-e.rate.window",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb,
-           { "Wideband (Raw ADC)      ", "openhpsdr-e.cr.discovery.full-hw.wb",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_rate_datagrams,
+           { "Datagrams in Window", "openhpsdr-e.rate.datagrams",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_samples,
-           { "Wideband Samples Per Datagram       ", "openhpsdr-e.cr.discovery.full-hw.wb-samples",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_rate_deviation,
+           { "Deviation (Percent)", "openhpsdr-e.rate.deviation",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_var,
-           { "Wideband Bits Format    ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-var",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_variable_fixed), BOOLEAN_B0,
+    };
+
+    // Bandwidth Budget Field Array
+    static hf_register_info hf_budget[] = {
+       { &hf_openhpsdr_e_budget,
+           { "Bandwidth Budget", "openhpsdr-e.budget",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_size,
-           { "Wideband Size Per Sample            ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-size",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_budget_ddciq,
+           { "DDC I&Q (Mbit/s)", "openhpsdr-e.budget.ddciq",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_update,
-           { "Wideband Update Format  ", "openhpsdr-e.cr.discovery.full-hw.wb-update",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_variable_fixed), BOOLEAN_B0,
+       { &hf_openhpsdr_e_budget_wbd,
+           { "Wide Band Data (Mbit/s)", "openhpsdr-e.budget.wbd",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_update_rate,
-           { "Wideband Fixed Update Rate          ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-update-rate",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_budget_micl,
+           { "Mic / Line (Mbit/s)", "openhpsdr-e.budget.micl",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_datagram,
-           { "Wideband Datagram Format", "openhpsdr-e.cr.discovery.full-hw.wb-datagram",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_variable_fixed), BOOLEAN_B0,
+       { &hf_openhpsdr_e_budget_hw_to_host,
+           { "Hardware to Host (Mbit/s)", "openhpsdr-e.budget.hw-to-host",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_datagrams_frame,
-           { "Wideband Datagrams Per Fixed Frame  ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-datagrams-frame",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_budget_duciq,
+           { "DUC I&Q (Mbit/s)", "openhpsdr-e.budget.duciq",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rates,
-           { "DCC Ind Samp Rate", "openhpsdr-e.cr.discovery.full-hw.ddc-rates",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_budget_ddca,
+           { "DDC Audio (Mbit/s)", "openhpsdr-e.budget.ddca",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_min,
-           { "DCC Minimum Sample Rate      ", "openhpsdr-e.cr.discovery.full-hw.ddc-rate-min",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_budget_host_to_hw,
+           { "Host to Hardware (Mbit/s)", "openhpsdr-e.budget.host-to-hw",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_max,
-           { "DCC Maximum Sample Rate      ", "openhpsdr-e.cr.discovery.full-hw.ddc-rate-max",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_budget_link,
+           { "Link Speed (Mbit/s)", "openhpsdr-e.budget.link",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cic_dec,
-           { "CIC Decimation Settable", "openhpsdr-e.cr.discovery.full-hw.ddc-cic-dec",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_budget_load,
+           { "Link Load (Percent)", "openhpsdr-e.budget.load",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_sync_ddc_num,
-           { "Number Synchronous DDC       ", "openhpsdr-e.cr.discovery.full-hw.sync-ddc-num",
-            FT_UINT8, BASE_DEC,
+    };
+
+    // Inter-arrival Time Field Array
+    static hf_register_info hf_iat[] = {
+       { &hf_openhpsdr_e_iat,
+           { "Inter-arrival Time", "openhpsdr-e.iat",
+            FT_RELATIVE_TIME, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Time since the previous datagram of the stream", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_channels,
-	   { "DDC Audio Codec Channels     ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-channels",
-            FT_UINT8, BASE_DEC,
-            VALS(codec_audio_channels),ZERO_MASK,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_iat_burst,
+           { "Burst Position", "openhpsdr-e.iat.burst",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Datagrams of the stream in a row closer than 20 uS", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_rate,
-           { "DDC Audio Codec Rate         ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-rate",
-            FT_UINT8, BASE_DEC,
+    };
+
+    // DDC I&Q Statistics Field Array
+    static hf_register_info hf_ddciq_stats[] = {
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_ITEM],
+           { "I&Q Statistics", "openhpsdr-e.ddciq.stats",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_size,
-           { "DDC Audio Codec Size         ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-rate",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_MEAN_I],
+           { "Mean I (DC Offset)", "openhpsdr-e.ddciq.mean-i",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Mean of the I samples, full scale 1.0", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_samples,
-           { "DCC Audio Samples Datagram   ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-samples",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_MEAN_Q],
+           { "Mean Q (DC Offset)", "openhpsdr-e.ddciq.mean-q",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Mean of the Q samples, full scale 1.0", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_iq_time_stamp,
-           { "DCC IQ Time Stamp", "openhpsdr-e.cr.discovery.full-hw.iq-time-stamp",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_RMS],
+           { "RMS Power (dBFS)", "openhpsdr-e.ddciq.rms-dbfs",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Mean of I^2 + Q^2, 0 dBFS is a magnitude of full scale", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_num,
-           { "Number of DUC                ", "openhpsdr-e.cr.discovery.full-hw.multi-duc-num",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_PEAK],
+           { "Peak Magnitude (dBFS)", "openhpsdr-e.ddciq.peak-dbfs",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Largest I^2 + Q^2, 0 dBFS is a magnitude of full scale", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec,
-           { "DUC Audio Codec  ", "openhpsdr-e.cr.discovery.full-hw.duc-codec",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_stats[HPSDR_E_IQSTATS_CLIPPED],
+           { "Clipped Values", "openhpsdr-e.ddciq.clipped",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "I or Q values at the largest or smallest sample value", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_mic,
-           { "DUC Codec MIC    ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-mic",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+    };
+
+    // DUC I&Q Statistics Field Array
+    static hf_register_info hf_duciq_stats[] = {
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_ITEM],
+           { "I&Q Statistics", "openhpsdr-e.duciq.stats",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_line,
-           { "DUC Codec Line-IN", "openhpsdr-e.cr.discovery.full-hw.duc-codec-line",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_MEAN_I],
+           { "Mean I (DC Offset)", "openhpsdr-e.duciq.mean-i",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Mean of the I samples, full scale 1.0", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_rate,
-           { "DUC Audio Codec Rate         ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-rate",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_MEAN_Q],
+           { "Mean Q (DC Offset)", "openhpsdr-e.duciq.mean-q",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Mean of the Q samples, full scale 1.0", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_size,
-           { "DUC Audio Codec Size         ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-size",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_RMS],
+           { "RMS Power (dBFS)", "openhpsdr-e.duciq.rms-dbfs",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Mean of I^2 + Q^2, 0 dBFS is a magnitude of full scale", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_samples,
-           { "DUC Audio Samples Datagram   ", "openhpsdr-e.cr.discovery.full-hw.duc-audio-samples",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_PEAK],
+           { "Peak Magnitude (dBFS)", "openhpsdr-e.duciq.peak-dbfs",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Largest I^2 + Q^2, 0 dBFS is a magnitude of full scale", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_freq_phase,
-           { "DUC Freq or Phase Word", "openhpsdr-e.cr.discovery.full-hw.duc-freq-phase",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_phase_frequency), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_stats[HPSDR_E_IQSTATS_CLIPPED],
+           { "Clipped Values", "openhpsdr-e.duciq.clipped",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "I or Q values at the largest or smallest sample value", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_rate,
-           { "DUC Transmit IQ Sample Rate       ", "openhpsdr-e.cr.discovery.full-hw.tx-iq-rate",
-            FT_UINT8, BASE_DEC,
+    };
+
+    // Wide Band Spectrum Analysis Field Array
+    static hf_register_info hf_wb[] = {
+       { &hf_openhpsdr_e_wb_spectrum,
+           { "Spectrum Frame", "openhpsdr-e.wb.spectrum",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_size,
-           { "DUC Transmit IQ Sample Size       ", "openhpsdr-e.cr.discovery.full-hw.tx-iq-size",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_wb_frame,
+           { "Frame Number", "openhpsdr-e.wb.frame",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Spectrum frame of the ADC, from 1", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_iq_samples,
-           { "DUC IQ Samples Datagram           ", "openhpsdr-e.cr.discovery.full-hw.duc-iq-samples",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_wb_fft_len,
+           { "FFT Size", "openhpsdr-e.wb.fft-size",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Samples in the spectrum frame", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_env_track,
-           { "     Envelope Tracking", "openhpsdr-e.cr.discovery.full-hw.env-track",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_wb_noise_floor,
+           { "Noise Floor (dBFS / Bin)", "openhpsdr-e.wb.noise-floor",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Median FFT bin, 0 dBFS is a full scale sine", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cw_sidetone,
-           { "Hardware CW Sidetone Gen", "openhpsdr-e.cr.discovery.full-hw.cw-sidetone",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+       { &hf_openhpsdr_e_wb_peak,
+           { "Largest Sample (dBFS)", "openhpsdr-e.wb.peak-dbfs",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cw_host,
-           { "            CW From Host", "openhpsdr-e.cr.discovery.full-hw.cw-host",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_wb_clipped,
+           { "Clipped Samples", "openhpsdr-e.wb.clipped",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Samples at full scale in the spectrum frame", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cw_iambic,
-           { "Hardware Iambic CW Keyer", "openhpsdr-e.cr.discovery.full-hw.cw-iambic",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_wb_overloads,
+           { "Overload Frames", "openhpsdr-e.wb.overload-frames",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Spectrum frames of the ADC with clipped samples so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cw_break,
-           { "             CW Break-In", "openhpsdr-e.cr.discovery.full-hw.cw-break",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_wb_averaged,
+           { "Frames Averaged", "openhpsdr-e.wb.averaged",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Spectrum frames in the average spectrum", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_cw_hang,
-           { "CW Maximun Hang Time                ", "openhpsdr-e.cr.discovery.full-hw.cw-hang",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_wb_spur_freq,
+           { "Spur Frequency (Hz)", "openhpsdr-e.wb.spur-freq",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Strongest FFT peaks, strongest first", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_delay,
-           { "RF Delay                            ", "openhpsdr-e.cr.discovery.full-hw.delay",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_wb_spur_dbfs,
+           { "Spur Level (dBFS)", "openhpsdr-e.wb.spur-dbfs",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_phase_shift,
-           { "      DUC RF Phase Shift", "openhpsdr-e.cr.discovery.full-hw.duc-rf-phase-shift",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
+    };
+
+    // Audio Pacing Analysis Field Array
+    static hf_register_info hf_pacing[] = {
+       { &hf_openhpsdr_e_pacing,
+           { "Pacing Analysis", "openhpsdr-e.pacing",
+            FT_STRING, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_duc_atten,
-           { "DUC Front End Attenuator", "openhpsdr-e.cr.discovery.full-hw.duc-rf-atten",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_supported_notsupported), BOOLEAN_B0,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_pacing_lateness,
+           { "Lateness (mS)", "openhpsdr-e.pacing.lateness",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Arrival after the time the datagram was due at 48 ksps, negative is early", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_oc,
-           { "Open Collector Outputs              ", "openhpsdr-e.cr.discovery.full-hw.oc",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_pacing_depth,
+           { "Jitter Buffer Needed (mS)", "openhpsdr-e.pacing.depth",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Latest minus earliest arrival of the stream so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_cal,
-           { "DDC Calibration                     ", "openhpsdr-e.cr.discovery.ddc-cal",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_pacing_underrun,
+           { "Under-run", "openhpsdr-e.pacing.underrun",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Later than the pacing jitter buffer preference", HFILL }
        },
-       { &hf_openhpsdr_e_cr_disc_full_hw_gen_adc,
-           { "Num General Purpose ADC             ", "openhpsdr-e.cr.discovery.full-hw.gen-adc",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_pacing_overrun,
+           { "Over-run", "openhpsdr-e.pacing.overrun",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Earlier than twice the pacing jitter buffer preference", HFILL }
        },
-       { &hf_openhpsdr_e_cr_erase_mac,
-           { "Board MAC Address" , "openhpsdr-e.cr.erase.mac",
-            FT_ETHER, BASE_NONE,
+       { &hf_openhpsdr_e_pacing_underruns,
+           { "Under-runs", "openhpsdr-e.pacing.underruns",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            "Hardware Address", HFILL }
+            "Under-runs of the stream so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_erase_board,
-           { "Board Type       ", "openhpsdr-e.cr.erase.board",
-            FT_UINT8, BASE_DEC,
-            VALS(cr_disc_board_id), ZERO_MASK,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_pacing_overruns,
+           { "Over-runs", "openhpsdr-e.pacing.overruns",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            "Over-runs of the stream so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_erase_proto_ver,
-           { "Potocol Version  ", "openhpsdr-e.cr.erase.proto-ver",
-            FT_UINT8, BASE_DEC,
+    };
+
+    // DUC I&Q FIFO Model Field Array
+    static hf_register_info hf_fifo[] = {
+       { &hf_openhpsdr_e_fifo,
+           { "DUC FIFO Model", "openhpsdr-e.fifo",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_mac,
-           { "Board MAC Address    " , "openhpsdr-e.cr.program.mac",
-            FT_ETHER, BASE_NONE,
+       { &hf_openhpsdr_e_fifo_rate,
+           { "DUC Sample Rate (sps)", "openhpsdr-e.fifo.rate",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            "Hardware Address", HFILL }
+            "From the DUC Command in effect", HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_fw_ver,
-           { "Firmware Code Version", "openhpsdr-e.cr.program.fw-ver",
-            FT_UINT8, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_interval,
+           { "Send Interval (mS)", "openhpsdr-e.fifo.interval",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Time since the previous DUC I&Q datagram of the DUC", HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_board,
-           { "Board Type           ", "openhpsdr-e.cr.program.board",
-            FT_UINT8, BASE_DEC,
-            VALS(cr_disc_board_id), ZERO_MASK,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_fifo_expected,
+           { "Expected Interval (mS)", "openhpsdr-e.fifo.expected",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Time the DUC takes for the samples of one datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_fw_cksum,
-           { "Firmware Checksum    ", "openhpsdr-e.cr.program.fw-cksum",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_fill,
+           { "FIFO Fill (Samples)", "openhpsdr-e.fifo.fill",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Estimated samples in the DUC FIFO after the datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_blocks,
-           { "Program Blocks", "openhpsdr-e.cr.program.blocks",
-            FT_UINT32, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_fill_ms,
+           { "FIFO Fill (mS)", "openhpsdr-e.fifo.fill-ms",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Estimated transmit time in the DUC FIFO after the datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_prog_data,
-           { "Program Data  ", "openhpsdr-e.cr.program.data",
-            FT_NONE, BASE_NONE,
+       { &hf_openhpsdr_e_fifo_behind,
+           { "Host Behind", "openhpsdr-e.fifo.behind",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "The FIFO was below a quarter of its size before the datagram", HFILL }
        },
-      { &hf_openhpsdr_e_cr_setip_sub,
-           { "CR Program Submenu" , "openhpsdr-e.cr.setip.sub",
-            FT_UINT8, BASE_HEX,
-            NULL, BIT8_MASK,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_fifo_ahead,
+           { "Host Ahead", "openhpsdr-e.fifo.ahead",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
+            "The FIFO is above three quarters of its size after the datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_setip_mac,
-           { "Set IP - MAC Address" , "openhpsdr-e.cr.setip.mac",
-            FT_ETHER, BASE_NONE,
+       { &hf_openhpsdr_e_fifo_underrun,
+           { "Under-run", "openhpsdr-e.fifo.underrun",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
-            "Hardware Address", HFILL }
+            "The FIFO emptied before the datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_setip_ip,
-           { "Set IP - IP Address" , "openhpsdr-e.cr.setip.ip",
-            FT_IPv4, BASE_NETMASK,
+       { &hf_openhpsdr_e_fifo_starved,
+           { "Starved (mS)", "openhpsdr-e.fifo.starved",
+            FT_DOUBLE, BASE_NONE,
             NULL, ZERO_MASK,
-            "Hardware Address", HFILL }
+            "Time the FIFO was empty before the datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_ddcc_port,
-           { "DDC  Command  Port        " , "openhpsdr-e.cr.gen.ddcc-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_overflow,
+           { "Overflow", "openhpsdr-e.fifo.overflow",
+            FT_BOOLEAN, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Samples of the datagram did not fit in the FIFO", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_ducc_port,
-           { "DUC  Command  Port        " , "openhpsdr-e.cr.gen.ducc-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_underruns,
+           { "Under-runs", "openhpsdr-e.fifo.underruns",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Under-runs of the DUC so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_hpc_port,
-           { "High Priority Command Port" , "openhpsdr-e.cr.gen.hpc-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_fifo_overflows,
+           { "Overflows", "openhpsdr-e.fifo.overflows",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Overflows of the DUC so far", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_hps_port,
-           { "High Priority  Status Port" , "openhpsdr-e.cr.gen.hps-port",
-            FT_UINT16, BASE_DEC,
+    };
+
+    // Transmit Latency Field Array
+    static hf_register_info hf_tx[] = {
+       { &hf_openhpsdr_e_tx,
+           { "Transmit Latency", "openhpsdr-e.tx",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_ddca_port,
-           { "DDC   Audio   Port        " , "openhpsdr-e.cr.gen.ddca-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_tx_event,
+           { "Transmit Event", "openhpsdr-e.tx.event",
+            FT_UINT32, BASE_DEC,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "Transmit event of the radio, from 1", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_duciq_base_port,
-           { "DUC  Base IQ  Port        " , "openhpsdr-e.cr.gen.duciq-base-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_tx_key_frame,
+           { "PTT Command Frame", "openhpsdr-e.tx.key-frame",
+            FT_FRAMENUM, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "The High Priority Command that turned PTT on", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_ddciq_base_port,
-           { "DDC  Base IQ  Port        " , "openhpsdr-e.cr.gen.ddciq-base-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_tx_ptt,
+           { "PTT Status Latency", "openhpsdr-e.tx.ptt-latency",
+            FT_RELATIVE_TIME, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "PTT command to the first High Priority Status with PTT on", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_micl_port,
-           { "Mic / Line Samples Port   " , "openhpsdr-e.cr.gen.micl-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_tx_duciq,
+           { "DUC I&Q Latency", "openhpsdr-e.tx.duciq-latency",
+            FT_RELATIVE_TIME, BASE_NONE,
             NULL, ZERO_MASK,
-            NULL, HFILL }
+            "PTT command to the first DUC I&Q datagram", HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wbd_base_port,
-           { "Wideband Data Base Port   " , "openhpsdr-e.cr.gen.wbd-base-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_tx_rf,
+           { "RF Latency", "openhpsdr-e.tx.rf-latency",
+            FT_RELATIVE_TIME, BASE_NONE,
+            NULL, ZERO_MASK,
+            "PTT command to the first High Priority Status with forward power", HFILL }
+       },
+    };
+
+    // CW Keying Field Array
+    static hf_register_info hf_cw[] = {
+       { &hf_openhpsdr_e_cw,
+           { "CW Keying", "openhpsdr-e.cw",
+            FT_STRING, BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_0,
-           { " Wideband 0 State" , "openhpsdr-e.cr.gen.wb0-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cw_key,
+           { "Key Down", "openhpsdr-e.cw.key",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Key state after the edge", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_element,
+           { "Element", "openhpsdr-e.cw.element",
+            FT_UINT8, BASE_DEC,
+            VALS(cw_elements), ZERO_MASK,
+            "Mark or space ended by the edge", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_length,
+           { "Length (mS)", "openhpsdr-e.cw.length",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Time since the previous edge of the key", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_resolution,
+           { "Edge Resolution (mS)", "openhpsdr-e.cw.resolution",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Time since the previous High Priority Status, hardware key only", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_wpm,
+           { "Keyer Speed (WPM)", "openhpsdr-e.cw.wpm",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            "From the DUC Command in effect", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_weight,
+           { "Keyer Weight", "openhpsdr-e.cw.weight",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            "From the DUC Command in effect, 50 is a standard weight", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_expected,
+           { "Expected Length (mS)", "openhpsdr-e.cw.expected",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "From the keyer speed and weight", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_error,
+           { "Length Error (mS)", "openhpsdr-e.cw.error",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Length less the expected length", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_off_timing,
+           { "Off Timing", "openhpsdr-e.cw.off-timing",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Error above a quarter dot and the edge resolution", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_jitter,
+           { "Coarse Edge", "openhpsdr-e.cw.jitter",
+            FT_BOOLEAN, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Edge resolution above a quarter dot, hardware key only", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_key_frame,
+           { "Host Key Down Frame", "openhpsdr-e.cw.key-frame",
+            FT_FRAMENUM, BASE_NONE,
+            NULL, ZERO_MASK,
+            "The High Priority Command that keyed", HFILL }
+       },
+       { &hf_openhpsdr_e_cw_latency,
+           { "Keying Latency", "openhpsdr-e.cw.latency",
+            FT_RELATIVE_TIME, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Host key down to hardware key down", HFILL }
+       },
+    };
+
+    // Command Reply Field Arrary
+    static hf_register_info hf_cr[] = {
+       { &hf_openhpsdr_e_cr_banner,
+           { "openHPSDR Ethernet - Command Reply" , "openhpsdr-e.cr.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_1,
-           { " Wideband 1 State" , "openhpsdr-e.cr.gen.wb1-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_sequence_num,
+           { "Sequence Number", "openhpsdr-e.cr.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_2,
-           { " Wideband 2 State" , "openhpsdr-e.cr.gen.wb2-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_command,
+           { "Command", "openhpsdr-e.cr.command",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_3,
-           { " Wideband 3 State" , "openhpsdr-e.cr.gen.wb3-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_ei,
+           { "CR Expert" , "openhpsdr-e.cr.ei",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_4,
-           { " Wideband 4 State" , "openhpsdr-e.cr.gen.wb4-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_pad,
+           { "Zero Pad" , "openhpsdr-e.cr.zero",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_5,
-           { " Wideband 5 State" , "openhpsdr-e.cr.gen.wb5-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_desc,
+           { "DC Description" , "openhpsdr-e.cr.desc",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_6,
-           { " Wideband 6 State" , "openhpsdr-e.cr.gen.wb6-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+       { &hf_openhpsdr_e_cr_disc_mac,
+           { "Board MAC Address " , "openhpsdr-e.cr.discovery.mac",
+            FT_ETHER, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Hardware Address", HFILL }
+       },
+       { &hf_openhpsdr_e_cr_disc_board,
+           { "Board Type        ", "openhpsdr-e.cr.discovery.board",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_disc_board_id), ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_en_7,
-           { " Wideband 7 State" , "openhpsdr-e.cr.gen.wb7-state",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_disc_proto_ver,
+           { "Supported Potocol Version", "openhpsdr-e.cr.discovery.proto-ver",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_samples,
-           { "Wideband Samples per Datagram" , "openhpsdr-e.cr.gen.wb-samples",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_cr_disc_fw_ver,
+           { "Firmware Version", "openhpsdr-e.cr.discovery.fw-ver",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_size,
-           { "Wideband Samples Size        ", "openhpsdr-e.cr.cr.gen.wb-size",
+       { &hf_openhpsdr_e_cr_disc_merc0_ver,
+           { "Mercury0 Version", "openhpsdr-e.cr.discovery.merc0-ver",
             FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_rate,
-           { "Wideband Samples Update Rate ", "openhpsdr-e.cr.cr.gen.wb-rate",
+       { &hf_openhpsdr_e_cr_disc_merc1_ver,
+           { "Mercury1 Version", "openhpsdr-e.cr.discovery.merc1-ver",
             FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_wb_datagrams_full_spec,
-           { "Datagrams for Full Wideband Spectrum", "openhpsdr-e.cr.cr.gen.wb-datagrams-full",
+       { &hf_openhpsdr_e_cr_disc_merc2_ver,
+           { "Mercury2 Version", "openhpsdr-e.cr.discovery.merc2-ver",
             FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_mem_host_port,
-           { "Memory Mapped Host Port      " , "openhpsdr-e.cr.gen.mem-host-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_cr_disc_merc3_ver,
+           { "Mercury3 Version", "openhpsdr-e.cr.discovery.merc3-ver",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_mem_hw_port,
-           { "Memory Mapped Hardware Port  " , "openhpsdr-e.cr.gen.mem-hw-port",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_cr_disc_penny_ver,
+           { "Penny   Version ", "openhpsdr-e.cr.discovery.penny-ver",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_pwm_env_min,
-           { "PWM Envelope Minimum         " , "openhpsdr-e.cr.gen.pwm-env-min",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_cr_disc_metis_ver,
+           { "Metis   Version ", "openhpsdr-e.cr.discovery.metis-ver",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_pwm_env_max,
-           { "PWM Envelope Maximum         " , "openhpsdr-e.cr.gen.pwm-env-max",
-            FT_UINT16, BASE_DEC,
+       { &hf_openhpsdr_e_cr_disc_ddc_num,
+           { "Number of DDC Implemented", "openhpsdr-e.cr.discovery.metis-ver",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_iq_ts,
-           { "Time Stamp DDC IQ" , "openhpsdr-e.cr.gen.iq-ts",
+       { &hf_openhpsdr_e_cr_disc_freq_phase,
+           { "Frequency or Phase Word" , "openhpsdr-e.cr.discovery.freq-phase",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+            TFS(&phase_freq), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_vita,
-           { "   VITA-49 Format" , "openhpsdr-e.cr.gen.vita",
+       { &hf_openhpsdr_e_cr_disc_big_endian,
+           {"             Big-Endian", "openhpsdr-e.cr.discovery.big-endian",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_vna,
-           { "         VNA Mode" , "openhpsdr-e.cr.gen.vna",
+       { &hf_openhpsdr_e_cr_disc_little_endian,
+           {"          Little-Endian", "openhpsdr-e.cr.discovery.little-endian",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+	    TFS(&local_supported_notsupported), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_freq_phase,
-           { "DDC & DUC - Freq or Phase Word" , "openhpsdr-e.cr.gen.freq-phase",
+       { &hf_openhpsdr_e_cr_disc_three_byte_ddciq,
+           {"     3 Byte DDC IQ Data", "openhpsdr-e.cr.discovery.3-byte-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&phase_freq), BOOLEAN_B3,
+	    TFS(&local_supported_notsupported), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_hw_reset_timer,
-           {"Hardware Reset Timer", "openhpsdr-e.cr.gen.hw-reset-timer",
+       { &hf_openhpsdr_e_cr_disc_float_ddciq,
+           {"      Float DDC IQ Data", "openhpsdr-e.cr.discovery.float-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_supported_notsupported), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_big_endian,
-           {"          Big-Endian", "openhpsdr-e.cr.gen.big-endian",
+       { &hf_openhpsdr_e_cr_disc_double_ddciq,
+           {"     Double DDC IQ Data", "openhpsdr-e.cr.discovery.double-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_supported_notsupported), BOOLEAN_B4,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_little_endian,
-           {"       Little-Endian", "openhpsdr-e.cr.gen.little-endian",
-            FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_disc_beta_ver,
+           { "Beta Version", "openhpsdr-e.cr.discovery.beta-ver",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_three_byte_ddciq,
-           {"  3 Byte DDC IQ Data", "openhpsdr-e.cr.gen.3-byte-dcciq",
+       { &hf_openhpsdr_e_cr_disc_full_hw_hpsdr_fw,
+           { "OpenHPSDR Firmware Update", "openhpsdr-e.cr.discovery.full-hw.fw",
             FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B2,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_float_ddciq,
-           {"   Float DDC IQ Data", "openhpsdr-e.cr.gen.float-dcciq",
+       { &hf_openhpsdr_e_cr_disc_full_hw_udp_ports,
+           { "    Non-Default UDP Ports", "openhpsdr-e.cr.discovery.full-hw.udp-ports",
             FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B3,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_double_ddciq,
-           {"  Double DDC IQ Data", "openhpsdr-e.cr.gen.double-dcciq",
+       { &hf_openhpsdr_e_cr_disc_full_hw_fixed_ip,
+           { "         Fixed IP Address", "openhpsdr-e.cr.discovery.full-hw.fixed-ip",
             FT_BOOLEAN, BOOLEAN_MASK,
-	    TFS(&local_enabled_disabled), BOOLEAN_B4,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_atlas_merc_cfg,
-           { "         Atlas Mercury DDC Conf" , "openhpsdr-e.cr.gen.atlas-merc",
-            FT_UINT8, BASE_DEC,
-            VALS(cr_gen_atlas_merc), MASKBITS_2_1_0,
+       { &hf_openhpsdr_e_cr_disc_full_hw_mem,
+           { "   Memory Maped Registers", "openhpsdr-e.cr.discovery.full-hw.mem",
+            FT_BOOLEAN, BOOLEAN_MASK,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_10mhz,
-           { "               10MHz Ref Source" , "openhpsdr-e.cr.gen.10mhz",
-            FT_UINT8, BASE_DEC,
-            VALS(cr_gen_10mhz), MASKBITS_1_0,
+       { &hf_openhpsdr_e_cr_disc_full_hw_alex_rx_filters,
+           { "     Alex Receive Filters", "openhpsdr-e.cr.discovery.full-hw.alex-rx-filters",
+            FT_BOOLEAN, BOOLEAN_MASK,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_pa,
-           { "PA (VNA mode or Tansverter Out)" , "openhpsdr-e.cr.gen.pa",
+       { &hf_openhpsdr_e_cr_disc_full_hw_alex_tx_filters,
+           { "    Alex Transmit Filters", "openhpsdr-e.cr.discovery.full-hw.alex-tx-filters",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_apollo_atu_auto,
-           { "           Apollo ATU Auto Tune" , "openhpsdr-e.cr.gen.apollo-atu-auto",
+       { &hf_openhpsdr_e_cr_disc_full_hw_vita_49,
+           { "         Vita-49 Protocol", "openhpsdr-e.cr.discovery.full-hw.vita-49",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_merc_comm_freq,
-           { "       Mult Mercury Common Freq" , "openhpsdr-e.cr.gen.merc-comm-freq",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&same_independent), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_disc_full_hw_dsp_clock,
+           { "DSP Clock Frequency   ", "openhpsdr-e.cr.discovery.full-hw.dsp-clock",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_122880khz,
-           { "           122.88MHz Ref Source" , "openhpsdr-e.cr.gen.apollo-atu-auto",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&mercury_penelope), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_disc_full_hw_adc_num,
+           { "Number of ADC         ", "openhpsdr-e.cr.discovery.full-hw.adc-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_0,
-           { "Alex 0" , "openhpsdr-e.cr.gen.alex-0",
+       { &hf_openhpsdr_e_cr_disc_full_hw_adc_dither,
+           { "ADC Dither", "openhpsdr-e.cr.discovery.full-hw.adc-dither",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_1,
-           { "Alex 1" , "openhpsdr-e.cr.gen.alex-1",
+       { &hf_openhpsdr_e_cr_disc_full_hw_adc_random,
+           { "ADC Random", "openhpsdr-e.cr.discovery.full-hw.adc-random",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_2,
-           { "Alex 2" , "openhpsdr-e.cr.gen.alex-2",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_num,
+           { "Number of DDC                          ", "openhpsdr-e.cr.discovery.full-hw.ddc-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_3,
-           { "Alex 3" , "openhpsdr-e.cr.gen.alex-3",
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_freq_phase,
+           { "DDC Frequency or Phase Word", "openhpsdr-e.cr.discovery.full-hw.ddc-freq-phase",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+	    TFS(&local_phase_frequency), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_4,
-           { "Alex 4" , "openhpsdr-e.cr.gen.alex-4",
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_atten,
+           { "Receive (DDC) Attenuator   ", "openhpsdr-e.cr.discovery.full-hw.ddc-atten",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_5,
-           { "Alex 5" , "openhpsdr-e.cr.gen.alex-5",
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb,
+           { "Wideband (Raw ADC)      ", "openhpsdr-e.cr.discovery.full-hw.wb",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_6,
-           { "Alex 6" , "openhpsdr-e.cr.gen.alex-6",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_samples,
+           { "Wideband Samples Per Datagram       ", "openhpsdr-e.cr.discovery.full-hw.wb-samples",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_cr_gen_alex_7,
-           { "Alex 7" , "openhpsdr-e.cr.gen.alex-7",
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_var,
+           { "Wideband Bits Format    ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-var",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+	    TFS(&local_variable_fixed), BOOLEAN_B0,
             NULL, HFILL }
        },
-
-    };
-
-    // DDC Command Field Arrary
-    static hf_register_info hf_ddcc[] = {
-       { &hf_openhpsdr_e_ddcc_banner,
-           { "openHPSDR Ethernet - DDC Command" , "openhpsdr-e.ddcc.banner",
-            FT_STRING , BASE_NONE,
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_size,
+           { "Wideband Size Per Sample            ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-size",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_sequence_num,
-           { "Sequence Number", "openhpsdr-e.ddcc.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_update,
+           { "Wideband Update Format  ", "openhpsdr-e.cr.discovery.full-hw.wb-update",
+            FT_BOOLEAN, BOOLEAN_MASK,
+	    TFS(&local_variable_fixed), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_num,
-           { "Number of Supported ADC", "openhpsdr-e.ddcc.adc-num",
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_update_rate,
+           { "Wideband Fixed Update Rate          ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-update-rate",
             FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ditram_sub,
-           { "DDC Command Dither Random Submenu" , "openhpsdr-e.ddcc.ditram-sub",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_adc_dither0,
-           { "ADC 0 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-0",
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_datagram,
+           { "Wideband Datagram Format", "openhpsdr-e.cr.discovery.full-hw.wb-datagram",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_variable_fixed), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither1,
-           { "ADC 1 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_datagrams_frame,
+           { "Wideband Datagrams Per Fixed Frame  ", "openhpsdr-e.cr.discovery.full-hw.wb-fixed-datagrams-frame",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither2,
-           { "ADC 2 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-2",
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rates,
+           { "DCC Ind Samp Rate", "openhpsdr-e.cr.discovery.full-hw.ddc-rates",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither3,
-           { "ADC 3 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-3",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_min,
+           { "DCC Minimum Sample Rate      ", "openhpsdr-e.cr.discovery.full-hw.ddc-rate-min",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither4,
-           { "ADC 4 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-4",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_max,
+           { "DCC Maximum Sample Rate      ", "openhpsdr-e.cr.discovery.full-hw.ddc-rate-max",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither5,
-           { "ADC 5 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-5",
+       { &hf_openhpsdr_e_cr_disc_full_hw_cic_dec,
+           { "CIC Decimation Settable", "openhpsdr-e.cr.discovery.full-hw.ddc-cic-dec",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither6,
-           { "ADC 6 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-6",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+       { &hf_openhpsdr_e_cr_disc_full_hw_sync_ddc_num,
+           { "Number Synchronous DDC       ", "openhpsdr-e.cr.discovery.full-hw.sync-ddc-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_dither7,
-           { "ADC 7 Dither" , "openhpsdr-e.cr.ddcc.adc-dither-7",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_channels,
+	   { "DDC Audio Codec Channels     ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-channels",
+            FT_UINT8, BASE_DEC,
+            VALS(codec_audio_channels),ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random0,
-           { "ADC 0 Random" , "openhpsdr-e.cr.ddcc.adc-random-0",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_rate,
+           { "DDC Audio Codec Rate         ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-rate",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random1,
-           { "ADC 1 Random" , "openhpsdr-e.cr.ddcc.adc-random-1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_size,
+           { "DDC Audio Codec Size         ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-rate",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random2,
-           { "ADC 2 Random" , "openhpsdr-e.cr.ddcc.adc-random-2",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_samples,
+           { "DCC Audio Samples Datagram   ", "openhpsdr-e.cr.discovery.full-hw.ddc-codec-samples",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random3,
-           { "ADC 3 Random" , "openhpsdr-e.cr.ddcc.adc-random-3",
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_iq_time_stamp,
+           { "DCC IQ Time Stamp", "openhpsdr-e.cr.discovery.full-hw.iq-time-stamp",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random4,
-           { "ADC 4 Random" , "openhpsdr-e.cr.ddcc.adc-random-4",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_num,
+           { "Number of DUC                ", "openhpsdr-e.cr.discovery.full-hw.multi-duc-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random5,
-           { "ADC 5 Random" , "openhpsdr-e.cr.ddcc.adc-random-5",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec,
+           { "DUC Audio Codec  ", "openhpsdr-e.cr.discovery.full-hw.duc-codec",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random6,
-           { "ADC 6 Random" , "openhpsdr-e.cr.ddcc.adc-random-6",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_mic,
+           { "DUC Codec MIC    ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-mic",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_adc_random7,
-           { "ADC 7 Random" , "openhpsdr-e.cr.ddcc.adc-random-7",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_line,
+           { "DUC Codec Line-IN", "openhpsdr-e.cr.discovery.full-hw.duc-codec-line",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_state_sub,
-           { "DDC State Submenu" , "openhpsdr-e.ddcc.state-sub",
-            FT_UINT8, BASE_HEX,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_rate,
+           { "DUC Audio Codec Rate         ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-rate",
+            FT_UINT8, BASE_DEC,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc0,
-           { "DDC  0" , "openhpsdr-e.cr.ddcc.ddc-0",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_size,
+           { "DUC Audio Codec Size         ", "openhpsdr-e.cr.discovery.full-hw.duc-codec-size",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc1,
-           { "DDC  1" , "openhpsdr-e.cr.ddcc.ddc-1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_codec_samples,
+           { "DUC Audio Samples Datagram   ", "openhpsdr-e.cr.discovery.full-hw.duc-audio-samples",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc2,
-           { "DDC  2" , "openhpsdr-e.cr.ddcc.ddc-2",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_freq_phase,
+           { "DUC Freq or Phase Word", "openhpsdr-e.cr.discovery.full-hw.duc-freq-phase",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+	    TFS(&local_phase_frequency), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc3,
-           { "DDC  3" , "openhpsdr-e.cr.ddcc.ddc-3",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_rate,
+           { "DUC Transmit IQ Sample Rate       ", "openhpsdr-e.cr.discovery.full-hw.tx-iq-rate",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc4,
-           { "DDC  4" , "openhpsdr-e.cr.ddcc.ddc-4",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_size,
+           { "DUC Transmit IQ Sample Size       ", "openhpsdr-e.cr.discovery.full-hw.tx-iq-size",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc5,
-           { "DDC  5" , "openhpsdr-e.cr.ddcc.ddc-5",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_iq_samples,
+           { "DUC IQ Samples Datagram           ", "openhpsdr-e.cr.discovery.full-hw.duc-iq-samples",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc6,
-           { "DDC  6" , "openhpsdr-e.cr.ddcc.ddc-6",
+       { &hf_openhpsdr_e_cr_disc_full_hw_env_track,
+           { "     Envelope Tracking", "openhpsdr-e.cr.discovery.full-hw.env-track",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc7,
-           { "DDC  7" , "openhpsdr-e.cr.ddcc.ddc-7",
+       { &hf_openhpsdr_e_cr_disc_full_hw_cw_sidetone,
+           { "Hardware CW Sidetone Gen", "openhpsdr-e.cr.discovery.full-hw.cw-sidetone",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc8,
-           { "DDC  8" , "openhpsdr-e.cr.ddcc.ddc-8",
+       { &hf_openhpsdr_e_cr_disc_full_hw_cw_host,
+           { "            CW From Host", "openhpsdr-e.cr.discovery.full-hw.cw-host",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc9,
-           { "DDC  9" , "openhpsdr-e.cr.ddcc.ddc-9",
+       { &hf_openhpsdr_e_cr_disc_full_hw_cw_iambic,
+           { "Hardware Iambic CW Keyer", "openhpsdr-e.cr.discovery.full-hw.cw-iambic",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc10,
-           { "DDC 10" , "openhpsdr-e.cr.ddcc.ddc-10",
+       { &hf_openhpsdr_e_cr_disc_full_hw_cw_break,
+           { "             CW Break-In", "openhpsdr-e.cr.discovery.full-hw.cw-break",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc11,
-           { "DDC 11" , "openhpsdr-e.cr.ddcc.ddc-11",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc12,
-           { "DDC 12" , "openhpsdr-e.cr.ddcc.ddc-12",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_disc_full_hw_cw_hang,
+           { "CW Maximun Hang Time                ", "openhpsdr-e.cr.discovery.full-hw.cw-hang",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc13,
-           { "DDC 13" , "openhpsdr-e.cr.ddcc.ddc-13",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_disc_full_hw_delay,
+           { "RF Delay                            ", "openhpsdr-e.cr.discovery.full-hw.delay",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc14,
-           { "DDC 14" , "openhpsdr-e.cr.ddcc.ddc-14",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_phase_shift,
+           { "      DUC RF Phase Shift", "openhpsdr-e.cr.discovery.full-hw.duc-rf-phase-shift",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc15,
-           { "DDC 15" , "openhpsdr-e.cr.ddcc.ddc-15",
+       { &hf_openhpsdr_e_cr_disc_full_hw_duc_atten,
+           { "DUC Front End Attenuator", "openhpsdr-e.cr.discovery.full-hw.duc-rf-atten",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+	    TFS(&local_supported_notsupported), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc16,
-           { "DDC 16" , "openhpsdr-e.cr.ddcc.ddc-16",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_disc_full_hw_oc,
+           { "Open Collector Outputs              ", "openhpsdr-e.cr.discovery.full-hw.oc",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc17,
-           { "DDC 17" , "openhpsdr-e.cr.ddcc.ddc-17",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_disc_full_hw_ddc_cal,
+           { "DDC Calibration                     ", "openhpsdr-e.cr.discovery.ddc-cal",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc18,
-           { "DDC 18" , "openhpsdr-e.cr.ddcc.ddc-18",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_disc_full_hw_gen_adc,
+           { "Num General Purpose ADC             ", "openhpsdr-e.cr.discovery.full-hw.gen-adc",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc19,
-           { "DDC 19" , "openhpsdr-e.cr.ddcc.ddc-19",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_cr_erase_mac,
+           { "Board MAC Address" , "openhpsdr-e.cr.erase.mac",
+            FT_ETHER, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Hardware Address", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc20,
-           { "DDC 20" , "openhpsdr-e.cr.ddcc.ddc-20",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_erase_board,
+           { "Board Type       ", "openhpsdr-e.cr.erase.board",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_disc_board_id), ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc21,
-           { "DDC 21" , "openhpsdr-e.cr.ddcc.ddc-21",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_erase_proto_ver,
+           { "Potocol Version  ", "openhpsdr-e.cr.erase.proto-ver",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc22,
-           { "DDC 22" , "openhpsdr-e.cr.ddcc.ddc-22",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_cr_prog_mac,
+           { "Board MAC Address    " , "openhpsdr-e.cr.program.mac",
+            FT_ETHER, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Hardware Address", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc23,
-           { "DDC 23" , "openhpsdr-e.cr.ddcc.ddc-23",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_prog_fw_ver,
+           { "Firmware Code Version", "openhpsdr-e.cr.program.fw-ver",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc24,
-           { "DDC 24" , "openhpsdr-e.cr.ddcc.ddc-24",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_prog_board,
+           { "Board Type           ", "openhpsdr-e.cr.program.board",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_disc_board_id), ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc25,
-           { "DDC 25" , "openhpsdr-e.cr.ddcc.ddc-25",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_prog_fw_cksum,
+           { "Firmware Checksum    ", "openhpsdr-e.cr.program.fw-cksum",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc26,
-           { "DDC 26" , "openhpsdr-e.cr.ddcc.ddc-26",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_prog_blocks,
+           { "Program Blocks", "openhpsdr-e.cr.program.blocks",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc27,
-           { "DDC 27" , "openhpsdr-e.cr.ddcc.ddc-27",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_prog_data,
+           { "Program Data  ", "openhpsdr-e.cr.program.data",
+            FT_NONE, BASE_NONE,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc28,
-           { "DDC 28" , "openhpsdr-e.cr.ddcc.ddc-28",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+      { &hf_openhpsdr_e_cr_setip_sub,
+           { "CR Program Submenu" , "openhpsdr-e.cr.setip.sub",
+            FT_UINT8, BASE_HEX,
+            NULL, BIT8_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc29,
-           { "DDC 29" , "openhpsdr-e.cr.ddcc.ddc-29",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_cr_setip_mac,
+           { "Set IP - MAC Address" , "openhpsdr-e.cr.setip.mac",
+            FT_ETHER, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Hardware Address", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc30,
-           { "DDC 30" , "openhpsdr-e.cr.ddcc.ddc-30",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_cr_setip_ip,
+           { "Set IP - IP Address" , "openhpsdr-e.cr.setip.ip",
+            FT_IPv4, BASE_NETMASK,
+            NULL, ZERO_MASK,
+            "Hardware Address", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc31,
-           { "DDC 31" , "openhpsdr-e.cr.ddcc.ddc-31",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_gen_ddcc_port,
+           { "DDC  Command  Port        " , "openhpsdr-e.cr.gen.ddcc-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc32,
-           { "DDC 32" , "openhpsdr-e.cr.ddcc.ddc-32",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_gen_ducc_port,
+           { "DUC  Command  Port        " , "openhpsdr-e.cr.gen.ducc-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc33,
-           { "DDC 33" , "openhpsdr-e.cr.ddcc.ddc-33",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_gen_hpc_port,
+           { "High Priority Command Port" , "openhpsdr-e.cr.gen.hpc-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc34,
-           { "DDC 34" , "openhpsdr-e.cr.ddcc.ddc-34",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_gen_hps_port,
+           { "High Priority  Status Port" , "openhpsdr-e.cr.gen.hps-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc35,
-           { "DDC 35" , "openhpsdr-e.cr.ddcc.ddc-35",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_gen_ddca_port,
+           { "DDC   Audio   Port        " , "openhpsdr-e.cr.gen.ddca-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc36,
-           { "DDC 36" , "openhpsdr-e.cr.ddcc.ddc-36",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_gen_duciq_base_port,
+           { "DUC  Base IQ  Port        " , "openhpsdr-e.cr.gen.duciq-base-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc37,
-           { "DDC 37" , "openhpsdr-e.cr.ddcc.ddc-37",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_gen_ddciq_base_port,
+           { "DDC  Base IQ  Port        " , "openhpsdr-e.cr.gen.ddciq-base-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc38,
-           { "DDC 38" , "openhpsdr-e.cr.ddcc.ddc-38",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+       { &hf_openhpsdr_e_cr_gen_micl_port,
+           { "Mic / Line Samples Port   " , "openhpsdr-e.cr.gen.micl-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc39,
-           { "DDC 39" , "openhpsdr-e.cr.ddcc.ddc-39",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_gen_wbd_base_port,
+           { "Wideband Data Base Port   " , "openhpsdr-e.cr.gen.wbd-base-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc40,
-           { "DDC 40" , "openhpsdr-e.cr.ddcc.ddc-40",
+       { &hf_openhpsdr_e_cr_gen_wb_en_0,
+           { " Wideband 0 State" , "openhpsdr-e.cr.gen.wb0-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc41,
-           { "DDC 41" , "openhpsdr-e.cr.ddcc.ddc-41",
+       { &hf_openhpsdr_e_cr_gen_wb_en_1,
+           { " Wideband 1 State" , "openhpsdr-e.cr.gen.wb1-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc42,
-           { "DDC 42" , "openhpsdr-e.cr.ddcc.ddc-42",
+       { &hf_openhpsdr_e_cr_gen_wb_en_2,
+           { " Wideband 2 State" , "openhpsdr-e.cr.gen.wb2-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc43,
-           { "DDC 43" , "openhpsdr-e.cr.ddcc.ddc-43",
+       { &hf_openhpsdr_e_cr_gen_wb_en_3,
+           { " Wideband 3 State" , "openhpsdr-e.cr.gen.wb3-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc44,
-           { "DDC 44" , "openhpsdr-e.cr.ddcc.ddc-44",
+       { &hf_openhpsdr_e_cr_gen_wb_en_4,
+           { " Wideband 4 State" , "openhpsdr-e.cr.gen.wb4-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B4,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc45,
-           { "DDC 45" , "openhpsdr-e.cr.ddcc.ddc-45",
+       { &hf_openhpsdr_e_cr_gen_wb_en_5,
+           { " Wideband 5 State" , "openhpsdr-e.cr.gen.wb5-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B5,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc46,
-           { "DDC 46" , "openhpsdr-e.cr.ddcc.ddc-46",
+       { &hf_openhpsdr_e_cr_gen_wb_en_6,
+           { " Wideband 6 State" , "openhpsdr-e.cr.gen.wb6-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B6,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc47,
-           { "DDC 47" , "openhpsdr-e.cr.ddcc.ddc-47",
+       { &hf_openhpsdr_e_cr_gen_wb_en_7,
+           { " Wideband 7 State" , "openhpsdr-e.cr.gen.wb7-state",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B7,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc48,
-           { "DDC 48" , "openhpsdr-e.cr.ddcc.ddc-48",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+       { &hf_openhpsdr_e_cr_gen_wb_samples,
+           { "Wideband Samples per Datagram" , "openhpsdr-e.cr.gen.wb-samples",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc49,
-           { "DDC 49" , "openhpsdr-e.cr.ddcc.ddc-49",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+       { &hf_openhpsdr_e_cr_gen_wb_size,
+           { "Wideband Samples Size        ", "openhpsdr-e.cr.cr.gen.wb-size",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc50,
-           { "DDC 50" , "openhpsdr-e.cr.ddcc.ddc-50",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_gen_wb_rate,
+           { "Wideband Samples Update Rate ", "openhpsdr-e.cr.cr.gen.wb-rate",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc51,
-           { "DDC 51" , "openhpsdr-e.cr.ddcc.ddc-51",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_gen_wb_datagrams_full_spec,
+           { "Datagrams for Full Wideband Spectrum", "openhpsdr-e.cr.cr.gen.wb-datagrams-full",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc52,
-           { "DDC 52" , "openhpsdr-e.cr.ddcc.ddc-52",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+       { &hf_openhpsdr_e_cr_gen_mem_host_port,
+           { "Memory Mapped Host Port      " , "openhpsdr-e.cr.gen.mem-host-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc53,
-           { "DDC 53" , "openhpsdr-e.cr.ddcc.ddc-53",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+       { &hf_openhpsdr_e_cr_gen_mem_hw_port,
+           { "Memory Mapped Hardware Port  " , "openhpsdr-e.cr.gen.mem-hw-port",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc54,
-           { "DDC 54" , "openhpsdr-e.cr.ddcc.ddc-54",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+       { &hf_openhpsdr_e_cr_gen_pwm_env_min,
+           { "PWM Envelope Minimum         " , "openhpsdr-e.cr.gen.pwm-env-min",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc55,
-           { "DDC 55" , "openhpsdr-e.cr.ddcc.ddc-55",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+       { &hf_openhpsdr_e_cr_gen_pwm_env_max,
+           { "PWM Envelope Maximum         " , "openhpsdr-e.cr.gen.pwm-env-max",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc56,
-           { "DDC 56" , "openhpsdr-e.cr.ddcc.ddc-56",
+       { &hf_openhpsdr_e_cr_gen_iq_ts,
+           { "Time Stamp DDC IQ" , "openhpsdr-e.cr.gen.iq-ts",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc57,
-           { "DDC 57" , "openhpsdr-e.cr.ddcc.ddc-57",
+       { &hf_openhpsdr_e_cr_gen_vita,
+           { "   VITA-49 Format" , "openhpsdr-e.cr.gen.vita",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc58,
-           { "DDC 58" , "openhpsdr-e.cr.ddcc.ddc-58",
+       { &hf_openhpsdr_e_cr_gen_vna,
+           { "         VNA Mode" , "openhpsdr-e.cr.gen.vna",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc59,
-           { "DDC 59" , "openhpsdr-e.cr.ddcc.ddc-59",
+       { &hf_openhpsdr_e_cr_gen_freq_phase,
+           { "DDC & DUC - Freq or Phase Word" , "openhpsdr-e.cr.gen.freq-phase",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+            TFS(&phase_freq), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc60,
-           { "DDC 60" , "openhpsdr-e.cr.ddcc.ddc-60",
+       { &hf_openhpsdr_e_cr_hw_reset_timer,
+           {"Hardware Reset Timer", "openhpsdr-e.cr.gen.hw-reset-timer",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+	    TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc61,
-           { "DDC 61" , "openhpsdr-e.cr.ddcc.ddc-61",
+       { &hf_openhpsdr_e_cr_big_endian,
+           {"          Big-Endian", "openhpsdr-e.cr.gen.big-endian",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+	    TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc62,
-           { "DDC 62" , "openhpsdr-e.cr.ddcc.ddc-62",
+       { &hf_openhpsdr_e_cr_little_endian,
+           {"       Little-Endian", "openhpsdr-e.cr.gen.little-endian",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+	    TFS(&local_enabled_disabled), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc63,
-           { "DDC 63" , "openhpsdr-e.cr.ddcc.ddc-63",
+       { &hf_openhpsdr_e_cr_three_byte_ddciq,
+           {"  3 Byte DDC IQ Data", "openhpsdr-e.cr.gen.3-byte-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+	    TFS(&local_enabled_disabled), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc64,
-           { "DDC 64" , "openhpsdr-e.cr.ddcc.ddc-64",
+       { &hf_openhpsdr_e_cr_float_ddciq,
+           {"   Float DDC IQ Data", "openhpsdr-e.cr.gen.float-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
+	    TFS(&local_enabled_disabled), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc65,
-           { "DDC 65" , "openhpsdr-e.cr.ddcc.ddc-65",
+       { &hf_openhpsdr_e_cr_double_ddciq,
+           {"  Double DDC IQ Data", "openhpsdr-e.cr.gen.double-dcciq",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
+	    TFS(&local_enabled_disabled), BOOLEAN_B4,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc66,
-           { "DDC 66" , "openhpsdr-e.cr.ddcc.ddc-66",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
+       { &hf_openhpsdr_e_cr_gen_atlas_merc_cfg,
+           { "         Atlas Mercury DDC Conf" , "openhpsdr-e.cr.gen.atlas-merc",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_gen_atlas_merc), MASKBITS_2_1_0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc67,
-           { "DDC 67" , "openhpsdr-e.cr.ddcc.ddc-67",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
+       { &hf_openhpsdr_e_cr_gen_10mhz,
+           { "               10MHz Ref Source" , "openhpsdr-e.cr.gen.10mhz",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_gen_10mhz), MASKBITS_1_0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc68,
-           { "DDC 68" , "openhpsdr-e.cr.ddcc.ddc-68",
+       { &hf_openhpsdr_e_cr_gen_pa,
+           { "PA (VNA mode or Tansverter Out)" , "openhpsdr-e.cr.gen.pa",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
+            TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc69,
-           { "DDC 69" , "openhpsdr-e.cr.ddcc.ddc-69",
+       { &hf_openhpsdr_e_cr_gen_apollo_atu_auto,
+           { "           Apollo ATU Auto Tune" , "openhpsdr-e.cr.gen.apollo-atu-auto",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
+            TFS(&local_enabled_disabled), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc70,
-           { "DDC 70" , "openhpsdr-e.cr.ddcc.ddc-70",
+       { &hf_openhpsdr_e_cr_gen_merc_comm_freq,
+           { "       Mult Mercury Common Freq" , "openhpsdr-e.cr.gen.merc-comm-freq",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
+            TFS(&same_independent), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc71,
-           { "DDC 71" , "openhpsdr-e.cr.ddcc.ddc-71",
+       { &hf_openhpsdr_e_cr_gen_122880khz,
+           { "           122.88MHz Ref Source" , "openhpsdr-e.cr.gen.apollo-atu-auto",
             FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
+            TFS(&mercury_penelope), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc72,
-           { "DDC 72" , "openhpsdr-e.cr.ddcc.ddc-72",
+       { &hf_openhpsdr_e_cr_gen_alex_0,
+           { "Alex 0" , "openhpsdr-e.cr.gen.alex-0",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B0,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc73,
-           { "DDC 73" , "openhpsdr-e.cr.ddcc.ddc-73",
+       { &hf_openhpsdr_e_cr_gen_alex_1,
+           { "Alex 1" , "openhpsdr-e.cr.gen.alex-1",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B1,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc74,
-           { "DDC 74" , "openhpsdr-e.cr.ddcc.ddc-74",
+       { &hf_openhpsdr_e_cr_gen_alex_2,
+           { "Alex 2" , "openhpsdr-e.cr.gen.alex-2",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B2,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc75,
-           { "DDC 75" , "openhpsdr-e.cr.ddcc.ddc-75",
+       { &hf_openhpsdr_e_cr_gen_alex_3,
+           { "Alex 3" , "openhpsdr-e.cr.gen.alex-3",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B3,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc76,
-           { "DDC 76" , "openhpsdr-e.cr.ddcc.ddc-76",
+       { &hf_openhpsdr_e_cr_gen_alex_4,
+           { "Alex 4" , "openhpsdr-e.cr.gen.alex-4",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B4,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc77,
-           { "DDC 77" , "openhpsdr-e.cr.ddcc.ddc-77",
+       { &hf_openhpsdr_e_cr_gen_alex_5,
+           { "Alex 5" , "openhpsdr-e.cr.gen.alex-5",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B5,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc78,
-           { "DDC 78" , "openhpsdr-e.cr.ddcc.ddc-78",
+       { &hf_openhpsdr_e_cr_gen_alex_6,
+           { "Alex 6" , "openhpsdr-e.cr.gen.alex-6",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B6,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc79,
-           { "DDC 79" , "openhpsdr-e.cr.ddcc.ddc-79",
+       { &hf_openhpsdr_e_cr_gen_alex_7,
+           { "Alex 7" , "openhpsdr-e.cr.gen.alex-7",
             FT_BOOLEAN, BOOLEAN_MASK,
             TFS(&local_enabled_disabled), BOOLEAN_B7,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_config_sub,
-           { "DDC Configuration Submenu" , "openhpsdr-e.ddcc.config-sub",
-            FT_UINT8, BASE_HEX,
+
+    };
+
+    // DDC Command Field Arrary
+    static hf_register_info hf_ddcc[] = {
+       { &hf_openhpsdr_e_ddcc_banner,
+           { "openHPSDR Ethernet - DDC Command" , "openhpsdr-e.ddcc.banner",
+            FT_STRING , BASE_NONE,
             NULL, ZERO_MASK,
             NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign0,
-           { "DDC  0  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-0",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_sequence_num,
+           { "Sequence Number", "openhpsdr-e.ddcc.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign1,
-           { "DDC  1  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-1",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_adc_num,
+           { "Number of Supported ADC", "openhpsdr-e.ddcc.adc-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign2,
-           { "DDC  2  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-2",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_ditram_sub,
+           { "DDC Command Dither Random Submenu" , "openhpsdr-e.ddcc.ditram-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign3,
-           { "DDC  3  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-3",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_adc_dither_flags,
+           { "ADC Dither", "openhpsdr-e.cr.ddcc.adc-dither",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign4,
-           { "DDC  4  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-4",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_adc_random_flags,
+           { "ADC Random", "openhpsdr-e.cr.ddcc.adc-random",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign5,
-           { "DDC  5  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-5",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_state_sub,
+           { "DDC State Submenu" , "openhpsdr-e.ddcc.state-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign6,
-           { "DDC  6  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-6",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_config_sub,
+           { "DDC Configuration Submenu" , "openhpsdr-e.ddcc.config-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign7,
-           { "DDC  7  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-7",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddcc_sync_sub,
+           { "DDC Sunc Submenu" , "openhpsdr-e.ddcc.sync-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign8,
-           { "DDC  8  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-8",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // High Priority Status Field Arrary
+    static hf_register_info hf_hps[] = {
+       { &hf_openhpsdr_e_hps_banner,
+           { "openHPSDR Ethernet - High Priority Status" , "openhpsdr-e.hps.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign9,
-           { "DDC  9  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-9",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_sequence_num,
+           { "Sequence Number", "openhpsdr-e.hps.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign10,
-           { "DDC 10  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-10",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_ptt,
+           { "PTT", "openhpsdr-e.hps.ptt",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive),BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign11,
-           { "DDC 11  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-11",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_dot,
+           { "Dot", "openhpsdr-e.hps.dot",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive),BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign12,
-           { "DDC 12  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-12",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_dash,
+           { "Dash", "openhpsdr-e.hps.dash",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign13,
-           { "DDC 13  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-13",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_empty,
+           { "Empty - Not Used", "openhpsdr-e.hps.empty",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             NULL, BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign14,
-           { "DDC 14  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-14",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_pll,
+           { "PLL", "openhpsdr-e.hps.pll",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&lock_unlock), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign15,
-           { "DDC 15  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-15",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       // Remove at some point ?
+       // 3.7 - No longer supported
+       { &hf_openhpsdr_e_hps_fifo_empty,
+           { "FIFO Empty - As of 3.7: Not Supported", "openhpsdr-e.hps.fifo-empty",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B5,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign16,
-           { "DDC 16  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-16",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       // Remove at some point ?
+       // 3.7 - No longer supported
+       { &hf_openhpsdr_e_hps_fifo_full,
+           { "FIFO Full - As of 3.7: Not Supported", "openhpsdr-e.hps.fifo-full",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B6,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign17,
-           { "DDC 17  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-17",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_status_flags,
+           { "Status", "openhpsdr-e.hps.status",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign18,
-           { "DDC 18  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-18",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_adc_ol_flags,
+           { "ADC Overload", "openhpsdr-e.hps.adc-ol",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign19,
-           { "DDC 19  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-19",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_ex_power0,
+           { "Exciter Power 0" , "openhpsdr-e.hps.ex-power0",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign20,
-           { "DDC 20  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-20",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_ex_power1,
+           { "Exciter Power 1" , "openhpsdr-e.hps.ex-power1",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign21,
-           { "DDC 21  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-21",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_ex_power2,
+           { "Exciter Power 2" , "openhpsdr-e.hps.ex-power2",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign22,
-           { "DDC 22  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-22",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_ex_power3,
+           { "Exciter Power 3" , "openhpsdr-e.hps.ex-power3",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign23,
-           { "DDC 23  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-23",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_fp_alex0,
+           { "Forward Power - Alex 0  " , "openhpsdr-e.hps.fp-alex0",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign24,
-           { "DDC 24  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-24",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_fp_alex1,
+           { "Forward Power - Alex 1  " , "openhpsdr-e.hps.fp-alex1",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign25,
-           { "DDC 25  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-25",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_fp_alex2,
+           { "Forward Power - Alex 2  " , "openhpsdr-e.hps.fp-alex2",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign26,
-           { "DDC 26  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-26",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_fp_alex3,
+           { "Forward Power - Alex 3  " , "openhpsdr-e.hps.fp-alex3",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign27,
-           { "DDC 27  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-27",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_rp_alex0,
+           { "Reverse Power - Alex 0  " , "openhpsdr-e.hps.rp-alex0",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign28,
-           { "DDC 28  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-28",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_rp_alex1,
+           { "Reverse Power - Alex 1  " , "openhpsdr-e.hps.rp-alex1",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign29,
-           { "DDC 29  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-29",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_rp_alex2,
+           { "Reverse Power - Alex 2  " , "openhpsdr-e.hps.rp-alex2",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign30,
-           { "DDC 30  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-30",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_rp_alex3,
+           { "Reverse Power - Alex 3  " , "openhpsdr-e.hps.rp-alex3",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign31,
-           { "DDC 31  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-31",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_supp_vol,
+           { "Supply Voltage          " , "openhpsdr-e.hps.supply-volt",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign32,
-           { "DDC 32  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-32",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_cal_board,
+           { "Power Calibration       " , "openhpsdr-e.hps.cal-board",
+            FT_UINT8, BASE_DEC,
+            VALS(cr_disc_board_id), ZERO_MASK,
+            "Board of the power bridge calibration, from the discovery reply", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign33,
-           { "DDC 33  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-33",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_ex_watts,
+           { "Exciter Power 0 (W)     " , "openhpsdr-e.hps.ex-power0-watts",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign34,
-           { "DDC 34  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-34",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_fp_watts,
+           { "Forward Power (W)       " , "openhpsdr-e.hps.fp-alex0-watts",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Alex 0 forward power", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign35,
-           { "DDC 35  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-35",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_rp_watts,
+           { "Reverse Power (W)       " , "openhpsdr-e.hps.rp-alex0-watts",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "Alex 0 reverse power", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign36,
-           { "DDC 36  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-36",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_swr,
+           { "SWR                     " , "openhpsdr-e.hps.swr",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            "From the Alex 0 forward and reverse power", HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign37,
-           { "DDC 37  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-37",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_supply_volts,
+           { "Supply Voltage (V)      " , "openhpsdr-e.hps.supply-volts",
+            FT_DOUBLE, BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign38,
-           { "DDC 38  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-38",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_user_adc3,
+           { "User ADC 3              " , "openhpsdr-e.hps.user-adc3",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign39,
-           { "DDC 39  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-39",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_user_adc2,
+           { "User ADC 2              " , "openhpsdr-e.hps.user-adc2",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign40,
-           { "DDC 40  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-40",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_user_adc1,
+           { "User ADC 1              " , "openhpsdr-e.hps.user-adc1",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign41,
-           { "DDC 41  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-41",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hps_user_adc0,
+           { "User ADC 0              " , "openhpsdr-e.hps.user-adc0",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign42,
-           { "DDC 42  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-42",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_io4,
+           { "IO4 Input   ", "openhpsdr-e.hps.io4",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign43,
-           { "DDC 43  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-43",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_io5,
+           { "IO5 Input   ", "openhpsdr-e.hps.io5",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign44,
-           { "DDC 44  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-44",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_io6,
+           { "IO6 Input   ", "openhpsdr-e.hps.io6",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign45,
-           { "DDC 45  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-45",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_io8,
+           { "IO8 Input   ", "openhpsdr-e.hps.io8",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign46,
-           { "DDC 46  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-46",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_io2,
+           { "IO2 Input   ", "openhpsdr-e.hps.io2",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign47,
-           { "DDC 47  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-47",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_user_logic5,
+           { "User Logic 5", "openhpsdr-e.hps.user-logic5",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B5,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign48,
-           { "DDC 48  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-48",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_user_logic6,
+           { "User Logic 6", "openhpsdr-e.hps.user-logic6",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B6,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign49,
-           { "DDC 49  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-49",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hps_user_logic7,
+           { "User Logic 7", "openhpsdr-e.hps.user-logic7",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_set_notset), BOOLEAN_B7,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign50,
-           { "DDC 50  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-50",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+
+   };
+
+    // DUC Command Field Arrary
+    static hf_register_info hf_ducc[] = {
+       { &hf_openhpsdr_e_ducc_banner,
+           { "openHPSDR Ethernet - DUC Command" , "openhpsdr-e.ducc.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign51,
-           { "DDC 51  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-51",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_sequence_num,
+           { "Sequence Number", "openhpsdr-e.ducc.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign52,
-           { "DDC 52  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-52",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_dac_num,
+           { "Harware number of DAC        " , "openhpsdr-e.ducc.dac-num",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign53,
-           { "DDC 53  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-53",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_eer,
+           { "              EER", "openhpsdr-e.ducc.eer",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign54,
-           { "DDC 54  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-54",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_cw,
+           { "               CW", "openhpsdr-e.ducc.cw",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign55,
-           { "DDC 55  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-55",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_rev_cw,
+           { "       Reverse CW", "openhpsdr-e.ducc.rev-cw",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign56,
-           { "DDC 56  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-56",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_iambic,
+           { "           Iambic", "openhpsdr-e.ducc.iambic",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign57,
-           { "DDC 57  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-57",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_sidetone,
+           { "     CW Side Tone", "openhpsdr-e.ducc.sidetone",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign58,
-           { "DDC 58  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-58",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_cw_mode_b,
+           { "        CW Mode B", "openhpsdr-e.ducc.cw-mode-b",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B5,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign59,
-           { "DDC 59  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-59",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_cw_st_char_space,
+           { "CW Strict Spacing", "openhpsdr-e.ducc.cw-st-space",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B6,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign60,
-           { "DDC 60  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-60",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_cw_breakin,
+           { "      CW Break In", "openhpsdr-e.ducc.cw-break-in",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B7,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign61,
-           { "DDC 61  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-61",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_cw_sidetone_level,
+           { "CW Sidetone Level    " , "openhpsdr-e.ducc.cw-sidetone-level",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign62,
-           { "DDC 62  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-62",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_cw_sidetone_freq,
+           { "CW Sidetone Frequency" , "openhpsdr-e.ducc.cw-sidetone-freq",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign63,
-           { "DDC 63  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-63",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_cw_keyer_speed,
+           { "CW Keyer Speed       " , "openhpsdr-e.ducc.cw-keyer-speed",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign64,
-           { "DDC 64  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-64",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_cw_keyer_weight,
+           { "CW Keyer Weight      " , "openhpsdr-e.ducc.cw-keyer-weight",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign65,
-           { "DDC 65  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-65",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_cw_hang_delay,
+           { "CW Hang Delay        " , "openhpsdr-e.ducc.cw-hang-delay",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign66,
-           { "DDC 66  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-66",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_rf_delay,
+           { "RF Delay             " , "openhpsdr-e.ducc.rf-delay",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign67,
-           { "DDC 67  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-67",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_duc0_sample,
+           { "DUC 0 Sample Rate    " , "openhpsdr-e.ducc.duc0-sample",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign68,
-           { "DDC 68  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-68",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_duc0_bits,
+           { "DUC 0 I&Q Sample Size" , "openhpsdr-e.ducc.duc0-bits",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign69,
-           { "DDC 69  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-69",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_duc0_phase_shift,
+           { "DUC 0 Sample Rate    " , "openhpsdr-e.ducc.duc0-phase-shift",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign70,
-           { "DDC 70  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-70",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_line_in,
+           { "             Line In", "openhpsdr-e.ducc.line-in",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign71,
-           { "DDC 71  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-71",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_mic_boost,
+           { "           Mic Boost", "openhpsdr-e.ducc.mic-boost",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_on_off), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign72,
-           { "DDC 72  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-72",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_orion_mic_ptt,
+           { "       Orion Mic PTT", "openhpsdr-e.ducc.orion-mic-ptt",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_disabled_enabled), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign73,
-           { "DDC 73  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-73",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_orion_mic_ring_tip,
+           { "Orion Mic Tip & Ring", "openhpsdr-e.ducc.orion-mic-tip-ring",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&orion_tip_ring), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign74,
-           { "DDC 74  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-74",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_ducc_orion_mic_bias,
+           { "      Orion Mic Bias", "openhpsdr-e.ducc.sidetone",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign75,
-           { "DDC 75  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-75",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_line_in_gain,
+           { "Line IN Gain                    " , "openhpsdr-e.ducc.line-in-gain",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign76,
-           { "DDC 76  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-76",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ducc_attn_adc0_duc0,
+           { "ADC 0 Step Attenuator on DUC 0  " , "openhpsdr-e.ducc.attn-adc0-duc0",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign77,
-           { "DDC 77  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-77",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // MICL Command Field Arrary
+    static hf_register_info hf_micl[] = {
+       { &hf_openhpsdr_e_micl_banner,
+           { "openHPSDR Ethernet - MIC / Line Samples" , "openhpsdr-e.micl.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign78,
-           { "DDC 78  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-78",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_micl_sequence_num,
+           { "Sequence Number", "openhpsdr-e.micl.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_asign79,
-           { "DDC 79  ADC Assignment", "openhpsdr-e.cr.ddcc.ddc-asign-79",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_micl_separator,
+           { "MIC / Line Sample Separator" , "openhpsdr-e.micl.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate0,
-           { "DDC  0     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-0",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_micl_sample_idx,
+           { "Sample Index", "openhpsdr-e.micl.sample-idx",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate1,
-           { "DDC  1     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-1",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_micl_sample,
+           { "Mic / Line In Sample From Hardware", "openhpsdr-e.micl.sample",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate2,
-           { "DDC  2     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-2",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // High Priority Command Field Arrary
+    static hf_register_info hf_hpc[] = {
+       { &hf_openhpsdr_e_hpc_banner,
+           { "openHPSDR Ethernet - High Priority Command" , "openhpsdr-e.hpc.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate3,
-           { "DDC  3     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-3",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_sequence_num,
+           { "Sequence Number", "openhpsdr-e.hpc.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate4,
-           { "DDC  4     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-4",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_run,
+           { "Run", "openhpsdr-e.hpc.run",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_disabled_enabled), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate5,
-           { "DDC  5     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-5",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_ptt0,
+           { "PPT 0", "openhpsdr-e.hpc.ptt0",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate6,
-           { "DDC  6     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-6",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_rate7,
-           { "DDC  7     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-7",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_rate8,
-           { "DDC  8     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-8",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_ptt1,
+           { "PPT 1", "openhpsdr-e.hpc.ptt1",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate9,
-           { "DDC  9     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-9",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_ptt2,
+           { "PPT 2", "openhpsdr-e.hpc.ptt2",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate10,
-           { "DDC 10     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-10",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_ptt3,
+           { "PPT 3", "openhpsdr-e.hpc.ptt3",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate11,
-           { "DDC 11     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-11",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_run_ptt_flags,
+           { "Run / PTT", "openhpsdr-e.hpc.run-ptt",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate12,
-           { "DDC 12     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-12",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_cwx0_sub,
+           { "CWX0" , "openhpsdr-e.hpc.cwx0-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate13,
-           { "DDC 13     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-13",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_cwx0_cwx,
+           { "CWX", "openhpsdr-e.hpc.cwx0-cwx",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&host_hardware), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate14,
-           { "DDC 14     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-14",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_cwx0_dot,
+           { "Dot", "openhpsdr-e.hpc.cwx0-dot",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate15,
-           { "DDC 15     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-15",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_cwx0_dash,
+           { "Dash", "openhpsdr-e.hpc.cwx0-dash",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_active_inactive), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate16,
-           { "DDC 16     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-16",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_cwx1,
+           { "CWX1               " , "openhpsdr-e.hpc.cwx1",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate17,
-           { "DDC 17     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-17",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_cwx2,
+           { "CWX2               " , "openhpsdr-e.hpc.cwx2",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate18,
-           { "DDC 18     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-18",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_cwx3,
+           { "CWX3               " , "openhpsdr-e.hpc.cwx3",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate19,
-           { "DDC 19     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-19",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_ddc_fp_sub,
+           { "DDC  Frequency / Phase Word Submenu" , "openhpsdr-e.hpc.sync-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate20,
-           { "DDC 20     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-20",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_freq_phase_duc0,
+           { "DUC 0 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc0",
+            FT_UINT32, BASE_DEC,
+            NULL,ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate21,
-           { "DDC 21     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-21",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_freq_phase_duc1,
+           { "DUC 1 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc1",
+            FT_UINT32, BASE_DEC,
+            NULL,ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate22,
-           { "DDC 22     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-22",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_freq_phase_duc2,
+           { "DUC 2 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc2",
+            FT_UINT32, BASE_DEC,
+            NULL,ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate23,
-           { "DDC 23     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-23",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_freq_phase_duc3,
+           { "DUC 3 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc3",
+            FT_UINT32, BASE_DEC,
+            NULL,ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate24,
-           { "DDC 24     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-24",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_drive_duc0,
+           { "DUC 0 Drive Level           " , "openhpsdr-e.hpc.duc0-drive",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate25,
-           { "DDC 25     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-25",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_drive_duc1,
+           { "DUC 1 Drive Level           " , "openhpsdr-e.hpc.duc1-drive",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate26,
-           { "DDC 26     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-26",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_drive_duc2,
+           { "DUC 2 Drive Level           " , "openhpsdr-e.hpc.duc2-drive",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate27,
-           { "DDC 27     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-27",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_drive_duc3,
+           { "DUC 3 Drive Level           " , "openhpsdr-e.hpc.duc3-drive",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate28,
-           { "DDC 28     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-28",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_orion2_xvtr,
+           { "Orion MkII - Transverter" , "openhpsdr-e.hpc.orion2-xvtr",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B0,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate29,
-           { "DDC 29     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-29",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_orion2_IO1,
+           { "Orion MkII - IO1 Audio  " , "openhpsdr-e.hpc.orion2-io1",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&orion2_IO1), BOOLEAN_B1,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate30,
-           { "DDC 30     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-30",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_orion2_flags,
+           { "Orion MkII", "openhpsdr-e.hpc.orion2",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate31,
-           { "DDC 31     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-31",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col1,
+           { "Open Collector Out 1", "openhpsdr-e.hpc.open-col1",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate32,
-           { "DDC 32     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-32",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col2,
+           { "Open Collector Out 2", "openhpsdr-e.hpc.open-col2",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate33,
-           { "DDC 33     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-33",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col3,
+           { "Open Collector Out 3", "openhpsdr-e.hpc.open-col3",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate34,
-           { "DDC 34     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-34",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col4,
+           { "Open Collector Out 4", "openhpsdr-e.hpc.open-col4",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate35,
-           { "DDC 35     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-35",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col5,
+           { "Open Collector Out 5", "openhpsdr-e.hpc.open-col5",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B4,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate36,
-           { "DDC 36     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-36",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col6,
+           { "Open Collector Out 6", "openhpsdr-e.hpc.open-col6",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B5,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate37,
-           { "DDC 37     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-37",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_open_col7,
+           { "Open Collector Out 7", "openhpsdr-e.hpc.open-col7",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B6,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate38,
-           { "DDC 38     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-38",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_open_col_flags,
+           { "Open Collector Outputs", "openhpsdr-e.hpc.open-col",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate39,
-           { "DDC 39     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-39",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_db9_out1,
+           { "Metis DB9 pin 1", "openhpsdr-e.hpc.db9-1",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate40,
-           { "DDC 40     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-40",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_db9_out2,
+           { "Metis DB9 pin 2", "openhpsdr-e.hpc.db9-2",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate41,
-           { "DDC 41     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-41",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_db9_out3,
+           { "Metis DB9 pin 3", "openhpsdr-e.hpc.db9-3",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate42,
-           { "DDC 42     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-42",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_db9_out4,
+           { "Metis DB9 pin 4", "openhpsdr-e.hpc.db9-4",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate43,
-           { "DDC 43     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-43",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_db9_flags,
+           { "Metis DB9 Outputs", "openhpsdr-e.hpc.db9",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate44,
-           { "DDC 44     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-44",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_merc_att1,
+           { "Mercury 1 20dB Attenuate", "openhpsdr-e.hpc.merc_att1",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B0,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate45,
-           { "DDC 45     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-45",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_merc_att2,
+           { "Mercury 2 20dB Attenuate", "openhpsdr-e.hpc.merc_att2",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B1,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate46,
-           { "DDC 46     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-46",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_merc_att3,
+           { "Mercury 3 20dB Attenuate", "openhpsdr-e.hpc.merc_att3",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B2,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate47,
-           { "DDC 47     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-47",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
+       { &hf_openhpsdr_e_hpc_merc_att4,
+           { "Mercury 4 20dB Attenuate", "openhpsdr-e.hpc.merc_att4",
+             FT_BOOLEAN, BOOLEAN_MASK,
+             TFS(&local_enabled_disabled), BOOLEAN_B3,
              NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate48,
-           { "DDC 48     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-48",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_merc_att_flags,
+           { "Mercury 20dB Attenuators", "openhpsdr-e.hpc.merc-att",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate49,
-           { "DDC 49     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-49",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex7,
+           { "Alex 7" , "openhpsdr-e.hpc.alex7",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate50,
-           { "DDC 50     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-50",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex6,
+           { "Alex 6" , "openhpsdr-e.hpc.alex6",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate51,
-           { "DDC 51     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-51",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex5,
+           { "Alex 5" , "openhpsdr-e.hpc.alex5",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate52,
-           { "DDC 52     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-52",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex4,
+           { "Alex 4" , "openhpsdr-e.hpc.alex4",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate53,
-           { "DDC 53     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-53",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex3,
+           { "Alex 3" , "openhpsdr-e.hpc.alex3",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate54,
-           { "DDC 54     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-54",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex2,
+           { "Alex 2" , "openhpsdr-e.hpc.alex2",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate55,
-           { "DDC 55     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-55",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex1,
+           { "Alex 1" , "openhpsdr-e.hpc.alex1",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate56,
-           { "DDC 56     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-56",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_sub,
+           { "Alex 0 Submenu" , "openhpsdr-e.ddcc.alex0-sub",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate57,
-           { "DDC 57     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-57",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_flags[0],
+           { "Alex 0 Bits 31-24", "openhpsdr-e.hpc.alex0-bits0",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate58,
-           { "DDC 58     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-58",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_flags[1],
+           { "Alex 0 Bits 23-16", "openhpsdr-e.hpc.alex0-bits1",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate59,
-           { "DDC 59     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-59",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_flags[2],
+           { "Alex 0 Bits 15-8", "openhpsdr-e.hpc.alex0-bits2",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate60,
-           { "DDC 60     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-60",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_flags[3],
+           { "Alex 0 Bits 7-0", "openhpsdr-e.hpc.alex0-bits3",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate61,
-           { "DDC 61     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-61",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_rate62,
-           { "DDC 62     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-62",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_17_15,
+           { "Alex 0 -  17-15m LPF" , "openhpsdr-e.hpc.alex0-lpf_17-15",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B7,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate63,
-           { "DDC 63     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-63",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_12_10,
+           { "Alex 0 -  12-10m LPF" , "openhpsdr-e.hpc.alex0-lpf_12-10",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B6,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate64,
-           { "DDC 64     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-64",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_6m_bypass,
+           { "Alex 0 - 6M / Bypass" , "openhpsdr-e.hpc.alex0-6m-bypass",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B5,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate65,
-           { "DDC 65     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-65",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_red_led1,
+           { "Alex 0 -   Red LED 1" , "openhpsdr-e.hpc.alex0-red_led1",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B4,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate66,
-           { "DDC 66     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-66",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_tx_rx,
+           { "Alex 0 -     TX / RX" , "openhpsdr-e.hpc.alex0-tx_rx",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B3,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate67,
-           { "DDC 67     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-67",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ant3,
+           { "Alex 0 -   Antenna 3" , "openhpsdr-e.hpc.alex0-ant3",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B2,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate68,
-           { "DDC 68     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-68",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ant2,
+           { "Alex 0 -   Antenna 2" , "openhpsdr-e.hpc.alex0-ant2",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B1,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate69,
-           { "DDC 69     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-69",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ant1,
+           { "Alex 0 -   Antenna 1" , "openhpsdr-e.hpc.alex0-ant1",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B0,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate70,
-           { "DDC 70     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-70",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_160,
+           { "Alex 0 -    160m LPF" , "openhpsdr-e.hpc.alex0-lpf_160",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B7,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate71,
-           { "DDC 71     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-71",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_80,
+           { "Alex 0 -     80m LPF" , "openhpsdr-e.hpc.alex0-lpf_80",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B6,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate72,
-           { "DDC 72     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-72",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_60_40,
+           { "Alex 0 -  60-40m LPF" , "openhpsdr-e.hpc.alex0-lpf_60-40",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B5,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate73,
-           { "DDC 73     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-73",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_lpf_30_20,
+           { "Alex 0 -  30-20m LPF" , "openhpsdr-e.hpc.alex0-lpf_30-20",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B4,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate74,
-           { "DDC 74     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-74",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_yel_led1,
+           { "Alex 0 - Yellow LED1" , "openhpsdr-e.hpc.alex0-yel_led1",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B3,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate75,
-           { "DDC 75     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-75",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+      { &hf_openhpsdr_e_hpc_alex0_orion2_txrx,
+           { "Alex 0 - Orion2 TxRx" , "openhpsdr-e.hpc.alex0-orion2-txrx",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B2,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate76,
-           { "DDC 76     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-76",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_red_led0,
+           { "Alex 0 -   Red LED 0" , "openhpsdr-e.hpc.alex0-red_led0",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B7,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate77,
-           { "DDC 77     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-77",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_att_10,
+           { "Alex 0 - Atten. 10dB" , "openhpsdr-e.hpc.alex0-att_10",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B6,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate78,
-           { "DDC 78     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-78",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_att_20,
+           { "Alex 0 - Atten. 20dB" , "openhpsdr-e.hpc.alex0-att_20",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B5,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_rate79,
-           { "DDC 79     Sample Rate", "openhpsdr-e.cr.ddcc.ddc-rate-79",
-             FT_UINT16, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hf_bypass,
+           { "Alex 0 -   HF Bypass" , "openhpsdr-e.hpc.alex0-hf-bypass",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B4,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_0,
-           { "DDC  0       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-0",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_bypass,
+           { "Alex 0 -      Bypass" , "openhpsdr-e.hpc.alex0-bypass",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B3,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_1,
-           { "DDC  1       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-1",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ext2,
+           { "Alex 0 -       Ext 2" , "openhpsdr-e.hpc.alex0-ext2",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B2,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_2,
-           { "DDC  2       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-2",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ext1,
+           { "Alex 0 -       Ext 1" , "openhpsdr-e.hpc.alex0-ext1",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B1,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_3,
-           { "DDC  3       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-3",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_ddc_xvtr_in,
+           { "Alex 0 - DDC XVTR In" , "openhpsdr-e.hpc.alex0-ddc-xvtr-in",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B0,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_4,
-           { "DDC  4       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-4",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hpf_1_5,
+           { "Alex 0 - 1.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_1-5",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B6,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_5,
-           { "DDC  5       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-5",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hpf_6_5,
+           { "Alex 0 - 6.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_6-5",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B5,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_6,
-           { "DDC  6       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-6",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hpf_9_5,
+           { "Alex 0 - 9.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_9-5",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B4,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_7,
-           { "DDC  7       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-7",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_6m_amp,
+           { "Alex 0 -      6M Amp" , "openhpsdr-e.hpc.alex0-6m-amp",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B3,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_8,
-           { "DDC  8       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-8",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hpf_20,
+           { "Alex 0 -  20 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_20",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B2,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_9,
-           { "DDC  9       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-9",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_hpf_13,
+           { "Alex 0 -  13 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_13",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B1,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_10,
-           { "DDC 10       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-10",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_hpc_alex0_yel_led0,
+           { "Alex 0 - Yellow LED0" , "openhpsdr-e.hpc.alex0-yel_led0",
+            FT_BOOLEAN, BOOLEAN_MASK,
+            TFS(&local_enabled_disabled), BOOLEAN_B0,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_11,
-           { "DDC 11       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-11",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // Wide Band Data Field Arrary
+    static hf_register_info hf_wbd[] = {
+       { &hf_openhpsdr_e_wbd_banner,
+           { "openHPSDR Ethernet - Wide Band Data" , "openhpsdr-e.wbd.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_12,
-           { "DDC 12       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-12",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_wbd_sequence_num,
+           { "Sequence Number", "openhpsdr-e.wbd.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_13,
-           { "DDC 13       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-13",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_wbd_adc,
+           { "Wide Band ADC" , "openhpsdr-e.wbd.adc",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_14,
-           { "DDC 14       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-14",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_wbd_separator,
+           { "Wide Band Data Sample Separator" , "openhpsdr-e.wbd.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_15,
-           { "DDC 15       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-15",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_wbd_sample_idx,
+           { "Sample Index", "openhpsdr-e.wbd.sample-idx",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_16,
-           { "DDC 16       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-16",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_wbd_sample,
+           { "Wide Band Sample From Hardware", "openhpsdr-e.wbd.sample",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_17,
-           { "DDC 17       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-17",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // DDC Audio Field Arrary
+    static hf_register_info hf_ddca[] = {
+       { &hf_openhpsdr_e_ddca_banner,
+           { "openHPSDR Ethernet - DDC Audio" , "openhpsdr-e.ddca.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_18,
-           { "DDC 18       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-18",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_sequence_num,
+           { "Sequence Number", "openhpsdr-e.ddca.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_19,
-           { "DDC 19       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-19",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_sample_bits,
+           { "Bits Per Sample", "openhpsdr-e.ddca.sample-bits",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_20,
-           { "DDC 20       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-20",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_separator,
+           { "DDC Audio Data Sample Separator" , "openhpsdr-e.ddca.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_21,
-           { "DDC 21       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-21",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_sample_idx,
+           { "Sample Index", "openhpsdr-e.ddca.sample-idx",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_22,
-           { "DDC 22       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-22",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_l_sample,
+           { "DDC Left  Audio Sample From Host", "openhpsdr-e.ddca.sample-l",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_23,
-           { "DDC 23       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-23",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_24,
-           { "DDC 24       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-24",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_25,
-           { "DDC 25       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-25",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_26,
-           { "DDC 26       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-26",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_27,
-           { "DDC 27       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-27",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_28,
-           { "DDC 28       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-28",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_29,
-           { "DDC 29       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-29",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_30,
-           { "DDC 30       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-30",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_31,
-           { "DDC 31       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-31",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_32,
-           { "DDC 32       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-32",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_33,
-           { "DDC 33       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-33",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_34,
-           { "DDC 34       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-34",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_35,
-           { "DDC 35       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-35",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_36,
-           { "DDC 36       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-36",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_37,
-           { "DDC 37       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-37",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_38,
-           { "DDC 38       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-38",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_39,
-           { "DDC 39       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-39",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_40,
-           { "DDC 40       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-40",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_41,
-           { "DDC 41       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-41",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_42,
-           { "DDC 42       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-42",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_43,
-           { "DDC 43       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-43",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_44,
-           { "DDC 44       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-44",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_45,
-           { "DDC 45       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-45",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_46,
-           { "DDC 46       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-46",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_47,
-           { "DDC 47       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-47",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_48,
-           { "DDC 48       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-48",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_49,
-           { "DDC 49       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-49",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddca_r_sample,
+           { "DDC Right Audio Sample From Host", "openhpsdr-e.ddca.sample-r",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_50,
-           { "DDC 50       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-50",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+   // DUC I&Q Data Field Arrary
+    static hf_register_info hf_duciq[] = {
+       { &hf_openhpsdr_e_duciq_banner,
+           { "openHPSDR Ethernet - DUC I&Q Data" , "openhpsdr-e.duciq.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_51,
-           { "DDC 51       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-51",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_sequence_num,
+           { "Sequence Number", "openhpsdr-e.duciq.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_52,
-           { "DDC 52       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-52",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_duc,
+           { "Duc Number" , "openhpsdr-e.wbd.duc",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_53,
-           { "DDC 53       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-53",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_sample_bits,
+           { "Bits Per Sample", "openhpsdr-e.duciq.sample-bits",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_54,
-           { "DDC 54       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-54",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_separator,
+           { "DUC I&Q Data Sample Separator" , "openhpsdr-e.duciq.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_55,
-           { "DDC 55       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-55",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_sample_idx,
+           { "Sample Index", "openhpsdr-e.duciq.sample-idx",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_56,
-           { "DDC 56       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-56",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_i_sample,
+           { "DUC I Sample From Host", "openhpsdr-e.duciq.sample-i",
+            FT_UINT24, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_57,
-           { "DDC 57       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-57",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_duciq_q_sample,
+           { "DUC Q Sample From Host", "openhpsdr-e.duciq.sample-q",
+            FT_UINT24, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_58,
-           { "DDC 58       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-58",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+   // DDC I&Q Data Field Arrary
+    static hf_register_info hf_ddciq[] = {
+       { &hf_openhpsdr_e_ddciq_banner,
+           { "openHPSDR Ethernet - DDC I&Q Data" , "openhpsdr-e.ddciq.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_59,
-           { "DDC 59       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-59",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_sequence_num,
+           { "Sequence Number    ", "openhpsdr-e.ddciq.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_60,
-           { "DDC 60       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-60",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_time_stamp,
+           { "Time Stamp         ", "openhpsdr-e.ddciq.time-stamp",
+            FT_UINT64, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_61,
-           { "DDC 61       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-61",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_ddc,
+           { "DDC Number         " , "openhpsdr-e.ddciq.ddc",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_62,
-           { "DDC 62       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-62",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_sample_bits,
+           { "Bits Per Sample    ", "openhpsdr-e.ddciq.sample-bits",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_63,
-           { "DDC 63       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-63",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_samples_per_frame,
+           { "Sample Per Frame   ", "openhpsdr-e.ddciq.sample-per-frame",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_64,
-           { "DDC 64       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-64",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_ethernet_frame_size,
+           { "Ethernet Frame Size", "openhpsdr-e.ddciq.ethernet-frame-size",
+            FT_UINT16, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_65,
-           { "DDC 65       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-65",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_separator,
+           { "DDC I&Q Data Sample Separator" , "openhpsdr-e.ddciq.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_66,
-           { "DDC 66       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-66",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_sample_idx,
+           { "Sample Index", "openhpsdr-e.ddciq.sample-idx",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_67,
-           { "DDC 67       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-67",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_8b_i_sample,
+           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_68,
-           { "DDC 68       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-68",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_8b_q_sample,
+           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
+            FT_UINT8, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_69,
-           { "DDC 69       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-69",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_16b_i_sample,
+           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_70,
-           { "DDC 70       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-70",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_16b_q_sample,
+           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_71,
-           { "DDC 71       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-71",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_24b_i_sample,
+           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
+            FT_UINT24, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_72,
-           { "DDC 72       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-72",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_24b_q_sample,
+           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
+            FT_UINT24, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_73,
-           { "DDC 73       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-73",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_32b_i_sample,
+           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
+            FT_UINT32, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_74,
-           { "DDC 74       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-74",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_ddciq_32b_q_sample,
+           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
+            FT_UINT32, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_75,
-           { "DDC 75       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-75",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+   };
+
+    // Memory Mapped Field Arrary
+    static hf_register_info hf_mem[] = {
+       { &hf_openhpsdr_e_mem_banner,
+           { "openHPSDR Ethernet - Memory Mapped" , "openhpsdr-e.mem.banner",
+            FT_STRING , BASE_NONE,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_76,
-           { "DDC 76       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-76",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_mem_sequence_num,
+           { "Sequence Number", "openhpsdr-e.mem.squence-num",
+            FT_UINT32, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_77,
-           { "DDC 77       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-77",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_mem_separator,
+           { "Memory Mapped Separator" , "openhpsdr-e.ddciq.sep",
+            FT_STRING, STR_ASCII,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_78,
-           { "DDC 78       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-78",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_mem_idx,
+           { "Address/Data Index", "openhpsdr-e.mem.idx",
+            FT_UINT8, BASE_DEC,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic1_79,
-           { "DDC 79       CIC1 Rate", "openhpsdr-e.cr.ddcc.ddc-cic1-79",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
+       { &hf_openhpsdr_e_mem_address,
+           { "Memory Address    ", "openhpsdr-e.mem.address",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_0,
-           { "DDC  0       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-0",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_1,
-           { "DDC  1       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-1",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_2,
-           { "DDC  2       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-2",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_3,
-           { "DDC  3       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-3",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_4,
-           { "DDC  4       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-4",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_5,
-           { "DDC  5       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-5",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_6,
-           { "DDC  6       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-6",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_7,
-           { "DDC  7       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-7",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_8,
-           { "DDC  8       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-8",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_9,
-           { "DDC  9       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-9",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_10,
-           { "DDC 10       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-10",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_11,
-           { "DDC 11       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-11",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_12,
-           { "DDC 12       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-12",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_13,
-           { "DDC 13       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-13",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_14,
-           { "DDC 14       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-14",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_15,
-           { "DDC 15       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-15",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_16,
-           { "DDC 16       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-16",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_17,
-           { "DDC 17       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-17",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_18,
-           { "DDC 18       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-18",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_19,
-           { "DDC 19       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-19",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_20,
-           { "DDC 20       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-20",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_21,
-           { "DDC 21       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-21",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_22,
-           { "DDC 22       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-22",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_23,
-           { "DDC 23       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-23",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_24,
-           { "DDC 24       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-24",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_25,
-           { "DDC 25       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-25",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_26,
-           { "DDC 26       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-26",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_27,
-           { "DDC 27       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-27",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_28,
-           { "DDC 28       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-28",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_29,
-           { "DDC 29       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-29",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_30,
-           { "DDC 30       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-30",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_31,
-           { "DDC 31       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-31",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_32,
-           { "DDC 32       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-32",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_33,
-           { "DDC 33       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-33",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_34,
-           { "DDC 34       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-34",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_35,
-           { "DDC 35       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-35",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_36,
-           { "DDC 36       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-36",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_37,
-           { "DDC 37       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-37",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_38,
-           { "DDC 38       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-38",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_39,
-           { "DDC 39       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-39",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_40,
-           { "DDC 40       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-40",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_41,
-           { "DDC 41       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-41",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_42,
-           { "DDC 42       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-42",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_43,
-           { "DDC 43       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-43",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_44,
-           { "DDC 44       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-44",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_45,
-           { "DDC 45       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-45",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_46,
-           { "DDC 46       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-46",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_47,
-           { "DDC 47       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-47",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_48,
-           { "DDC 48       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-48",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_49,
-           { "DDC 49       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-49",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_50,
-           { "DDC 50       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-50",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_51,
-           { "DDC 51       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-51",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_52,
-           { "DDC 52       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-52",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_53,
-           { "DDC 53       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-53",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_54,
-           { "DDC 54       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-54",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_55,
-           { "DDC 55       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-55",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_56,
-           { "DDC 56       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-56",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_57,
-           { "DDC 57       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-57",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_58,
-           { "DDC 58       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-58",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_59,
-           { "DDC 59       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-59",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_60,
-           { "DDC 60       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-60",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_61,
-           { "DDC 61       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-61",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_62,
-           { "DDC 62       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-62",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_63,
-           { "DDC 63       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-63",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_64,
-           { "DDC 64       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-64",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_65,
-           { "DDC 65       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-65",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_66,
-           { "DDC 66       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-66",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_67,
-           { "DDC 67       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-67",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_68,
-           { "DDC 68       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-68",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_69,
-           { "DDC 69       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-69",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_70,
-           { "DDC 70       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-70",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_71,
-           { "DDC 71       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-71",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_72,
-           { "DDC 72       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-72",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_73,
-           { "DDC 73       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-73",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_74,
-           { "DDC 74       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-74",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_75,
-           { "DDC 75       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-75",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_76,
-           { "DDC 76       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-76",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_77,
-           { "DDC 77       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-77",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_78,
-           { "DDC 78       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-78",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_cic2_79,
-           { "DDC 79       CIC2 Rate", "openhpsdr-e.cr.ddcc.ddc-cic2-79",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size0,
-           { "DDC  0 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-0",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size1,
-           { "DDC  1 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-1",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size2,
-           { "DDC  2 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-2",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size3,
-           { "DDC  3 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-3",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size4,
-           { "DDC  4 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-4",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size5,
-           { "DDC  5 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-5",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size6,
-           { "DDC  6 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-6",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size7,
-           { "DDC  7 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-7",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size8,
-           { "DDC  8 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-8",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size9,
-           { "DDC  9 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-9",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size10,
-           { "DDC 10 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-10",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size11,
-           { "DDC 11 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-11",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size12,
-           { "DDC 12 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-12",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size13,
-           { "DDC 13 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-13",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size14,
-           { "DDC 14 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-14",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size15,
-           { "DDC 15 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-15",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size16,
-           { "DDC 16 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-16",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size17,
-           { "DDC 17 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-17",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size18,
-           { "DDC 18 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-18",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size19,
-           { "DDC 19 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-19",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size20,
-           { "DDC 20 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-20",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size21,
-           { "DDC 21 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-21",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size22,
-           { "DDC 22 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-22",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size23,
-           { "DDC 23 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-23",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size24,
-           { "DDC 24 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-24",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size25,
-           { "DDC 25 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-25",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size26,
-           { "DDC 26 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-26",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size27,
-           { "DDC 27 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-27",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size28,
-           { "DDC 28 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-28",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size29,
-           { "DDC 29 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-29",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size30,
-           { "DDC 30 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-30",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size31,
-           { "DDC 31 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-31",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size32,
-           { "DDC 32 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-32",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size33,
-           { "DDC 33 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-33",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size34,
-           { "DDC 34 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-34",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size35,
-           { "DDC 35 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-35",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size36,
-           { "DDC 36 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-36",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size37,
-           { "DDC 37 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-37",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size38,
-           { "DDC 38 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-38",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size39,
-           { "DDC 39 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-39",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size40,
-           { "DDC 40 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-40",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size41,
-           { "DDC 41 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-41",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size42,
-           { "DDC 42 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-42",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size43,
-           { "DDC 43 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-43",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size44,
-           { "DDC 44 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-44",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size45,
-           { "DDC 45 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-45",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size46,
-           { "DDC 46 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-46",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size47,
-           { "DDC 47 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-47",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size48,
-           { "DDC 48 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-48",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size49,
-           { "DDC 49 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-49",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size50,
-           { "DDC 50 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-50",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size51,
-           { "DDC 51 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-51",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size52,
-           { "DDC 52 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-52",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size53,
-           { "DDC 53 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-53",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size54,
-           { "DDC 54 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-54",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size55,
-           { "DDC 55 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-55",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size56,
-           { "DDC 56 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-56",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size57,
-           { "DDC 57 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-57",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size58,
-           { "DDC 58 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-58",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size59,
-           { "DDC 59 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-59",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size60,
-           { "DDC 60 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-60",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size61,
-           { "DDC 61 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-61",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size62,
-           { "DDC 62 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-62",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size63,
-           { "DDC 63 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-63",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size64,
-           { "DDC 64 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-64",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size65,
-           { "DDC 65 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-65",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size66,
-           { "DDC 66 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-66",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size67,
-           { "DDC 67 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-67",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size68,
-           { "DDC 68 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-68",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size69,
-           { "DDC 69 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-69",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size70,
-           { "DDC 70 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-70",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size71,
-           { "DDC 71 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-71",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size72,
-           { "DDC 72 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-72",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size73,
-           { "DDC 73 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-73",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size74,
-           { "DDC 74 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-74",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size75,
-           { "DDC 75 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-75",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size76,
-           { "DDC 76 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-76",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size77,
-           { "DDC 77 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-77",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size78,
-           { "DDC 78 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-78",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_size79,
-           { "DDC 79 I&Q Sample Size", "openhpsdr-e.cr.ddcc.ddc-size-79",
-             FT_UINT8, BASE_DEC,
-             NULL, ZERO_MASK,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_sync_sub,
-           { "DDC Sunc Submenu" , "openhpsdr-e.ddcc.sync-sub",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_0,
-           { "DDC 0 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_1,
-           { "DDC 1 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_2,
-           { "DDC 2 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_3,
-           { "DDC 3 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_4,
-           { "DDC 4 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_5,
-           { "DDC 5 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_6,
-           { "DDC 6 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_7,
-           { "DDC 7 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_8,
-           { "DDC 8 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_9,
-           { "DDC 9 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_10,
-           { "DDC 10 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_11,
-           { "DDC 11 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_12,
-           { "DDC 12 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_13,
-           { "DDC 13 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_14,
-           { "DDC 14 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_15,
-           { "DDC 15 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_16,
-           { "DDC 16 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_17,
-           { "DDC 17 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_18,
-           { "DDC 18 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_19,
-           { "DDC 19 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_20,
-           { "DDC 20 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_21,
-           { "DDC 21 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_22,
-           { "DDC 22 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_23,
-           { "DDC 23 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_24,
-           { "DDC 24 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_25,
-           { "DDC 25 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_26,
-           { "DDC 26 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_27,
-           { "DDC 27 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_28,
-           { "DDC 28 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_29,
-           { "DDC 29 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_30,
-           { "DDC 30 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_31,
-           { "DDC 31 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_32,
-           { "DDC 32 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_33,
-           { "DDC 33 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_34,
-           { "DDC 34 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_35,
-           { "DDC 35 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_36,
-           { "DDC 36 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_37,
-           { "DDC 37 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_38,
-           { "DDC 38 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_39,
-           { "DDC 39 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_40,
-           { "DDC 40 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_41,
-           { "DDC 41 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_42,
-           { "DDC 42 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_43,
-           { "DDC 43 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_44,
-           { "DDC 44 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_45,
-           { "DDC 45 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_46,
-           { "DDC 46 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_47,
-           { "DDC 47 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_48,
-           { "DDC 48 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_49,
-           { "DDC 49 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_50,
-           { "DDC 50 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_51,
-           { "DDC 51 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_52,
-           { "DDC 52 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_53,
-           { "DDC 53 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_54,
-           { "DDC 54 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_55,
-           { "DDC 55 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_56,
-           { "DDC 56 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_57,
-           { "DDC 57 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_58,
-           { "DDC 58 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_59,
-           { "DDC 59 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_60,
-           { "DDC 60 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_61,
-           { "DDC 61 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_62,
-           { "DDC 62 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_63,
-           { "DDC 63 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_64,
-           { "DDC 64 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_65,
-           { "DDC 65 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_66,
-           { "DDC 66 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_67,
-           { "DDC 67 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_68,
-           { "DDC 68 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_69,
-           { "DDC 69 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_70,
-           { "DDC 70 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_71,
-           { "DDC 71 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_72,
-           { "DDC 72 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_73,
-           { "DDC 73 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_74,
-           { "DDC 74 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_75,
-           { "DDC 75 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_76,
-           { "DDC 76 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_77,
-           { "DDC 77 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_78,
-           { "DDC 78 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync0_79,
-           { "DDC 79 Synchronized With DDC 0", "openhpsdr-e.cr.ddcc.ddc-sync0-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_0,
-           { "DDC 0 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_1,
-           { "DDC 1 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_2,
-           { "DDC 2 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_3,
-           { "DDC 3 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_4,
-           { "DDC 4 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_5,
-           { "DDC 5 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_6,
-           { "DDC 6 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_7,
-           { "DDC 7 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_8,
-           { "DDC 8 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_9,
-           { "DDC 9 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_10,
-           { "DDC 10 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_11,
-           { "DDC 11 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_12,
-           { "DDC 12 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_13,
-           { "DDC 13 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_14,
-           { "DDC 14 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_15,
-           { "DDC 15 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_16,
-           { "DDC 16 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_17,
-           { "DDC 17 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_18,
-           { "DDC 18 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_19,
-           { "DDC 19 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_20,
-           { "DDC 20 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_21,
-           { "DDC 21 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_22,
-           { "DDC 22 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_23,
-           { "DDC 23 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_24,
-           { "DDC 24 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_25,
-           { "DDC 25 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_26,
-           { "DDC 26 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_27,
-           { "DDC 27 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_28,
-           { "DDC 28 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_29,
-           { "DDC 29 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_30,
-           { "DDC 30 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_31,
-           { "DDC 31 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_32,
-           { "DDC 32 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_33,
-           { "DDC 33 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_34,
-           { "DDC 34 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_35,
-           { "DDC 35 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_36,
-           { "DDC 36 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_37,
-           { "DDC 37 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_38,
-           { "DDC 38 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_39,
-           { "DDC 39 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_40,
-           { "DDC 40 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_41,
-           { "DDC 41 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_42,
-           { "DDC 42 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_43,
-           { "DDC 43 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_44,
-           { "DDC 44 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_45,
-           { "DDC 45 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_46,
-           { "DDC 46 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_47,
-           { "DDC 47 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_48,
-           { "DDC 48 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_49,
-           { "DDC 49 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_50,
-           { "DDC 50 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_51,
-           { "DDC 51 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_52,
-           { "DDC 52 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_53,
-           { "DDC 53 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_54,
-           { "DDC 54 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_55,
-           { "DDC 55 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_56,
-           { "DDC 56 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_57,
-           { "DDC 57 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_58,
-           { "DDC 58 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_59,
-           { "DDC 59 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_60,
-           { "DDC 60 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_61,
-           { "DDC 61 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_62,
-           { "DDC 62 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_63,
-           { "DDC 63 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_64,
-           { "DDC 64 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_65,
-           { "DDC 65 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_66,
-           { "DDC 66 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_67,
-           { "DDC 67 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_68,
-           { "DDC 68 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_69,
-           { "DDC 69 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_70,
-           { "DDC 70 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_71,
-           { "DDC 71 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_72,
-           { "DDC 72 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_73,
-           { "DDC 73 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_74,
-           { "DDC 74 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_75,
-           { "DDC 75 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_76,
-           { "DDC 76 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_77,
-           { "DDC 77 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_78,
-           { "DDC 78 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync1_79,
-           { "DDC 79 Synchronized With DDC 1", "openhpsdr-e.cr.ddcc.ddc-sync1-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_0,
-           { "DDC 0 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_1,
-           { "DDC 1 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_2,
-           { "DDC 2 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_3,
-           { "DDC 3 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_4,
-           { "DDC 4 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_5,
-           { "DDC 5 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_6,
-           { "DDC 6 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_7,
-           { "DDC 7 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_8,
-           { "DDC 8 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_9,
-           { "DDC 9 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_10,
-           { "DDC 10 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_11,
-           { "DDC 11 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_12,
-           { "DDC 12 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_13,
-           { "DDC 13 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_14,
-           { "DDC 14 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_15,
-           { "DDC 15 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_16,
-           { "DDC 16 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_17,
-           { "DDC 17 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_18,
-           { "DDC 18 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_19,
-           { "DDC 19 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_20,
-           { "DDC 20 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_21,
-           { "DDC 21 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_22,
-           { "DDC 22 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_23,
-           { "DDC 23 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_24,
-           { "DDC 24 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_25,
-           { "DDC 25 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_26,
-           { "DDC 26 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_27,
-           { "DDC 27 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_28,
-           { "DDC 28 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_29,
-           { "DDC 29 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_30,
-           { "DDC 30 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_31,
-           { "DDC 31 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_32,
-           { "DDC 32 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_33,
-           { "DDC 33 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_34,
-           { "DDC 34 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_35,
-           { "DDC 35 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_36,
-           { "DDC 36 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_37,
-           { "DDC 37 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_38,
-           { "DDC 38 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_39,
-           { "DDC 39 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_40,
-           { "DDC 40 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_41,
-           { "DDC 41 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_42,
-           { "DDC 42 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_43,
-           { "DDC 43 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_44,
-           { "DDC 44 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_45,
-           { "DDC 45 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_46,
-           { "DDC 46 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_47,
-           { "DDC 47 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_48,
-           { "DDC 48 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_49,
-           { "DDC 49 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_50,
-           { "DDC 50 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_51,
-           { "DDC 51 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_52,
-           { "DDC 52 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_53,
-           { "DDC 53 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_54,
-           { "DDC 54 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_55,
-           { "DDC 55 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_56,
-           { "DDC 56 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_57,
-           { "DDC 57 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_58,
-           { "DDC 58 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_59,
-           { "DDC 59 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_60,
-           { "DDC 60 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_61,
-           { "DDC 61 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_62,
-           { "DDC 62 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_63,
-           { "DDC 63 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_64,
-           { "DDC 64 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_65,
-           { "DDC 65 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_66,
-           { "DDC 66 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_67,
-           { "DDC 67 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_68,
-           { "DDC 68 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_69,
-           { "DDC 69 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_70,
-           { "DDC 70 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_71,
-           { "DDC 71 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_72,
-           { "DDC 72 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_73,
-           { "DDC 73 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_74,
-           { "DDC 74 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_75,
-           { "DDC 75 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_76,
-           { "DDC 76 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_77,
-           { "DDC 77 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_78,
-           { "DDC 78 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync2_79,
-           { "DDC 79 Synchronized With DDC 2", "openhpsdr-e.cr.ddcc.ddc-sync2-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_0,
-           { "DDC 0 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_1,
-           { "DDC 1 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_2,
-           { "DDC 2 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_3,
-           { "DDC 3 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_4,
-           { "DDC 4 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_5,
-           { "DDC 5 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_6,
-           { "DDC 6 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_7,
-           { "DDC 7 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_8,
-           { "DDC 8 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_9,
-           { "DDC 9 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_10,
-           { "DDC 10 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_11,
-           { "DDC 11 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_12,
-           { "DDC 12 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_13,
-           { "DDC 13 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_14,
-           { "DDC 14 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_15,
-           { "DDC 15 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_16,
-           { "DDC 16 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_17,
-           { "DDC 17 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_18,
-           { "DDC 18 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_19,
-           { "DDC 19 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_20,
-           { "DDC 20 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_21,
-           { "DDC 21 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_22,
-           { "DDC 22 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_23,
-           { "DDC 23 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_24,
-           { "DDC 24 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_25,
-           { "DDC 25 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_26,
-           { "DDC 26 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_27,
-           { "DDC 27 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_28,
-           { "DDC 28 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_29,
-           { "DDC 29 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_30,
-           { "DDC 30 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_31,
-           { "DDC 31 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_32,
-           { "DDC 32 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_33,
-           { "DDC 33 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_34,
-           { "DDC 34 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_35,
-           { "DDC 35 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_36,
-           { "DDC 36 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_37,
-           { "DDC 37 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_38,
-           { "DDC 38 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_39,
-           { "DDC 39 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_40,
-           { "DDC 40 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_41,
-           { "DDC 41 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_42,
-           { "DDC 42 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_43,
-           { "DDC 43 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_44,
-           { "DDC 44 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_45,
-           { "DDC 45 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_46,
-           { "DDC 46 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_47,
-           { "DDC 47 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_48,
-           { "DDC 48 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_49,
-           { "DDC 49 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_50,
-           { "DDC 50 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_51,
-           { "DDC 51 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_52,
-           { "DDC 52 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_53,
-           { "DDC 53 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_54,
-           { "DDC 54 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_55,
-           { "DDC 55 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_56,
-           { "DDC 56 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_57,
-           { "DDC 57 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_58,
-           { "DDC 58 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_59,
-           { "DDC 59 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_60,
-           { "DDC 60 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_61,
-           { "DDC 61 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_62,
-           { "DDC 62 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_63,
-           { "DDC 63 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_64,
-           { "DDC 64 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_65,
-           { "DDC 65 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_66,
-           { "DDC 66 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_67,
-           { "DDC 67 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_68,
-           { "DDC 68 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_69,
-           { "DDC 69 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_70,
-           { "DDC 70 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_71,
-           { "DDC 71 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_72,
-           { "DDC 72 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_73,
-           { "DDC 73 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_74,
-           { "DDC 74 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_75,
-           { "DDC 75 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_76,
-           { "DDC 76 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_77,
-           { "DDC 77 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_78,
-           { "DDC 78 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync3_79,
-           { "DDC 79 Synchronized With DDC 3", "openhpsdr-e.cr.ddcc.ddc-sync3-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_0,
-           { "DDC 0 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_1,
-           { "DDC 1 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_2,
-           { "DDC 2 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_3,
-           { "DDC 3 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_4,
-           { "DDC 4 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_5,
-           { "DDC 5 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_6,
-           { "DDC 6 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_7,
-           { "DDC 7 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_8,
-           { "DDC 8 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_9,
-           { "DDC 9 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_10,
-           { "DDC 10 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_11,
-           { "DDC 11 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_12,
-           { "DDC 12 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_13,
-           { "DDC 13 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_14,
-           { "DDC 14 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_15,
-           { "DDC 15 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_16,
-           { "DDC 16 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_17,
-           { "DDC 17 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_18,
-           { "DDC 18 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_19,
-           { "DDC 19 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_20,
-           { "DDC 20 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_21,
-           { "DDC 21 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_22,
-           { "DDC 22 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_23,
-           { "DDC 23 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_24,
-           { "DDC 24 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_25,
-           { "DDC 25 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_26,
-           { "DDC 26 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_27,
-           { "DDC 27 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_28,
-           { "DDC 28 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_29,
-           { "DDC 29 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_30,
-           { "DDC 30 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_31,
-           { "DDC 31 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_32,
-           { "DDC 32 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_33,
-           { "DDC 33 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_34,
-           { "DDC 34 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_35,
-           { "DDC 35 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_36,
-           { "DDC 36 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_37,
-           { "DDC 37 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_38,
-           { "DDC 38 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_39,
-           { "DDC 39 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_40,
-           { "DDC 40 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_41,
-           { "DDC 41 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_42,
-           { "DDC 42 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_43,
-           { "DDC 43 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_44,
-           { "DDC 44 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_45,
-           { "DDC 45 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_46,
-           { "DDC 46 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_47,
-           { "DDC 47 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_48,
-           { "DDC 48 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_49,
-           { "DDC 49 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_50,
-           { "DDC 50 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_51,
-           { "DDC 51 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_52,
-           { "DDC 52 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_53,
-           { "DDC 53 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_54,
-           { "DDC 54 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_55,
-           { "DDC 55 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_56,
-           { "DDC 56 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_57,
-           { "DDC 57 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_58,
-           { "DDC 58 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_59,
-           { "DDC 59 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_60,
-           { "DDC 60 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_61,
-           { "DDC 61 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_62,
-           { "DDC 62 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_63,
-           { "DDC 63 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_64,
-           { "DDC 64 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_65,
-           { "DDC 65 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_66,
-           { "DDC 66 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_67,
-           { "DDC 67 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_68,
-           { "DDC 68 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_69,
-           { "DDC 69 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_70,
-           { "DDC 70 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_71,
-           { "DDC 71 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_72,
-           { "DDC 72 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_73,
-           { "DDC 73 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_74,
-           { "DDC 74 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_75,
-           { "DDC 75 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_76,
-           { "DDC 76 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_77,
-           { "DDC 77 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_78,
-           { "DDC 78 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync4_79,
-           { "DDC 79 Synchronized With DDC 4", "openhpsdr-e.cr.ddcc.ddc-sync4-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_0,
-           { "DDC 0 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_1,
-           { "DDC 1 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_2,
-           { "DDC 2 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_3,
-           { "DDC 3 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_4,
-           { "DDC 4 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_5,
-           { "DDC 5 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_6,
-           { "DDC 6 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_7,
-           { "DDC 7 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_8,
-           { "DDC 8 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_9,
-           { "DDC 9 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_10,
-           { "DDC 10 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_11,
-           { "DDC 11 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_12,
-           { "DDC 12 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_13,
-           { "DDC 13 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_14,
-           { "DDC 14 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_15,
-           { "DDC 15 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_16,
-           { "DDC 16 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_17,
-           { "DDC 17 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_18,
-           { "DDC 18 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_19,
-           { "DDC 19 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_20,
-           { "DDC 20 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_21,
-           { "DDC 21 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_22,
-           { "DDC 22 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_23,
-           { "DDC 23 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_24,
-           { "DDC 24 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_25,
-           { "DDC 25 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_26,
-           { "DDC 26 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_27,
-           { "DDC 27 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_28,
-           { "DDC 28 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_29,
-           { "DDC 29 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_30,
-           { "DDC 30 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_31,
-           { "DDC 31 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_32,
-           { "DDC 32 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_33,
-           { "DDC 33 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_34,
-           { "DDC 34 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_35,
-           { "DDC 35 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_36,
-           { "DDC 36 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_37,
-           { "DDC 37 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_38,
-           { "DDC 38 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_39,
-           { "DDC 39 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_40,
-           { "DDC 40 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_41,
-           { "DDC 41 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_42,
-           { "DDC 42 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_43,
-           { "DDC 43 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_44,
-           { "DDC 44 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_45,
-           { "DDC 45 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_46,
-           { "DDC 46 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_47,
-           { "DDC 47 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_48,
-           { "DDC 48 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_49,
-           { "DDC 49 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_50,
-           { "DDC 50 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_51,
-           { "DDC 51 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_52,
-           { "DDC 52 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_53,
-           { "DDC 53 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_54,
-           { "DDC 54 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_55,
-           { "DDC 55 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_56,
-           { "DDC 56 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_57,
-           { "DDC 57 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_58,
-           { "DDC 58 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_59,
-           { "DDC 59 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_60,
-           { "DDC 60 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_61,
-           { "DDC 61 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_62,
-           { "DDC 62 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_63,
-           { "DDC 63 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_64,
-           { "DDC 64 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_65,
-           { "DDC 65 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_66,
-           { "DDC 66 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_67,
-           { "DDC 67 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_68,
-           { "DDC 68 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_69,
-           { "DDC 69 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_70,
-           { "DDC 70 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_71,
-           { "DDC 71 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_72,
-           { "DDC 72 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_73,
-           { "DDC 73 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_74,
-           { "DDC 74 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_75,
-           { "DDC 75 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_76,
-           { "DDC 76 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_77,
-           { "DDC 77 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_78,
-           { "DDC 78 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync5_79,
-           { "DDC 79 Synchronized With DDC 5", "openhpsdr-e.cr.ddcc.ddc-sync5-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_0,
-           { "DDC 0 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_1,
-           { "DDC 1 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_2,
-           { "DDC 2 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_3,
-           { "DDC 3 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_4,
-           { "DDC 4 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_5,
-           { "DDC 5 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_6,
-           { "DDC 6 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_7,
-           { "DDC 7 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_8,
-           { "DDC 8 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_9,
-           { "DDC 9 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_10,
-           { "DDC 10 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_11,
-           { "DDC 11 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_12,
-           { "DDC 12 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_13,
-           { "DDC 13 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_14,
-           { "DDC 14 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_15,
-           { "DDC 15 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_16,
-           { "DDC 16 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_17,
-           { "DDC 17 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_18,
-           { "DDC 18 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_19,
-           { "DDC 19 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_20,
-           { "DDC 20 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_21,
-           { "DDC 21 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_22,
-           { "DDC 22 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_23,
-           { "DDC 23 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_24,
-           { "DDC 24 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_25,
-           { "DDC 25 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_26,
-           { "DDC 26 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_27,
-           { "DDC 27 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_28,
-           { "DDC 28 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_29,
-           { "DDC 29 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_30,
-           { "DDC 30 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_31,
-           { "DDC 31 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_32,
-           { "DDC 32 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_33,
-           { "DDC 33 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_34,
-           { "DDC 34 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_35,
-           { "DDC 35 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_36,
-           { "DDC 36 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_37,
-           { "DDC 37 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_38,
-           { "DDC 38 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_39,
-           { "DDC 39 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_40,
-           { "DDC 40 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_41,
-           { "DDC 41 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_42,
-           { "DDC 42 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_43,
-           { "DDC 43 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_44,
-           { "DDC 44 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_45,
-           { "DDC 45 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_46,
-           { "DDC 46 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_47,
-           { "DDC 47 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_48,
-           { "DDC 48 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_49,
-           { "DDC 49 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_50,
-           { "DDC 50 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_51,
-           { "DDC 51 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_52,
-           { "DDC 52 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_53,
-           { "DDC 53 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_54,
-           { "DDC 54 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_55,
-           { "DDC 55 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_56,
-           { "DDC 56 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_57,
-           { "DDC 57 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_58,
-           { "DDC 58 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_59,
-           { "DDC 59 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_60,
-           { "DDC 60 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_61,
-           { "DDC 61 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_62,
-           { "DDC 62 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_63,
-           { "DDC 63 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_64,
-           { "DDC 64 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_65,
-           { "DDC 65 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_66,
-           { "DDC 66 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_67,
-           { "DDC 67 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_68,
-           { "DDC 68 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_69,
-           { "DDC 69 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_70,
-           { "DDC 70 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_71,
-           { "DDC 71 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_72,
-           { "DDC 72 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_73,
-           { "DDC 73 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_74,
-           { "DDC 74 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_75,
-           { "DDC 75 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_76,
-           { "DDC 76 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_77,
-           { "DDC 77 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_78,
-           { "DDC 78 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync6_79,
-           { "DDC 79 Synchronized With DDC 6", "openhpsdr-e.cr.ddcc.ddc-sync6-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_0,
-           { "DDC 0 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_1,
-           { "DDC 1 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_2,
-           { "DDC 2 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_3,
-           { "DDC 3 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_4,
-           { "DDC 4 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_5,
-           { "DDC 5 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_6,
-           { "DDC 6 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_7,
-           { "DDC 7 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_8,
-           { "DDC 8 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_9,
-           { "DDC 9 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-9",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_10,
-           { "DDC 10 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-10",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_11,
-           { "DDC 11 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-11",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_12,
-           { "DDC 12 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-12",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_13,
-           { "DDC 13 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-13",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_14,
-           { "DDC 14 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-14",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_15,
-           { "DDC 15 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-15",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_16,
-           { "DDC 16 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-16",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_17,
-           { "DDC 17 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-17",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_18,
-           { "DDC 18 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-18",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_19,
-           { "DDC 19 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-19",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_20,
-           { "DDC 20 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-20",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_21,
-           { "DDC 21 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-21",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_22,
-           { "DDC 22 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-22",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_23,
-           { "DDC 23 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-23",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_24,
-           { "DDC 24 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-24",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_25,
-           { "DDC 25 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-25",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_26,
-           { "DDC 26 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-26",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_27,
-           { "DDC 27 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-27",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_28,
-           { "DDC 28 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-28",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_29,
-           { "DDC 29 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-29",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_30,
-           { "DDC 30 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-30",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_31,
-           { "DDC 31 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-31",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_32,
-           { "DDC 32 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-32",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_33,
-           { "DDC 33 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-33",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_34,
-           { "DDC 34 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-34",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_35,
-           { "DDC 35 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-35",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_36,
-           { "DDC 36 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-36",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_37,
-           { "DDC 37 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-37",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_38,
-           { "DDC 38 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-38",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_39,
-           { "DDC 39 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-39",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_40,
-           { "DDC 40 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-40",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_41,
-           { "DDC 41 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-41",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_42,
-           { "DDC 42 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-42",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_43,
-           { "DDC 43 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-43",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_44,
-           { "DDC 44 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-44",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_45,
-           { "DDC 45 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-45",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_46,
-           { "DDC 46 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-46",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_47,
-           { "DDC 47 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-47",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_48,
-           { "DDC 48 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-48",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_49,
-           { "DDC 49 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-49",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_50,
-           { "DDC 50 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-50",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_51,
-           { "DDC 51 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-51",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_52,
-           { "DDC 52 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-52",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_53,
-           { "DDC 53 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-53",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_54,
-           { "DDC 54 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-54",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_55,
-           { "DDC 55 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-55",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_56,
-           { "DDC 56 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-56",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_57,
-           { "DDC 57 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-57",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_58,
-           { "DDC 58 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-58",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_59,
-           { "DDC 59 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-59",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_60,
-           { "DDC 60 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-60",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_61,
-           { "DDC 61 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-61",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_62,
-           { "DDC 62 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-62",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_63,
-           { "DDC 63 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-63",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_64,
-           { "DDC 64 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-64",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_65,
-           { "DDC 65 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-65",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_66,
-           { "DDC 66 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-66",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_67,
-           { "DDC 67 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-67",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_68,
-           { "DDC 68 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-68",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_69,
-           { "DDC 69 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-69",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_70,
-           { "DDC 70 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-70",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_71,
-           { "DDC 71 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-71",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_72,
-           { "DDC 72 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-72",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_73,
-           { "DDC 73 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-73",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_74,
-           { "DDC 74 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-74",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_75,
-           { "DDC 75 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-75",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_76,
-           { "DDC 76 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-76",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_77,
-           { "DDC 77 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-77",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_78,
-           { "DDC 78 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-78",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddcc_ddc_sync7_79,
-           { "DDC 79 Synchronized With DDC 7", "openhpsdr-e.cr.ddcc.ddc-sync7-79",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off),BOOLEAN_B7,
-             NULL, HFILL }
-       },
-   };
-
-    // High Priority Status Field Arrary
-    static hf_register_info hf_hps[] = {
-       { &hf_openhpsdr_e_hps_banner,
-           { "openHPSDR Ethernet - High Priority Status" , "openhpsdr-e.hps.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_sequence_num,
-           { "Sequence Number", "openhpsdr-e.hps.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_ptt,
-           { "       PTT", "openhpsdr-e.hps.ptt",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive),BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_dot,
-           { "       Dot", "openhpsdr-e.hps.dot",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive),BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_dash,
-           { "      Dash", "openhpsdr-e.hps.dash",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_empty,
-           { "     Empty", "openhpsdr-e.hps.empty",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             NULL, BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_pll,
-           { "       PLL", "openhpsdr-e.hps.pll",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&lock_unlock), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       // Remove at some point ?
-       // 3.7 - No longer supported
-       { &hf_openhpsdr_e_hps_fifo_empty,
-           { "FIFO Empty", "openhpsdr-e.hps.fifo-empty",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       // Remove at some point ?
-       // 3.7 - No longer supported
-       { &hf_openhpsdr_e_hps_fifo_full,
-           { "FIFO  Full", "openhpsdr-e.hps.fifo-full",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc0_ol,
-           { "ADC 0 Overload", "openhpsdr-e.hps.adc0-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc1_ol,
-           { "ADC 1 Overload", "openhpsdr-e.hps.adc1-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc2_ol,
-           { "ADC 2 Overload", "openhpsdr-e.hps.adc2-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc3_ol,
-           { "ADC 3 Overload", "openhpsdr-e.hps.adc3-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc4_ol,
-           { "ADC 4 Overload", "openhpsdr-e.hps.adc4-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc5_ol,
-           { "ADC 5 Overload", "openhpsdr-e.hps.adc5-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc6_ol,
-           { "ADC 6 Overload", "openhpsdr-e.hps.adc6-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_adc7_ol,
-           { "ADC 7 Overload", "openhpsdr-e.hps.adc7-ol",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_ex_power0,
-           { "Exciter Power 0" , "openhpsdr-e.hps.ex-power0",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_ex_power1,
-           { "Exciter Power 1" , "openhpsdr-e.hps.ex-power1",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_ex_power2,
-           { "Exciter Power 2" , "openhpsdr-e.hps.ex-power2",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_ex_power3,
-           { "Exciter Power 3" , "openhpsdr-e.hps.ex-power3",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_fp_alex0,
-           { "Forward Power - Alex 0  " , "openhpsdr-e.hps.fp-alex0",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_fp_alex1,
-           { "Forward Power - Alex 1  " , "openhpsdr-e.hps.fp-alex1",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_fp_alex2,
-           { "Forward Power - Alex 2  " , "openhpsdr-e.hps.fp-alex2",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_fp_alex3,
-           { "Forward Power - Alex 3  " , "openhpsdr-e.hps.fp-alex3",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_rp_alex0,
-           { "Reverse Power - Alex 0  " , "openhpsdr-e.hps.rp-alex0",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_rp_alex1,
-           { "Reverse Power - Alex 1  " , "openhpsdr-e.hps.rp-alex1",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_rp_alex2,
-           { "Reverse Power - Alex 2  " , "openhpsdr-e.hps.rp-alex2",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_rp_alex3,
-           { "Reverse Power - Alex 3  " , "openhpsdr-e.hps.rp-alex3",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_supp_vol,
-           { "Supply Voltage          " , "openhpsdr-e.hps.supply-volt",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_adc3,
-           { "User ADC 3              " , "openhpsdr-e.hps.user-adc3",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_adc2,
-           { "User ADC 2              " , "openhpsdr-e.hps.user-adc2",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_adc1,
-           { "User ADC 1              " , "openhpsdr-e.hps.user-adc1",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_adc0,
-           { "User ADC 0              " , "openhpsdr-e.hps.user-adc0",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_io4,
-           { "IO4 Input   ", "openhpsdr-e.hps.io4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_io5,
-           { "IO5 Input   ", "openhpsdr-e.hps.io5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_io6,
-           { "IO6 Input   ", "openhpsdr-e.hps.io6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_io8,
-           { "IO8 Input   ", "openhpsdr-e.hps.io8",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_io2,
-           { "IO2 Input   ", "openhpsdr-e.hps.io2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_logic5,
-           { "User Logic 5", "openhpsdr-e.hps.user-logic5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_logic6,
-           { "User Logic 6", "openhpsdr-e.hps.user-logic6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hps_user_logic7,
-           { "User Logic 7", "openhpsdr-e.hps.user-logic7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_set_notset), BOOLEAN_B7,
-             NULL, HFILL }
-       },
-
-   };
-
-    // DUC Command Field Arrary
-    static hf_register_info hf_ducc[] = {
-       { &hf_openhpsdr_e_ducc_banner,
-           { "openHPSDR Ethernet - DUC Command" , "openhpsdr-e.ducc.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_sequence_num,
-           { "Sequence Number", "openhpsdr-e.ducc.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_dac_num,
-           { "Harware number of DAC        " , "openhpsdr-e.ducc.dac-num",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_eer,
-           { "              EER", "openhpsdr-e.ducc.eer",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw,
-           { "               CW", "openhpsdr-e.ducc.cw",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_rev_cw,
-           { "       Reverse CW", "openhpsdr-e.ducc.rev-cw",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_iambic,
-           { "           Iambic", "openhpsdr-e.ducc.iambic",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_sidetone,
-           { "     CW Side Tone", "openhpsdr-e.ducc.sidetone",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_mode_b,
-           { "        CW Mode B", "openhpsdr-e.ducc.cw-mode-b",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_st_char_space,
-           { "CW Strict Spacing", "openhpsdr-e.ducc.cw-st-space",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_breakin,
-           { "      CW Break In", "openhpsdr-e.ducc.cw-break-in",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B7,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_sidetone_level,
-           { "CW Sidetone Level    " , "openhpsdr-e.ducc.cw-sidetone-level",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_sidetone_freq,
-           { "CW Sidetone Frequency" , "openhpsdr-e.ducc.cw-sidetone-freq",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_keyer_speed,
-           { "CW Keyer Speed       " , "openhpsdr-e.ducc.cw-keyer-speed",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_keyer_weight,
-           { "CW Keyer Weight      " , "openhpsdr-e.ducc.cw-keyer-weight",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_cw_hang_delay,
-           { "CW Hang Delay        " , "openhpsdr-e.ducc.cw-hang-delay",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_rf_delay,
-           { "RF Delay             " , "openhpsdr-e.ducc.rf-delay",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_duc0_sample,
-           { "DUC 0 Sample Rate    " , "openhpsdr-e.ducc.duc0-sample",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_duc0_bits,
-           { "DUC 0 I&Q Sample Size" , "openhpsdr-e.ducc.duc0-bits",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_duc0_phase_shift,
-           { "DUC 0 Sample Rate    " , "openhpsdr-e.ducc.duc0-phase-shift",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_line_in,
-           { "             Line In", "openhpsdr-e.ducc.line-in",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_mic_boost,
-           { "           Mic Boost", "openhpsdr-e.ducc.mic-boost",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_on_off), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_orion_mic_ptt,
-           { "       Orion Mic PTT", "openhpsdr-e.ducc.orion-mic-ptt",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_disabled_enabled), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_orion_mic_ring_tip,
-           { "Orion Mic Tip & Ring", "openhpsdr-e.ducc.orion-mic-tip-ring",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&orion_tip_ring), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_orion_mic_bias,
-           { "      Orion Mic Bias", "openhpsdr-e.ducc.sidetone",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_line_in_gain,
-           { "Line IN Gain                    " , "openhpsdr-e.ducc.line-in-gain",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ducc_attn_adc0_duc0,
-           { "ADC 0 Step Attenuator on DUC 0  " , "openhpsdr-e.ducc.attn-adc0-duc0",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
-
-    // MICL Command Field Arrary
-    static hf_register_info hf_micl[] = {
-       { &hf_openhpsdr_e_micl_banner,
-           { "openHPSDR Ethernet - MIC / Line Samples" , "openhpsdr-e.micl.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_micl_sequence_num,
-           { "Sequence Number", "openhpsdr-e.micl.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_micl_separator,
-           { "MIC / Line Sample Separator" , "openhpsdr-e.micl.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_micl_sample_idx,
-           { "Sample Index", "openhpsdr-e.micl.sample-idx",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_micl_sample,
-           { "Mic / Line In Sample From Hardware", "openhpsdr-e.micl.sample",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
-
-    // High Priority Command Field Arrary
-    static hf_register_info hf_hpc[] = {
-       { &hf_openhpsdr_e_hpc_banner,
-           { "openHPSDR Ethernet - High Priority Command" , "openhpsdr-e.hpc.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_sequence_num,
-           { "Sequence Number", "openhpsdr-e.hpc.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_run,
-           { "    Run", "openhpsdr-e.hpc.run",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_disabled_enabled), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_ptt0,
-           { "  PPT 0", "openhpsdr-e.hpc.ptt0",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_ptt1,
-           { "  PPT 1", "openhpsdr-e.hpc.ptt1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_ptt2,
-           { "  PPT 2", "openhpsdr-e.hpc.ptt2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_ptt3,
-           { "  PPT 3", "openhpsdr-e.hpc.ptt3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx0_sub,
-           { "CWX0 Submenu" , "openhpsdr-e.hpc.cwx0-sub",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx0_cwx,
-           { "CWX ", "openhpsdr-e.hpc.cwx0-cwx",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&host_hardware), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx0_dot,
-           { "Dot ", "openhpsdr-e.hpc.cwx0-dot",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx0_dash,
-           { "Dash", "openhpsdr-e.hpc.cwx0-dash",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_active_inactive), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx1,
-           { "CWX1               " , "openhpsdr-e.hpc.cwx1",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx2,
-           { "CWX2               " , "openhpsdr-e.hpc.cwx2",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_cwx3,
-           { "CWX3               " , "openhpsdr-e.hpc.cwx3",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_ddc_fp_sub,
-           { "DDC  Frequency / Phase Word Submenu" , "openhpsdr-e.hpc.sync-sub",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc0,
-           { "DDC  0 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc0",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc1,
-           { "DDC  1 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc1",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc2,
-           { "DDC  2 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc2",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc3,
-           { "DDC  3 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc3",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc4,
-           { "DDC  4 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc4",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc5,
-           { "DDC  5 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc5",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc6,
-           { "DDC  6 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc6",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc7,
-           { "DDC  7 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc7",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc8,
-           { "DDC  8 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc8",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc9,
-           { "DDC  9 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc9",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc10,
-           { "DDC 10 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc10",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc11,
-           { "DDC 11 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc11",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc12,
-           { "DDC 12 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc12",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc13,
-           { "DDC 13 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc13",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc14,
-           { "DDC 14 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc14",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc15,
-           { "DDC 15 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc15",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc16,
-           { "DDC 16 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc16",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc17,
-           { "DDC 17 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc17",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc18,
-           { "DDC 18 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc18",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc19,
-           { "DDC 19 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc19",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc20,
-           { "DDC 20 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc20",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc21,
-           { "DDC 21 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc21",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc22,
-           { "DDC 22 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc22",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc23,
-           { "DDC 23 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc23",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc24,
-           { "DDC 24 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc24",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc25,
-           { "DDC 25 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc25",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc26,
-           { "DDC 26 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc26",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc27,
-           { "DDC 27 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc27",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc28,
-           { "DDC 28 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc28",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc29,
-           { "DDC 29 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc29",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc30,
-           { "DDC 30 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc30",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc31,
-           { "DDC 31 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc31",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc32,
-           { "DDC 32 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc32",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc33,
-           { "DDC 33 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc33",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc34,
-           { "DDC 34 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc34",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc35,
-           { "DDC 35 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc35",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc36,
-           { "DDC 36 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc36",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc37,
-           { "DDC 37 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc37",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc38,
-           { "DDC 38 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc38",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc39,
-           { "DDC 39 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc39",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc40,
-           { "DDC 40 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc40",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc41,
-           { "DDC 41 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc41",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc42,
-           { "DDC 42 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc42",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc43,
-           { "DDC 43 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc43",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc44,
-           { "DDC 44 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc44",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc45,
-           { "DDC 45 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc45",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc46,
-           { "DDC 46 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc46",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc47,
-           { "DDC 47 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc47",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc48,
-           { "DDC 48 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc48",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc49,
-           { "DDC 49 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc49",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc50,
-           { "DDC 50 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc50",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc51,
-           { "DDC 51 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc51",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc52,
-           { "DDC 52 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc52",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc53,
-           { "DDC 53 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc53",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc54,
-           { "DDC 54 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc54",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc55,
-           { "DDC 55 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc55",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc56,
-           { "DDC 56 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc56",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc57,
-           { "DDC 57 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc57",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc58,
-           { "DDC 58 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc58",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc59,
-           { "DDC 59 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc59",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc60,
-           { "DDC 60 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc60",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc61,
-           { "DDC 61 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc61",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc62,
-           { "DDC 62 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc62",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc63,
-           { "DDC 63 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc63",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc64,
-           { "DDC 64 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc64",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc65,
-           { "DDC 65 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc65",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc66,
-           { "DDC 66 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc66",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc67,
-           { "DDC 67 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc67",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc68,
-           { "DDC 68 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc68",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc69,
-           { "DDC 69 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc69",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc70,
-           { "DDC 70 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc70",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc71,
-           { "DDC 71 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc71",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc72,
-           { "DDC 72 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc72",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc73,
-           { "DDC 73 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc73",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc74,
-           { "DDC 74 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc74",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc75,
-           { "DDC 75 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc75",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc76,
-           { "DDC 76 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc76",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc77,
-           { "DDC 77 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc77",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc78,
-           { "DDC 78 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc78",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_ddc79,
-           { "DDC 79 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-ddc79",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_duc0,
-           { "DUC 0 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc0",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_duc1,
-           { "DUC 1 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc1",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_duc2,
-           { "DUC 2 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc2",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_freq_phase_duc3,
-           { "DUC 3 Frequency / Phase Word", "openhpsdr-e.hpc.freq-phase-duc3",
-            FT_UINT32, BASE_DEC,
-            NULL,ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_drive_duc0,
-           { "DUC 0 Drive Level           " , "openhpsdr-e.hpc.duc0-drive",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_drive_duc1,
-           { "DUC 1 Drive Level           " , "openhpsdr-e.hpc.duc1-drive",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_drive_duc2,
-           { "DUC 2 Drive Level           " , "openhpsdr-e.hpc.duc2-drive",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_drive_duc3,
-           { "DUC 3 Drive Level           " , "openhpsdr-e.hpc.duc3-drive",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_orion2_xvtr,
-           { "Orion MkII - Transverter" , "openhpsdr-e.hpc.orion2-xvtr",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_orion2_IO1,
-           { "Orion MkII - IO1 Audio  " , "openhpsdr-e.hpc.orion2-io1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&orion2_IO1), BOOLEAN_B1,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col1,
-           { "Open Collector Out 1", "openhpsdr-e.hpc.open-col1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col2,
-           { "Open Collector Out 2", "openhpsdr-e.hpc.open-col2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col3,
-           { "Open Collector Out 3", "openhpsdr-e.hpc.open-col3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col4,
-           { "Open Collector Out 4", "openhpsdr-e.hpc.open-col4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col5,
-           { "Open Collector Out 5", "openhpsdr-e.hpc.open-col5",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B4,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col6,
-           { "Open Collector Out 6", "openhpsdr-e.hpc.open-col6",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B5,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_open_col7,
-           { "Open Collector Out 7", "openhpsdr-e.hpc.open-col7",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B6,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_db9_out1,
-           { "Metis DB9 pin 1", "openhpsdr-e.hpc.db9-1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_db9_out2,
-           { "Metis DB9 pin 2", "openhpsdr-e.hpc.db9-2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_db9_out3,
-           { "Metis DB9 pin 3", "openhpsdr-e.hpc.db9-3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_db9_out4,
-           { "Metis DB9 pin 4", "openhpsdr-e.hpc.db9-4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_merc_att1,
-           { "Mercury 1 20dB Attenuate", "openhpsdr-e.hpc.merc_att1",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B0,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_merc_att2,
-           { "Mercury 2 20dB Attenuate", "openhpsdr-e.hpc.merc_att2",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B1,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_merc_att3,
-           { "Mercury 3 20dB Attenuate", "openhpsdr-e.hpc.merc_att3",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B2,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_merc_att4,
-           { "Mercury 4 20dB Attenuate", "openhpsdr-e.hpc.merc_att4",
-             FT_BOOLEAN, BOOLEAN_MASK,
-             TFS(&local_enabled_disabled), BOOLEAN_B3,
-             NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex7,
-           { "Alex 7" , "openhpsdr-e.hpc.alex7",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex6,
-           { "Alex 6" , "openhpsdr-e.hpc.alex6",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex5,
-           { "Alex 5" , "openhpsdr-e.hpc.alex5",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex4,
-           { "Alex 4" , "openhpsdr-e.hpc.alex4",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex3,
-           { "Alex 3" , "openhpsdr-e.hpc.alex3",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex2,
-           { "Alex 2" , "openhpsdr-e.hpc.alex2",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex1,
-           { "Alex 1" , "openhpsdr-e.hpc.alex1",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_sub,
-           { "Alex 0 Submenu" , "openhpsdr-e.ddcc.alex0-sub",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_17_15,
-           { "Alex 0 -  17-15m LPF" , "openhpsdr-e.hpc.alex0-lpf_17-15",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_12_10,
-           { "Alex 0 -  12-10m LPF" , "openhpsdr-e.hpc.alex0-lpf_12-10",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_6m_bypass,
-           { "Alex 0 - 6M / Bypass" , "openhpsdr-e.hpc.alex0-6m-bypass",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_red_led1,
-           { "Alex 0 -   Red LED 1" , "openhpsdr-e.hpc.alex0-red_led1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_tx_rx,
-           { "Alex 0 -     TX / RX" , "openhpsdr-e.hpc.alex0-tx_rx",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ant3,
-           { "Alex 0 -   Antenna 3" , "openhpsdr-e.hpc.alex0-ant3",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ant2,
-           { "Alex 0 -   Antenna 2" , "openhpsdr-e.hpc.alex0-ant2",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ant1,
-           { "Alex 0 -   Antenna 1" , "openhpsdr-e.hpc.alex0-ant1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_160,
-           { "Alex 0 -    160m LPF" , "openhpsdr-e.hpc.alex0-lpf_160",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_80,
-           { "Alex 0 -     80m LPF" , "openhpsdr-e.hpc.alex0-lpf_80",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_60_40,
-           { "Alex 0 -  60-40m LPF" , "openhpsdr-e.hpc.alex0-lpf_60-40",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_lpf_30_20,
-           { "Alex 0 -  30-20m LPF" , "openhpsdr-e.hpc.alex0-lpf_30-20",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_yel_led1,
-           { "Alex 0 - Yellow LED1" , "openhpsdr-e.hpc.alex0-yel_led1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
-       },
-      { &hf_openhpsdr_e_hpc_alex0_orion2_txrx,
-           { "Alex 0 - Orion2 TxRx" , "openhpsdr-e.hpc.alex0-orion2-txrx",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_red_led0,
-           { "Alex 0 -   Red LED 0" , "openhpsdr-e.hpc.alex0-red_led0",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B7,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_att_10,
-           { "Alex 0 - Atten. 10dB" , "openhpsdr-e.hpc.alex0-att_10",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_att_20,
-           { "Alex 0 - Atten. 20dB" , "openhpsdr-e.hpc.alex0-att_20",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hf_bypass,
-           { "Alex 0 -   HF Bypass" , "openhpsdr-e.hpc.alex0-hf-bypass",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_bypass,
-           { "Alex 0 -      Bypass" , "openhpsdr-e.hpc.alex0-bypass",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ext2,
-           { "Alex 0 -       Ext 2" , "openhpsdr-e.hpc.alex0-ext2",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ext1,
-           { "Alex 0 -       Ext 1" , "openhpsdr-e.hpc.alex0-ext1",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_ddc_xvtr_in,
-           { "Alex 0 - DDC XVTR In" , "openhpsdr-e.hpc.alex0-ddc-xvtr-in",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hpf_1_5,
-           { "Alex 0 - 1.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_1-5",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B6,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hpf_6_5,
-           { "Alex 0 - 6.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_6-5",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B5,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hpf_9_5,
-           { "Alex 0 - 9.5 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_9-5",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B4,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_6m_amp,
-           { "Alex 0 -      6M Amp" , "openhpsdr-e.hpc.alex0-6m-amp",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B3,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hpf_20,
-           { "Alex 0 -  20 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_20",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B2,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_hpf_13,
-           { "Alex 0 -  13 MHZ HPF" , "openhpsdr-e.hpc.alex0-hpf_13",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B1,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_alex0_yel_led0,
-           { "Alex 0 - Yellow LED0" , "openhpsdr-e.hpc.alex0-yel_led0",
-            FT_BOOLEAN, BOOLEAN_MASK,
-            TFS(&local_enabled_disabled), BOOLEAN_B0,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att7,
-           { "Step Atten. 7" , "openhpsdr-e.hpc.att7",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att6,
-           { "Step Atten. 6" , "openhpsdr-e.hpc.att6",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att5,
-           { "Step Atten. 5" , "openhpsdr-e.hpc.att5",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att4,
-           { "Step Atten. 4" , "openhpsdr-e.hpc.att4",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att3,
-           { "Step Atten. 3" , "openhpsdr-e.hpc.att3",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att2,
-           { "Step Atten. 2" , "openhpsdr-e.hpc.att2",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att1,
-           { "Step Atten. 1" , "openhpsdr-e.hpc.att1",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_hpc_att0,
-           { "Step Atten. 0" , "openhpsdr-e.hpc.att0",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
+       { &hf_openhpsdr_e_mem_data,
+           { "Memory Data       ", "openhpsdr-e.mem.data",
+            FT_UINT16, BASE_HEX,
+            NULL, ZERO_MASK,
+            NULL, HFILL }
        },
    };
 
-    // Wide Band Data Field Arrary
-    static hf_register_info hf_wbd[] = {
-       { &hf_openhpsdr_e_wbd_banner,
-           { "openHPSDR Ethernet - Wide Band Data" , "openhpsdr-e.wbd.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_wbd_sequence_num,
-           { "Sequence Number", "openhpsdr-e.wbd.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_wbd_adc,
-           { "Wide Band ADC" , "openhpsdr-e.wbd.adc",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_wbd_separator,
-           { "Wide Band Data Sample Separator" , "openhpsdr-e.wbd.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_wbd_sample_idx,
-           { "Sample Index", "openhpsdr-e.wbd.sample-idx",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_wbd_sample,
-           { "Wide Band Sample From Hardware", "openhpsdr-e.wbd.sample",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
+   proto_openhpsdr_e = proto_register_protocol (
+       "OpenHPSDR Ethernet - Protocol 2", // name
+       "HPSDR-ETH_P2",                    // short name
+       "hpsdr-e"                          // abbrev
+   );
+
+   // Register the arrays
+   proto_register_field_array(proto_openhpsdr_e, hf, array_length(hf));
+   proto_register_field_array(proto_openhpsdr_e, hf_samples, array_length(hf_samples));
+   proto_register_field_array(proto_openhpsdr_e, hf_seq, array_length(hf_seq));
+   proto_register_field_array(proto_openhpsdr_e, hf_config, array_length(hf_config));
+   proto_register_field_array(proto_openhpsdr_e, hf_delta, array_length(hf_delta));
+   proto_register_field_array(proto_openhpsdr_e, hf_ts, array_length(hf_ts));
+   proto_register_field_array(proto_openhpsdr_e, hf_rate, array_length(hf_rate));
+   proto_register_field_array(proto_openhpsdr_e, hf_budget, array_length(hf_budget));
+   proto_register_field_array(proto_openhpsdr_e, hf_iat, array_length(hf_iat));
+   proto_register_field_array(proto_openhpsdr_e, hf_ddciq_stats, array_length(hf_ddciq_stats));
+   proto_register_field_array(proto_openhpsdr_e, hf_duciq_stats, array_length(hf_duciq_stats));
+   proto_register_field_array(proto_openhpsdr_e, hf_wb, array_length(hf_wb));
+   proto_register_field_array(proto_openhpsdr_e, hf_pacing, array_length(hf_pacing));
+   proto_register_field_array(proto_openhpsdr_e, hf_fifo, array_length(hf_fifo));
+   proto_register_field_array(proto_openhpsdr_e, hf_tx, array_length(hf_tx));
+   proto_register_field_array(proto_openhpsdr_e, hf_cw, array_length(hf_cw));
+   proto_register_field_array(proto_openhpsdr_e, hf_cr, array_length(hf_cr));
+   proto_register_field_array(proto_openhpsdr_e, hf_ddcc, array_length(hf_ddcc));
+   proto_register_field_array(proto_openhpsdr_e, hf_hps, array_length(hf_hps));
+   proto_register_field_array(proto_openhpsdr_e, hf_ducc, array_length(hf_ducc));
+   proto_register_field_array(proto_openhpsdr_e, hf_micl, array_length(hf_micl));
+   proto_register_field_array(proto_openhpsdr_e, hf_hpc, array_length(hf_hpc));
+   proto_register_field_array(proto_openhpsdr_e, hf_wbd, array_length(hf_wbd));
+   proto_register_field_array(proto_openhpsdr_e, hf_ddca, array_length(hf_ddca));
+   proto_register_field_array(proto_openhpsdr_e, hf_duciq, array_length(hf_duciq));
+   proto_register_field_array(proto_openhpsdr_e, hf_ddciq, array_length(hf_ddciq));
+   proto_register_field_array(proto_openhpsdr_e, hf_mem, array_length(hf_mem));
+   openhpsdr_e_register_indexed_fields();
+
+   proto_register_subtree_array(ett, array_length(ett));
+
+   // Required function calls to register expert items
+   expert_openhpsdr_e_cr = expert_register_protocol(proto_openhpsdr_e);
+   expert_register_field_array(expert_openhpsdr_e_cr, ei_cr, array_length(ei_cr));
+
+    //Register configuration preferences
+   openhpsdr_e_prefs = prefs_register_protocol(proto_openhpsdr_e,NULL);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"strict_size",
+       "Strict Checking of Datagram Size",
+       "Disable checking for added bytes at the end of the datagrams."
+       " Disables the warning message.",
+       &openhpsdr_e_strict_size);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"strict_pad",
+       "Strict Pad Checking",
+       "Strict checking of the amount of pad bytes at the end of the datagrams."
+       " When enabled, Wireshark (not the openHPSDR dissector) will display"
+       " a \"Malformed Packet\" error for a datagram without the correct"
+       " number of pad bytes."
+       " When disabled, checking is only for one pad byte instead of checking"
+       " for the correct number of pad bytes.",
+       &openhpsdr_e_strict_pad);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"ddciq_iq_mtu_check",
+       "DDC I&Q Samples MTU Check (DDCIQ)",
+       "Check to see if the number of I&Q Samples"
+       " will exceed the MTU (the IP MTU preference)."
+       " When disabled, there will be no checking"
+       " to see if the MTU will be exceeded.",
+       &openhpsdr_e_ddciq_mtu_check);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"mtu",
+       "IP MTU (Bytes)",
+       "The largest IP datagram (IP header, UDP header and data) of the link"
+       " used by the DDC I&Q MTU check. 1500 for standard Ethernet,"
+       " 9000 for jumbo frames.",
+       10, &openhpsdr_e_mtu);
+
+   prefs_register_enum_preference(openhpsdr_e_prefs,"export_format",
+       "DDC I&Q Export Format",
+       "Write the DDC I&Q samples of every DDC to its own file in the export"
+       " directory while the capture is read. WAV and SigMF need a DDC Command"
+       " in the capture for the sample rate.",
+       &openhpsdr_e_export_format, export_format_vals, FALSE);
+
+   prefs_register_directory_preference(openhpsdr_e_prefs,"export_dir",
+       "DDC I&Q Export Directory",
+       "The directory of the DDC I&Q, audio and telemetry export files.",
+       &openhpsdr_e_export_dir);
+
+   prefs_register_enum_preference(openhpsdr_e_prefs,"export_gaps",
+       "DDC I&Q Export Lost Datagrams",
+       "Zero fill the samples of lost DDC I&Q datagrams, or leave them out."
+       " SigMF files annotate every gap.",
+       &openhpsdr_e_export_gaps, export_gaps_vals, FALSE);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"wb_spectrum",
+       "Wide Band Spectrum Analysis",
+       "Put the consecutive wide band datagrams of each ADC into FFT frames and"
+       " add the noise floor, the strongest spurs and the overload statistics"
+       " to the datagram that completes a frame. Done on the first pass.",
+       &openhpsdr_e_wb_spectrum);
+
+   prefs_register_directory_preference(openhpsdr_e_prefs,"wb_spectrum_dir",
+       "Wide Band Spectrum CSV Directory",
+       "Write a waterfall CSV (one row per spectrum frame) and an average"
+       " spectrum CSV for each ADC to this directory. Empty for none.",
+       &openhpsdr_e_wb_spectrum_dir);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"export_audio",
+       "Mic / Line and DDC Audio Export",
+       "Write the Mic / Line samples (micl_SSS.wav) and the DDC Audio samples"
+       " (ddca_SSS.wav) to 16 bit 48 kHz WAV files in the DDC I&Q export"
+       " directory. Lost datagrams are written as silence.",
+       &openhpsdr_e_audio_wav);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"pacing_buffer",
+       "Audio Pacing Jitter Buffer (mS)",
+       "The jitter buffer of the Mic / Line and DDC Audio pacing analysis."
+       " A datagram later than this is an under-run, one earlier than twice"
+       " this is an over-run.",
+       10, &openhpsdr_e_pacing_buffer);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"duc_fifo",
+       "DUC FIFO Size (Samples)",
+       "The DUC I&Q FIFO of the hardware for the DUC FIFO model. The DUC"
+       " starts taking samples when the FIFO is half full.",
+       10, &openhpsdr_e_duc_fifo);
+
+   prefs_register_enum_preference(openhpsdr_e_prefs,"telemetry_format",
+       "Telemetry Export Format",
+       "Write the High Priority Status power, SWR and supply voltage of each"
+       " radio to a time series file (telem_<radio>_SSS) in the DDC I&Q"
+       " export directory, one row per telemetry interval.",
+       &openhpsdr_e_telem_format, telem_format_vals, FALSE);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"telemetry_interval",
+       "Telemetry Export Interval (mS)",
+       "The High Priority Status datagrams of each interval are combined into"
+       " one row (average, largest, lowest). 0 writes every datagram.",
+       10, &openhpsdr_e_telem_interval);
+
+   prefs_register_enum_preference(openhpsdr_e_prefs,"sample_display",
+       "Sample Block Display",
+       "How the samples of the DDC I&Q, Wide Band, Mic / Line, DDC Audio,"
+       " DUC I&Q and Memory Mapped datagrams are displayed."
+       " Full adds three items for every sample."
+       " Compact adds one summary item (count, bits, minimum, maximum, RMS)"
+       " and only the first samples.",
+       &openhpsdr_e_sample_display, sample_display_vals, FALSE);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"sample_max_items",
+       "Maximum Sample Items (Compact)",
+       "The maximum number of samples displayed as items in a datagram"
+       " when the sample block display is Compact.",
+       10, &openhpsdr_e_sample_max_items);
+
+   prefs_register_bool_preference(openhpsdr_e_prefs,"delta_view",
+       "Command Delta View (DDCC, HPC)",
+       "Only add tree items for the DDC Command and High Priority Command"
+       " fields that changed since the previous command of the radio."
+       " The \"Changed\" and \"Unchanged Since Frame\" items are added in both views.",
+       &openhpsdr_e_delta_view);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"rate_tolerance",
+       "DDC I&Q Data Rate Tolerance (Percent)",
+       "How far the observed DDC I&Q datagrams per second may differ from"
+       " the rate expected from the DDC Command sample rate before a warning"
+       " is added.",
+       10, &openhpsdr_e_rate_tolerance);
+
+   prefs_register_uint_preference(openhpsdr_e_prefs,"link_speed",
+       "Link Speed (Mbit/s)",
+       "The Ethernet link speed between the host and the radio."
+       " A warning is added to a DDC or DUC Command when the streams of the"
+       " configuration need more bandwidth than this in either direction.",
+       10, &openhpsdr_e_link_speed);
+
+   openhpsdr_e_samples_init();
+
+   openhpsdr_e_tap = register_tap("hpsdr-e");
+
+   register_init_routine(openhpsdr_e_init);
+   register_cleanup_routine(openhpsdr_e_cleanup);
+
+}
+
+
+gint cr_packet_end_pad(tvbuff_t *tvb, proto_tree *tree, gint offset, gint size)
+{
+   gint length = -1;
+
+   proto_item *local_append_text_item = NULL;
+
+   if (openhpsdr_e_strict_pad) { length = size; }
+   else { length = 1; }
+
+   local_append_text_item = proto_tree_add_item(tree,hf_openhpsdr_e_cr_pad,tvb,offset,
+                         length,ENC_BIG_ENDIAN);
+
+   if (openhpsdr_e_strict_pad) { proto_item_append_text(local_append_text_item," (%d Bytes)",size); }
+   else { proto_item_append_text(local_append_text_item," (%d Bytes) -Disabled",size); }
+   offset += size;
+
+   return offset;
+}
+
+// Read the service ports from a Command Reply (CR) General datagram.
+// Called with or without a tree, on the first pass only. A new port map is
+// made for the host and radio pair when the ports change.
+void cr_general_ports(tvbuff_t *tvb, packet_info *pinfo, gint offset)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_port_map_t ports;
+   openhpsdr_e_port_map_t *new_ports = NULL;
+
+   if ( PINFO_FD_VISITED(pinfo) ) { return; }
+
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
+   if ( radio == NULL ) { return; }
+   // Host to Hardware, the radio is the destination
+   openhpsdr_e_radio_hw_addr(radio, &pinfo->dst);
+
+   memset(&ports, 0, sizeof(ports));
+
+   ports.ddcc_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.ducc_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.hpc_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.hps_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.ddca_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.duciq_base_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.ddciq_base_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.micl_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.wbd_base_port = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+
+   // Wide band enable, samples, size, rate and datagrams full spectrum
+   // Not part of the port map, kept with the radio for the bandwidth budget.
+   radio->wb_enable = tvb_get_guint8(tvb, offset);
+   radio->wb_samples = tvb_get_guint16(tvb, offset + 1,2);
+   // Only 8, 16, 24 and 32 bit samples are kept, 0 uses HPSDR_E_WB_BITS
+   radio->wb_bits = tvb_get_guint8(tvb, offset + 3);
+   if ( radio->wb_bits != 8 && radio->wb_bits != 16 && radio->wb_bits != 24 && radio->wb_bits != 32 ) {
+       radio->wb_bits = 0;
+   }
+   radio->wb_rate = tvb_get_guint8(tvb, offset + 4);
+   radio->wb_datagrams = tvb_get_guint8(tvb, offset + 5);
+   offset += 6;
+
+   ports.mem_host_port  = tvb_get_guint16(tvb, offset,2);
+   offset += 2;
+   ports.mem_hw_port = tvb_get_guint16(tvb, offset,2);
+
+   // Frequency or phase word, byte 37 bit 3.
+   radio->phase_word = ( tvb_get_guint8(tvb, offset + 6) & 0x08 ) != 0;
+
+   // Same ports, keep the port map (and its tables).
+   if ( memcmp(&ports, radio->ports, offsetof(openhpsdr_e_port_map_t, mem_hw_port) + sizeof(guint16)) == 0 ) {
+       return;
+   }
+
+   new_ports = wmem_new(wmem_file_scope(), openhpsdr_e_port_map_t);
+   *new_ports = ports;
+   new_ports->dest_port_type = (guint8 *)wmem_alloc(wmem_file_scope(), HPSDR_E_NUM_UDP_PORTS);
+   new_ports->src_port_type = (guint8 *)wmem_alloc(wmem_file_scope(), HPSDR_E_NUM_UDP_PORTS);
+   openhpsdr_e_build_port_tables(new_ports);
+
+   if ( radio->ports == &openhpsdr_e_default_ports ) { openhpsdr_e_port_maps++; }
+   radio->ports = new_ports;
+
+}
+
+guint8 cr_discovery_reply(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset)
+{
+   guint8 board_id = -1;
+   guint8 value = -1;
+   guint8 boolean_byte = -1;
+
+   const char *placehold = NULL;
+
+   proto_item *append_text_item_disc = NULL;
+
+//   const guint8 *discovery_ether_mac;
+   const guint8 *cr_ether_mac;
+   cr_ether_mac = tvb_get_ptr(tvb, 5, 6); // Has to be defined before using.
+
+   proto_tree_add_ether(tree, hf_openhpsdr_e_cr_disc_mac, tvb,offset, 6, cr_ether_mac);
+   offset += 6;
+
+   board_id = tvb_get_guint8(tvb, offset);
+   proto_tree_add_item(tree,hf_openhpsdr_e_cr_disc_board,tvb,offset,1,ENC_BIG_ENDIAN);
+   offset += 1;
+
+   value = tvb_get_guint8(tvb, offset);
+   proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_proto_ver,tvb,offset,1,value,
+       "openHPSDR Protocol: %d.%.1d",(value/10),(value%10));
+   offset += 1;
+
+   value = tvb_get_guint8(tvb, offset);
+   proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_fw_ver,tvb,offset,1,value,
+       "Firmware   Version: %d.%.1d",(value/10),(value%10));
+   offset += 1;
+
+   // XML Hardware Description
+   if ( board_id == 254 ) {
+
+     proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,0,placehold,
+        "!!! XML Hardware Description Not Defined in Version 2.9 of Protocol !!!");
+
+   // Full Hardware Description
+   } else if (board_id == 255 ) {
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc0_ver,tvb,offset,1,value,
+         "Mercury0   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc1_ver,tvb,offset,1,value,
+         "Mercury1   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc2_ver,tvb,offset,1,value,
+         "Mercury2   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc3_ver,tvb,offset,1,value,
+         "Mercury3   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_penny_ver,tvb,offset,1,value,
+         "Penny      Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_metis_ver,tvb,offset,1,value,
+         "Metis      Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_hpsdr_fw, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_udp_ports, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_fixed_ip, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_mem, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_alex_rx_filters, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_alex_tx_filters, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_vita_49, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_dsp_clock, tvb,offset, 4,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," Hz");
+      offset += 4;
+
+      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,5,placehold,
+         "Additional Settings   : Reserved for Future Use");
+      offset += 5;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_dither, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_random, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_freq_phase, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_atten, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
+      offset += 2;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_var, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_size, tvb,offset, 1,
+        ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," Bits");
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_update, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_update_rate,
+         tvb,offset, 1, ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," mS");
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_datagram, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_datagrams_frame, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rates, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_min, tvb,offset, 2,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," ksps");
+      offset += 2;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_max, tvb,offset, 2,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," ksps");
+      offset += 2;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cic_dec, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_sync_ddc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      // 3.7 Change: Per 3.7 - DDC Multiplex Removed.
+      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved,tvb,offset,1,placehold,
+           "Number Multiplexed DDC       : Per 3.7 - DDC Multiplex Removed.");
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_channels, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_rate, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," ksps");
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_size, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," Bits");
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
+      offset += 2;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_iq_time_stamp, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,5,placehold,
+         "Additional DDC Settings      : Reserved for Future Use");
+      offset += 5;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_mic, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_line, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_rate, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," ksps");
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_size, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," Bits");
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
+      offset += 2;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_freq_phase, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_rate, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," ksps");
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_size, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," Bits");
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_iq_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
+      offset += 2;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_env_track, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_sidetone, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_host, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_iambic, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_break, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_hang, tvb,offset, 2,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," mS");
+      offset += 2;
+
+      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_delay, tvb,offset, 1,
+         ENC_BIG_ENDIAN);
+      proto_item_append_text(append_text_item_disc," mS");
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_phase_shift, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_atten, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_oc, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_cal, tvb,offset, 2, ENC_BIG_ENDIAN);
+      offset += 2;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_gen_adc, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
+
+   // "Standard" Boards
+   } else {
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc0_ver,tvb,offset,1,value,
+         "Mercury0   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc1_ver,tvb,offset,1,value,
+         "Mercury1   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc2_ver,tvb,offset,1,value,
+         "Mercury2   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc3_ver,tvb,offset,1,value,
+         "Mercury3   Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_penny_ver,tvb,offset,1,value,
+         "Penny      Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      value = tvb_get_guint8(tvb, offset);
+      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_metis_ver,tvb,offset,1,value,
+         "Metis      Version: %d.%.1d",(value/10),(value%10));
+      offset += 1;
+
+      proto_tree_add_item(tree,hf_openhpsdr_e_cr_disc_ddc_num,tvb,offset,1,ENC_BIG_ENDIAN);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_freq_phase, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      boolean_byte = tvb_get_guint8(tvb, offset);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_big_endian, tvb,offset, 1, boolean_byte);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_little_endian, tvb,offset, 1, boolean_byte);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_three_byte_ddciq, tvb,offset, 1, boolean_byte);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_float_ddciq, tvb,offset, 1, boolean_byte);
+      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_double_ddciq, tvb,offset, 1, boolean_byte);
+      offset += 1;
+
+      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_beta_ver, tvb,offset, 1, ENC_BIG_ENDIAN);
+      offset += 1;
+
+      offset = cr_packet_end_pad(tvb,tree,offset,36);
+      openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
+   }
+
+   return board_id;
+}
+
+void openhpsdr_e_check_frame_length(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset)
+{
+
+   guint length_remaining = -1;
+   const char *placehold = NULL ;
+
+   proto_item *ei_item = NULL;
+
+   if ( !(openhpsdr_e_strict_size) ) { return; }
+
+   if ( tvb_captured_length(tvb) > (guint)offset) {
+       length_remaining = tvb_ensure_captured_length_remaining(tvb, offset);
+       ei_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_cr_ei, tvb,
+                     offset, length_remaining, placehold,"Extra Length");
+       expert_add_info_format(pinfo,ei_item,&ei_cr_extra_length,
+           "Extra Bytes in packet, %d extra bytes.",length_remaining);
+   }
+
+}
+
+// The number of samples in a datagram to display as per-sample items.
+guint openhpsdr_e_sample_items(guint num_samples)
+{
+
+   if ( openhpsdr_e_sample_display == HPSDR_E_SAMPLES_COMPACT &&
+        num_samples > openhpsdr_e_sample_max_items ) {
+       return openhpsdr_e_sample_max_items;
+   }
+
+   return num_samples;
+}
+
+// Add one summary item for a block of big endian two's complement samples.
+// channels is the number of values per sample: 2 for I&Q or left and right.
+// A sample_bits of 0 is a block without sample values (Memory Mapped). Only
+// the count is added.
+void openhpsdr_e_sample_summary(tvbuff_t *tvb, proto_tree *tree, gint offset, guint num_samples,
+    guint sample_bits, guint channels)
+{
+   guint idx = 0;
+   guint i = 0;
+   guint num = 0;
+   guint num_values = -1;
+   guint sample_bytes = -1;
+   const guint8 *data = NULL;
+   gint32 values[HPSDR_E_SAMPLES_CHUNK];
+   gint32 min = G_MAXINT32;
+   gint32 max = G_MININT32;
+   gdouble sum_squares = 0.0;
+   gdouble rms = 0.0;
+
+   const char *placehold = NULL ;
+
+   proto_item *summary_item = NULL;
+   proto_tree *summary_tree = NULL;
+
+   if ( openhpsdr_e_sample_display != HPSDR_E_SAMPLES_COMPACT ) { return; }
+
+   if ( sample_bits == 0 ) {
+       summary_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_samples_summary, tvb, offset, 0,
+           placehold, "Sample Block: %u Entries", num_samples);
+       summary_tree = proto_item_add_subtree(summary_item, ett_openhpsdr_e_samples);
+       proto_tree_add_uint(summary_tree, hf_openhpsdr_e_samples_count, tvb, offset, 0, num_samples);
+       return;
+   }
+
+   sample_bytes = sample_bits / 8;
+   num_values = num_samples * channels;
+
+   // The whole block is unpacked in chunks, not one tvb read per value.
+   data = tvb_get_ptr(tvb, offset, num_values * sample_bytes);
+
+   for ( idx = 0; idx < num_values; idx += num ) {
+       num = MIN(num_values - idx, HPSDR_E_SAMPLES_CHUNK);
+       openhpsdr_e_unpack_i32(data + (idx * sample_bytes), num, sample_bits, values);
+
+       for ( i = 0; i < num; i++ ) {
+           if ( values[i] < min ) { min = values[i]; }
+           if ( values[i] > max ) { max = values[i]; }
+           sum_squares += (gdouble)values[i] * (gdouble)values[i];
+       }
+   }
+
+   if ( num_values > 0 ) {
+       rms = sqrt(sum_squares / num_values);
+   } else {
+       min = 0;
+       max = 0;
+   }
+
+   summary_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_samples_summary, tvb, offset,
+       num_values * sample_bytes, placehold, "Sample Block: %u by %u bit, Min: %d, Max: %d, RMS: %.1f",
+       num_samples, sample_bits, min, max, rms);
+   summary_tree = proto_item_add_subtree(summary_item, ett_openhpsdr_e_samples);
+
+   proto_tree_add_uint(summary_tree, hf_openhpsdr_e_samples_count, tvb, offset, 0, num_samples);
+   proto_tree_add_uint(summary_tree, hf_openhpsdr_e_samples_bits, tvb, offset, 0, sample_bits);
+   proto_tree_add_int(summary_tree, hf_openhpsdr_e_samples_min, tvb, offset, 0, min);
+   proto_tree_add_int(summary_tree, hf_openhpsdr_e_samples_max, tvb, offset, 0, max);
+   proto_tree_add_double(summary_tree, hf_openhpsdr_e_samples_rms, tvb, offset, 0, rms);
+
+   if ( num_samples > openhpsdr_e_sample_max_items ) {
+       proto_tree_add_string_format(summary_tree, hf_openhpsdr_e_samples_summary, tvb, offset, 0,
+           placehold, "Showing the first %u of %u samples", openhpsdr_e_sample_max_items, num_samples);
+   }
+
+}
+
+// Add the I&Q statistics of a DDC I&Q (from_hw) or DUC I&Q sample block:
+// the mean of I and Q, the RMS power and peak magnitude in dBFS and the
+// number of clipped values. Computed in one pass for every dissection with
+// a tree, so the fields can be filtered and graphed.
+void openhpsdr_e_iq_stats_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, guint samples_num,
+    guint sample_bits, gboolean from_hw)
+{
+   openhpsdr_e_iq_stats_t stats;
+   const int *hf = NULL;
+   guint length = 0;
+   gdouble rms_dbfs = HPSDR_E_DBFS_FLOOR;
+   gdouble peak_dbfs = HPSDR_E_DBFS_FLOOR;
+
+   const char *placehold = NULL ;
+
+   proto_item *stats_item = NULL;
+   proto_tree *iq_stats_tree = NULL;
+   proto_item *generated_item = NULL;
+
+   if ( tree == NULL || samples_num == 0 ) { return; }
+
+   length = samples_num * (sample_bits / 8) * 2;
+   if ( tvb_captured_length_remaining(tvb, offset) < (gint)length ) { return; }
+
+   if ( !openhpsdr_e_iq_stats(tvb_get_ptr(tvb, offset, length), samples_num, sample_bits, &stats) ) {
+       return;
+   }
+
+   if ( stats.power > 0 ) { rms_dbfs = 10.0 * log10(stats.power); }
+   if ( stats.peak > 0 ) { peak_dbfs = 10.0 * log10(stats.peak); }
+
+   hf = from_hw ? hf_openhpsdr_e_ddciq_stats : hf_openhpsdr_e_duciq_stats;
+
+   stats_item = proto_tree_add_string_format(tree, hf[HPSDR_E_IQSTATS_ITEM], tvb, offset, length, placehold,
+       "I&Q Statistics: RMS %.1f dBFS, Peak %.1f dBFS, Clipped %u", rms_dbfs, peak_dbfs, stats.clipped);
+   proto_item_set_generated(stats_item);
+   iq_stats_tree = proto_item_add_subtree(stats_item, ett_openhpsdr_e_iq_stats);
+
+   generated_item = proto_tree_add_double(iq_stats_tree, hf[HPSDR_E_IQSTATS_MEAN_I], tvb, offset, length, stats.mean_i);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(iq_stats_tree, hf[HPSDR_E_IQSTATS_MEAN_Q], tvb, offset, length, stats.mean_q);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(iq_stats_tree, hf[HPSDR_E_IQSTATS_RMS], tvb, offset, length, rms_dbfs);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(iq_stats_tree, hf[HPSDR_E_IQSTATS_PEAK], tvb, offset, length, peak_dbfs);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(iq_stats_tree, hf[HPSDR_E_IQSTATS_CLIPPED], tvb, offset, length, stats.clipped);
+   proto_item_set_generated(generated_item);
+}
+
+// Capture file start, new sequence analysis streams and host / radio pairs.
+static void openhpsdr_e_init(void)
+{
+
+   openhpsdr_e_streams = wmem_map_new(wmem_file_scope(), openhpsdr_e_stream_hash, openhpsdr_e_stream_equal);
+   openhpsdr_e_radios = wmem_map_new(wmem_file_scope(), openhpsdr_e_radio_hash, openhpsdr_e_radio_equal);
+   openhpsdr_e_port_maps = 0;
+
+}
+
+// Capture file end, the file scope memory is freed by Wireshark.
+static void openhpsdr_e_cleanup(void)
+{
+
+   openhpsdr_e_streams = NULL;
+   openhpsdr_e_radios = NULL;
+
+   openhpsdr_e_export_close_all();
+   openhpsdr_e_wb_close_all();
+   openhpsdr_e_telem_close_all();
+
+}
+
+static guint openhpsdr_e_stream_hash(gconstpointer key)
+{
+   const openhpsdr_e_stream_key_t *stream_key = (const openhpsdr_e_stream_key_t *)key;
+
+   return add_address_to_hash((stream_key->dg_type << 16) | stream_key->index, &stream_key->hw_addr);
+}
+
+static gboolean openhpsdr_e_stream_equal(gconstpointer key_a, gconstpointer key_b)
+{
+   const openhpsdr_e_stream_key_t *stream_key_a = (const openhpsdr_e_stream_key_t *)key_a;
+   const openhpsdr_e_stream_key_t *stream_key_b = (const openhpsdr_e_stream_key_t *)key_b;
+
+   return stream_key_a->dg_type == stream_key_b->dg_type &&
+          stream_key_a->index == stream_key_b->index &&
+          addresses_equal(&stream_key_a->hw_addr, &stream_key_b->hw_addr);
+}
+
+// Find a stream without adding it, NULL when it has not been seen.
+// from_hw: the hardware is the source, else the hardware is the destination.
+static openhpsdr_e_stream_t *openhpsdr_e_lookup_stream(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index)
+{
+   openhpsdr_e_stream_key_t stream_key;
+
+   stream_key.hw_addr = from_hw ? pinfo->src : pinfo->dst;
+   stream_key.dg_type = dg_type;
+   stream_key.index = index;
+
+   return (openhpsdr_e_stream_t *)wmem_map_lookup(openhpsdr_e_streams, &stream_key);
+}
+
+// Find a stream, a new stream is added to the map.
+// from_hw: the hardware is the source, else the hardware is the destination.
+static openhpsdr_e_stream_t *openhpsdr_e_find_stream(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, gboolean *created)
+{
+   openhpsdr_e_stream_key_t stream_key;
+   openhpsdr_e_stream_key_t *new_key = NULL;
+   openhpsdr_e_stream_t *stream = NULL;
+
+   // Shallow copy for the lookup, the address is copied when the stream is new.
+   stream_key.hw_addr = from_hw ? pinfo->src : pinfo->dst;
+   stream_key.dg_type = dg_type;
+   stream_key.index = index;
+
+   stream = (openhpsdr_e_stream_t *)wmem_map_lookup(openhpsdr_e_streams, &stream_key);
+   *created = ( stream == NULL );
+
+   if ( stream == NULL ) {
+       new_key = wmem_new0(wmem_file_scope(), openhpsdr_e_stream_key_t);
+       copy_address_wmem(wmem_file_scope(), &new_key->hw_addr, &stream_key.hw_addr);
+       new_key->dg_type = dg_type;
+       new_key->index = index;
+
+       stream = wmem_new0(wmem_file_scope(), openhpsdr_e_stream_t);
+       wmem_map_insert(openhpsdr_e_streams, new_key, stream);
+   }
+
+   return stream;
+}
+
+// Sequence number analysis of a stream.
+// The stream is updated on the first pass only, the result is kept with the
+// frame. Later passes (GUI re-dissection) only look up the result.
+// from_hw: the hardware is the source, else the hardware is the destination.
+openhpsdr_e_seq_info_t *openhpsdr_e_seq_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, guint32 sequence_num)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   gboolean created = FALSE;
+
+   seq_info = (openhpsdr_e_seq_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_SEQ);
+
+   if ( seq_info != NULL || PINFO_FD_VISITED(pinfo) || openhpsdr_e_streams == NULL ) {
+       return seq_info;
+   }
+
+   seq_info = wmem_new0(wmem_file_scope(), openhpsdr_e_seq_info_t);
+
+   stream = openhpsdr_e_find_stream(pinfo, from_hw, dg_type, index, &created);
+
+   if ( created ) {
+       stream->last_seq = sequence_num;
+
+       seq_info->first = TRUE;
+       seq_info->expected = sequence_num;
+
+   } else {
+       seq_info->expected = stream->last_seq + 1;
+       seq_info->delta = (gint32)(sequence_num - stream->last_seq);
+
+       if ( seq_info->delta > 1 ) {
+           seq_info->lost = seq_info->delta - 1;
+           stream->lost += seq_info->lost;
+
+       } else if ( seq_info->delta == 0 ) {
+           seq_info->duplicate = TRUE;
+           stream->duplicates++;
+
+       } else if ( seq_info->delta < 0 && sequence_num == 0 ) {
+           // Host or hardware started again, not an old datagram.
+           seq_info->restart = TRUE;
+
+       } else if ( seq_info->delta < 0 ) {
+           seq_info->out_of_order = TRUE;
+           stream->out_of_order++;
+       }
+
+       if ( seq_info->delta > 0 || seq_info->restart ) {
+           stream->last_seq = sequence_num;
+       }
+   }
+
+   stream->packets++;
+   seq_info->lost_total = stream->lost;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_SEQ, seq_info);
+
+   return seq_info;
+}
+
+// Add the sequence analysis items, expert info and Info column notes.
+// Called with a NULL tree for the expert info and Info column without a tree.
+void openhpsdr_e_seq_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_seq_info_t *seq_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *seq_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *seq_tree = NULL;
+
+   if ( seq_info == NULL ) { return; }
+
+   seq_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_seq_analysis, tvb, offset, 4, placehold,
+       "Sequence Analysis");
+   proto_item_set_generated(seq_item);
+   seq_tree = proto_item_add_subtree(seq_item, ett_openhpsdr_e_seq);
+
+   if ( seq_info->first ) {
+       generated_item = proto_tree_add_boolean(seq_tree, hf_openhpsdr_e_seq_first, tvb, offset, 4, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(seq_item, ": First datagram of stream");
+       return;
+   }
+
+   generated_item = proto_tree_add_uint(seq_tree, hf_openhpsdr_e_seq_expected, tvb, offset, 4, seq_info->expected);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_int(seq_tree, hf_openhpsdr_e_seq_delta, tvb, offset, 4, seq_info->delta);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(seq_tree, hf_openhpsdr_e_seq_lost, tvb, offset, 4, seq_info->lost);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(seq_tree, hf_openhpsdr_e_seq_lost_total, tvb, offset, 4,
+                        seq_info->lost_total);
+   proto_item_set_generated(generated_item);
+
+   if ( seq_info->lost > 0 ) {
+       proto_item_append_text(seq_item, ": %u Lost", seq_info->lost);
+       expert_add_info_format(pinfo, seq_item, &ei_seq_lost,
+           "%u datagrams lost, expected sequence number %u", seq_info->lost, seq_info->expected);
+       col_append_fstr(pinfo->cinfo, COL_INFO, " [%u Lost]", seq_info->lost);
+
+   } else if ( seq_info->duplicate ) {
+       generated_item = proto_tree_add_boolean(seq_tree, hf_openhpsdr_e_seq_duplicate, tvb, offset, 4, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(seq_item, ": Duplicate");
+       expert_add_info(pinfo, seq_item, &ei_seq_duplicate);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Duplicate]");
+
+   } else if ( seq_info->out_of_order ) {
+       generated_item = proto_tree_add_boolean(seq_tree, hf_openhpsdr_e_seq_out_of_order, tvb, offset, 4, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(seq_item, ": Out of Order");
+       expert_add_info_format(pinfo, seq_item, &ei_seq_out_of_order,
+           "Out of order datagram, %d behind the highest sequence number", -seq_info->delta);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Out-Of-Order]");
+
+   } else if ( seq_info->restart ) {
+       generated_item = proto_tree_add_boolean(seq_tree, hf_openhpsdr_e_seq_restart, tvb, offset, 4, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(seq_item, ": Restart");
+       expert_add_info(pinfo, seq_item, &ei_seq_restart);
+   }
+
+}
+
+// Decoded command cache.
+// The DDCC, DUCC and HPC settings are decoded on the first call for a frame
+// and kept with it. Returns NULL for a datagram that is too short.
+openhpsdr_e_ddcc_cmd_t *openhpsdr_e_ddcc_cmd(tvbuff_t *tvb, packet_info *pinfo)
+{
+   openhpsdr_e_ddcc_cmd_t *cmd = NULL;
+   gint offset = 4;
+   int i = -1;
+
+   cmd = (openhpsdr_e_ddcc_cmd_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+             HPSDR_E_PDATA_CMD);
+   if ( cmd != NULL ) { return cmd; }
+
+   if ( tvb_captured_length(tvb) < HPSDR_E_DDCC_LEN ) { return NULL; }
+
+   cmd = wmem_new0(wmem_file_scope(), openhpsdr_e_ddcc_cmd_t);
+
+   cmd->adc_num = tvb_get_guint8(tvb, offset);
+   cmd->dither = tvb_get_guint8(tvb, offset + 1);
+   cmd->random = tvb_get_guint8(tvb, offset + 2);
+   offset += 3;
+
+   for (i=0;i<HPSDR_E_NUM_DDC / 8;i++) {
+       cmd->enable[i] = tvb_get_guint8(tvb, offset + i);
+   }
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       if ( cmd->enable[i / 8] & (1 << (i % 8)) ) { cmd->ddc_on++; }
+   }
+   offset += HPSDR_E_NUM_DDC / 8;
+
+   // Six bytes per DDC: ADC, rate (2), CIC1, CIC2, sample size
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       cmd->adc[i] = tvb_get_guint8(tvb, offset);
+       cmd->rate[i] = tvb_get_ntohs(tvb, offset + 1);
+       cmd->sample_bits[i] = tvb_get_guint8(tvb, offset + 5);
+       offset += 6;
+   }
+
+   offset += 866; // Reserved
+
+   tvb_memcpy(tvb, cmd->sync, offset, HPSDR_E_NUM_DDC);
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_CMD, cmd);
+
+   return cmd;
+}
+
+openhpsdr_e_ducc_cmd_t *openhpsdr_e_ducc_cmd(tvbuff_t *tvb, packet_info *pinfo)
+{
+   openhpsdr_e_ducc_cmd_t *cmd = NULL;
+
+   cmd = (openhpsdr_e_ducc_cmd_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+             HPSDR_E_PDATA_CMD);
+   if ( cmd != NULL ) { return cmd; }
+
+   if ( tvb_captured_length(tvb) < HPSDR_E_DUCC_LEN ) { return NULL; }
+
+   cmd = wmem_new0(wmem_file_scope(), openhpsdr_e_ducc_cmd_t);
+
+   cmd->dac_num = tvb_get_guint8(tvb, 4);
+   cmd->cw_flags = tvb_get_guint8(tvb, 5);
+   cmd->sidetone_level = tvb_get_guint8(tvb, 6);
+   cmd->sidetone_freq = tvb_get_ntohs(tvb, 7);
+   cmd->keyer_speed = tvb_get_guint8(tvb, 9);
+   cmd->keyer_weight = tvb_get_guint8(tvb, 10);
+   cmd->hang_delay = tvb_get_ntohs(tvb, 11);
+   cmd->rf_delay = tvb_get_guint8(tvb, 13);
+   cmd->duc0_rate = tvb_get_ntohs(tvb, 14);
+   cmd->duc0_bits = tvb_get_guint8(tvb, 16);
+   cmd->mic_flags = tvb_get_guint8(tvb, 50);
+   cmd->line_in_gain = tvb_get_guint8(tvb, 51);
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_CMD, cmd);
+
+   return cmd;
+}
+
+openhpsdr_e_hpc_cmd_t *openhpsdr_e_hpc_cmd(tvbuff_t *tvb, packet_info *pinfo)
+{
+   openhpsdr_e_hpc_cmd_t *cmd = NULL;
+   gint offset = 9;
+   int i = -1;
+
+   cmd = (openhpsdr_e_hpc_cmd_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+             HPSDR_E_PDATA_CMD);
+   if ( cmd != NULL ) { return cmd; }
+
+   if ( tvb_captured_length(tvb) < HPSDR_E_HPC_LEN ) { return NULL; }
+
+   cmd = wmem_new0(wmem_file_scope(), openhpsdr_e_hpc_cmd_t);
+
+   cmd->run_ptt = tvb_get_guint8(tvb, 4);
+   cmd->cwx = tvb_get_guint8(tvb, 5);
+
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       cmd->ddc_freq[i] = tvb_get_ntohl(tvb, offset);
+       offset += 4;
+   }
+   for (i=0;i<4;i++) {
+       cmd->duc_freq[i] = tvb_get_ntohl(tvb, offset);
+       offset += 4;
+   }
+   for (i=0;i<4;i++) {
+       cmd->drive[i] = tvb_get_guint8(tvb, offset);
+       offset += 1;
+   }
+
+   offset += 1051; // Reserved
+
+   cmd->orion2 = tvb_get_guint8(tvb, offset);
+   cmd->open_col = tvb_get_guint8(tvb, offset + 1);
+   cmd->db9 = tvb_get_guint8(tvb, offset + 2);
+   cmd->merc_att = tvb_get_guint8(tvb, offset + 3);
+   offset += 4;
+
+   // Alex 7 down to Alex 0, then step attenuator ADC 7 down to ADC 0
+   for (i=7;i>=0;i--) {
+       cmd->alex[i] = tvb_get_ntohl(tvb, offset);
+       offset += 4;
+   }
+   for (i=HPSDR_E_NUM_ADC-1;i>=0;i--) {
+       cmd->att[i] = tvb_get_guint8(tvb, offset);
+       offset += 1;
+   }
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_CMD, cmd);
+
+   return cmd;
+}
+
+// Configuration timeline.
+// On the first pass, add an entry to the radio's timeline when a decoded
+// command differs from the one in effect. The decoded commands are zeroed
+// when allocated, so memcmp() also compares the padding.
+void openhpsdr_e_config_update(packet_info *pinfo, guint8 dg_type, void *cmd)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_config_t *last = NULL;
+   openhpsdr_e_config_t *config = NULL;
+
+   if ( cmd == NULL || PINFO_FD_VISITED(pinfo) ) { return; }
+
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
+   if ( radio == NULL ) { return; }
+
+   if ( radio->configs == NULL ) {
+       radio->configs = wmem_tree_new(wmem_file_scope());
+   }
+
+   last = (openhpsdr_e_config_t *)wmem_tree_lookup32_le(radio->configs, pinfo->num);
+
+   if ( last != NULL ) {
+       if ( dg_type == HPSDR_E_DG_DDCC && last->ddcc != NULL &&
+            memcmp(last->ddcc, cmd, sizeof(openhpsdr_e_ddcc_cmd_t)) == 0 ) { return; }
+       if ( dg_type == HPSDR_E_DG_DUCC && last->ducc != NULL &&
+            memcmp(last->ducc, cmd, sizeof(openhpsdr_e_ducc_cmd_t)) == 0 ) { return; }
+       if ( dg_type == HPSDR_E_DG_HPC && last->hpc != NULL &&
+            memcmp(last->hpc, cmd, sizeof(openhpsdr_e_hpc_cmd_t)) == 0 ) { return; }
+   }
+
+   config = wmem_new0(wmem_file_scope(), openhpsdr_e_config_t);
+   if ( last != NULL ) { *config = *last; }
+   config->frame = pinfo->num;
+
+   switch (dg_type) {
+       case HPSDR_E_DG_DDCC:
+           config->ddcc = (openhpsdr_e_ddcc_cmd_t *)cmd;
+           break;
+       case HPSDR_E_DG_DUCC:
+           config->ducc = (openhpsdr_e_ducc_cmd_t *)cmd;
+           break;
+       case HPSDR_E_DG_HPC:
+           config->hpc = (openhpsdr_e_hpc_cmd_t *)cmd;
+           break;
+       default:
+           return;
+   }
+
+   wmem_tree_insert32(radio->configs, pinfo->num, config);
+}
+
+// The configuration in effect at this frame, found by a less than or equal
+// search of the frame numbers. NULL before the first command of the radio.
+openhpsdr_e_config_t *openhpsdr_e_config_at(packet_info *pinfo)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+
+   radio = openhpsdr_e_find_radio(pinfo, FALSE);
+   if ( radio == NULL || radio->configs == NULL ) { return NULL; }
+
+   return (openhpsdr_e_config_t *)wmem_tree_lookup32_le(radio->configs, pinfo->num);
+}
+
+void openhpsdr_e_config_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset, gint ddc_num)
+{
+   const char *placehold = NULL ;
+
+   openhpsdr_e_config_t *config = NULL;
+   proto_item *config_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *config_tree = NULL;
+   guint8 adc = -1;
+
+   if ( tree == NULL || ddc_num < 0 || ddc_num >= HPSDR_E_NUM_DDC ) { return; }
+
+   config = openhpsdr_e_config_at(pinfo);
+   if ( config == NULL ) { return; }
+
+   config_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_config, tvb, offset, 0, placehold,
+       "Configuration in Effect for DDC %d", ddc_num);
+   proto_item_set_generated(config_item);
+   config_tree = proto_item_add_subtree(config_item, ett_openhpsdr_e_config);
+
+   generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_frame, tvb, offset, 0, config->frame);
+   proto_item_set_generated(generated_item);
+
+   if ( config->ddcc != NULL ) {
+       adc = config->ddcc->adc[ddc_num];
+
+       generated_item = proto_tree_add_boolean(config_tree, hf_openhpsdr_e_config_ddc_enabled, tvb, offset, 0,
+                            config->ddcc->enable[ddc_num / 8] & (1 << (ddc_num % 8)));
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_adc, tvb, offset, 0, adc);
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_rate, tvb, offset, 0,
+                            config->ddcc->rate[ddc_num]);
+       proto_item_append_text(generated_item," ksps");
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_sample_bits, tvb, offset, 0,
+                            config->ddcc->sample_bits[ddc_num]);
+       proto_item_append_text(generated_item," bits");
+       proto_item_set_generated(generated_item);
+   }
+
+   if ( config->hpc != NULL ) {
+       generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_freq_phase, tvb, offset, 0,
+                            config->hpc->ddc_freq[ddc_num]);
+       proto_item_set_generated(generated_item);
+
+       // The Alex word and step attenuator of the assigned ADC
+       if ( adc < HPSDR_E_NUM_ADC ) {
+           generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_alex, tvb, offset, 0,
+                                config->hpc->alex[adc]);
+           proto_item_append_text(generated_item," (Alex %u)", adc);
+           proto_item_set_generated(generated_item);
+           generated_item = proto_tree_add_uint(config_tree, hf_openhpsdr_e_config_att, tvb, offset, 0,
+                                config->hpc->att[adc]);
+           proto_item_append_text(generated_item," dB (ADC %u)", adc);
+           proto_item_set_generated(generated_item);
+       }
+   }
+
+}
+
+// Delta view.
+// On the first pass compare a decoded command with the previous command of the
+// same type and radio. The result is kept with the frame.
+openhpsdr_e_delta_t *openhpsdr_e_delta_analysis(packet_info *pinfo, guint8 dg_type, void *cmd, gsize cmd_size)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_delta_t *delta = NULL;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_delta_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_DELTA);
+   }
+
+   if ( cmd == NULL ) { return NULL; }
+
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
+   if ( radio == NULL ) { return NULL; }
+
+   delta = wmem_new0(wmem_file_scope(), openhpsdr_e_delta_t);
+
+   if ( radio->last_cmd[dg_type] == NULL ) {
+       delta->changed = TRUE;
+       delta->same_since = pinfo->num;
+   } else {
+       delta->prev_cmd = radio->last_cmd[dg_type];
+       delta->prev_frame = radio->last_cmd_frame[dg_type];
+       delta->changed = ( memcmp(radio->last_cmd[dg_type], cmd, cmd_size) != 0 );
+       delta->same_since = delta->changed ? pinfo->num : radio->same_since[dg_type];
+   }
+
+   radio->last_cmd[dg_type] = cmd;
+   radio->last_cmd_frame[dg_type] = pinfo->num;
+   radio->same_since[dg_type] = delta->same_since;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_DELTA, delta);
+
+   return delta;
+}
+
+void openhpsdr_e_delta_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_delta_t *delta)
+{
+   const char *placehold = NULL ;
+
+   proto_item *delta_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *delta_tree = NULL;
+
+   if ( delta == NULL || delta->prev_cmd == NULL ) { return; }
+
+   if ( delta->changed ) {
+       col_append_str(pinfo->cinfo, COL_INFO, " [Changed]");
+   }
+
+   if ( tree == NULL ) { return; }
+
+   if ( delta->changed ) {
+       delta_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_delta, tvb, offset, 0, placehold,
+           "Delta View: Changed since frame %u", delta->prev_frame);
+   } else {
+       delta_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_delta, tvb, offset, 0, placehold,
+           "Delta View: Unchanged since frame %u", delta->same_since);
+   }
+   proto_item_set_generated(delta_item);
+   delta_tree = proto_item_add_subtree(delta_item, ett_openhpsdr_e_delta);
+
+   generated_item = proto_tree_add_boolean(delta_tree, hf_openhpsdr_e_delta_changed, tvb, offset, 0, delta->changed);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(delta_tree, hf_openhpsdr_e_delta_prev_frame, tvb, offset, 0,
+                        delta->prev_frame);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(delta_tree, hf_openhpsdr_e_delta_same_since, tvb, offset, 0,
+                        delta->same_since);
+   proto_item_set_generated(generated_item);
+
+}
+
+// Delta view items of a DDC Command. Only the bytes and DDC entries that
+// differ from the previous command are added. Returns FALSE when the full
+// view has to be used.
+gboolean openhpsdr_e_ddcc_delta_items(tvbuff_t *tvb, proto_tree *tree, openhpsdr_e_delta_t *delta,
+    openhpsdr_e_ddcc_cmd_t *cmd)
+{
+   openhpsdr_e_ddcc_cmd_t *prev = NULL;
+   gint offset = -1;
+   int i = -1;
+
+   if ( !openhpsdr_e_delta_view || delta == NULL || delta->prev_cmd == NULL || cmd == NULL ) {
+       return FALSE;
+   }
+
+   prev = (openhpsdr_e_ddcc_cmd_t *)delta->prev_cmd;
+
+   if ( cmd->adc_num != prev->adc_num ) {
+       proto_tree_add_item(tree, hf_openhpsdr_e_ddcc_adc_num, tvb, 4, 1, ENC_BIG_ENDIAN);
+   }
+   if ( cmd->dither != prev->dither ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 5, hf_openhpsdr_e_ddcc_adc_dither_flags,
+           ett_openhpsdr_e_ddcc_ditram_flags, openhpsdr_e_ddcc_dither_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+   if ( cmd->random != prev->random ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 6, hf_openhpsdr_e_ddcc_adc_random_flags,
+           ett_openhpsdr_e_ddcc_ditram_flags, openhpsdr_e_ddcc_random_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+
+   for (i=0;i<HPSDR_E_NUM_DDC / 8;i++) {
+       if ( cmd->enable[i] != prev->enable[i] ) {
+           proto_tree_add_bitmask_with_flags(tree, tvb, 7 + i, hf_openhpsdr_e_ddcc_ddc_state_flags[i],
+               ett_openhpsdr_e_ddcc_state_flags, openhpsdr_e_ddcc_state_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
+       }
+   }
+
+   // Six bytes per DDC: ADC, rate (2), CIC1, CIC2, sample size
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       offset = 17 + (i * 6);
+       if ( cmd->adc[i] != prev->adc[i] ) {
+           proto_tree_add_item(tree, hf_openhpsdr_e_ddcc_ddc_asign[i], tvb, offset, 1, ENC_BIG_ENDIAN);
+       }
+       if ( cmd->rate[i] != prev->rate[i] ) {
+           proto_tree_add_item(tree, hf_openhpsdr_e_ddcc_ddc_rate[i], tvb, offset + 1, 2, ENC_BIG_ENDIAN);
+       }
+       if ( cmd->sample_bits[i] != prev->sample_bits[i] ) {
+           proto_tree_add_item(tree, hf_openhpsdr_e_ddcc_ddc_size[i], tvb, offset + 5, 1, ENC_BIG_ENDIAN);
+       }
+   }
+
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       if ( cmd->sync[i] != prev->sync[i] ) {
+           proto_tree_add_bitmask_with_flags(tree, tvb, 1363 + i, hf_openhpsdr_e_ddcc_ddc_sync_flags[i],
+               ett_openhpsdr_e_ddcc_sync_flags, openhpsdr_e_ddcc_sync_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
+       }
+   }
+
+   return TRUE;
+}
+
+// Delta view items of a High Priority Command, see openhpsdr_e_ddcc_delta_items().
+gboolean openhpsdr_e_hpc_delta_items(tvbuff_t *tvb, proto_tree *tree, openhpsdr_e_delta_t *delta,
+    openhpsdr_e_hpc_cmd_t *cmd)
+{
+   openhpsdr_e_hpc_cmd_t *prev = NULL;
+   proto_item *item = NULL;
+   int i = -1;
+   const int duc_freq_hf[4] = { hf_openhpsdr_e_hpc_freq_phase_duc0, hf_openhpsdr_e_hpc_freq_phase_duc1,
+       hf_openhpsdr_e_hpc_freq_phase_duc2, hf_openhpsdr_e_hpc_freq_phase_duc3 };
+   const int drive_hf[4] = { hf_openhpsdr_e_hpc_drive_duc0, hf_openhpsdr_e_hpc_drive_duc1,
+       hf_openhpsdr_e_hpc_drive_duc2, hf_openhpsdr_e_hpc_drive_duc3 };
+   const int alex_hf[8] = { -1, hf_openhpsdr_e_hpc_alex1, hf_openhpsdr_e_hpc_alex2, hf_openhpsdr_e_hpc_alex3,
+       hf_openhpsdr_e_hpc_alex4, hf_openhpsdr_e_hpc_alex5, hf_openhpsdr_e_hpc_alex6, hf_openhpsdr_e_hpc_alex7 };
+
+   if ( !openhpsdr_e_delta_view || delta == NULL || delta->prev_cmd == NULL || cmd == NULL ) {
+       return FALSE;
+   }
+
+   prev = (openhpsdr_e_hpc_cmd_t *)delta->prev_cmd;
+
+   if ( cmd->run_ptt != prev->run_ptt ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 4, hf_openhpsdr_e_hpc_run_ptt_flags,
+           ett_openhpsdr_e_hpc_flags, openhpsdr_e_hpc_run_ptt_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+   if ( cmd->cwx != prev->cwx ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 5, hf_openhpsdr_e_hpc_cwx0_sub,
+           ett_openhpsdr_e_hpc_cwx0, openhpsdr_e_hpc_cwx0_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+
+   for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+       if ( cmd->ddc_freq[i] != prev->ddc_freq[i] ) {
+           proto_tree_add_item(tree, hf_openhpsdr_e_hpc_freq_phase_ddc[i], tvb, 9 + (i * 4), 4, ENC_BIG_ENDIAN);
+       }
+   }
+
+   // DUC 1 to 3 are reserved for future use but still compared
+   for (i=0;i<4;i++) {
+       if ( cmd->duc_freq[i] != prev->duc_freq[i] ) {
+           item = proto_tree_add_item(tree, duc_freq_hf[i], tvb, 329 + (i * 4), 4, ENC_BIG_ENDIAN);
+           if ( i > 0 ) { proto_item_append_text(item," Future Use"); }
+       }
+   }
+   for (i=0;i<4;i++) {
+       if ( cmd->drive[i] != prev->drive[i] ) {
+           item = proto_tree_add_item(tree, drive_hf[i], tvb, 345 + i, 1, ENC_BIG_ENDIAN);
+           if ( i > 0 ) { proto_item_append_text(item," Future Use"); }
+       }
+   }
+
+   if ( cmd->orion2 != prev->orion2 ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 1400, hf_openhpsdr_e_hpc_orion2_flags,
+           ett_openhpsdr_e_hpc_flags, openhpsdr_e_hpc_orion2_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+   if ( cmd->open_col != prev->open_col ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 1401, hf_openhpsdr_e_hpc_open_col_flags,
+           ett_openhpsdr_e_hpc_flags, openhpsdr_e_hpc_open_col_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+   if ( cmd->db9 != prev->db9 ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 1402, hf_openhpsdr_e_hpc_db9_flags,
+           ett_openhpsdr_e_hpc_flags, openhpsdr_e_hpc_db9_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+   if ( cmd->merc_att != prev->merc_att ) {
+       proto_tree_add_bitmask_with_flags(tree, tvb, 1403, hf_openhpsdr_e_hpc_merc_att_flags,
+           ett_openhpsdr_e_hpc_flags, openhpsdr_e_hpc_merc_att_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+   }
+
+   // Alex 7 down to Alex 1 start at byte 1404, Alex 1 to 7 are reserved for future use
+   for (i=1;i<8;i++) {
+       if ( cmd->alex[i] != prev->alex[i] ) {
+           item = proto_tree_add_item(tree, alex_hf[i], tvb, 1404 + ((7 - i) * 4), 4, ENC_BIG_ENDIAN);
+           proto_item_append_text(item," Future Use");
+       }
+   }
+
+   // Alex 0 is the last of the Alex words, bytes 1432 to 1435
+   if ( cmd->alex[0] != prev->alex[0] ) {
+       for (i=0;i<4;i++) {
+           proto_tree_add_bitmask_with_flags(tree, tvb, 1432 + i, hf_openhpsdr_e_hpc_alex0_flags[i],
+               ett_openhpsdr_e_hpc_alex0_flags, openhpsdr_e_hpc_alex0_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
+       }
+   }
+
+   // Step attenuators, ADC 7 first
+   for (i=0;i<HPSDR_E_NUM_ADC;i++) {
+       if ( cmd->att[i] != prev->att[i] ) {
+           proto_tree_add_item(tree, hf_openhpsdr_e_hpc_att[i], tvb, 1436 + (7 - i), 1, ENC_BIG_ENDIAN);
+       }
+   }
+
+   return TRUE;
+}
+
+// DDC I&Q timestamp analysis.
+// Each datagram should start at the previous timestamp plus the previous
+// sample count. Duplicate and out of order datagrams are not checked. The
+// sample clock is estimated from the timestamps and the capture time since
+// the first datagram (or the last reset), and compared with the DDC sample
+// rate of the configuration in effect.
+openhpsdr_e_ts_info_t *openhpsdr_e_ts_analysis(packet_info *pinfo, gint ddc_num, guint64 time_stamp,
+    guint16 samples_num, openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_ts_info_t *ts_info = NULL;
+   openhpsdr_e_config_t *config = NULL;
+   gboolean created = FALSE;
+   nstime_t elapsed;
+   gdouble elapsed_sec = 0.0;
+   gdouble nominal = 0.0;
+
+   ts_info = (openhpsdr_e_ts_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                 HPSDR_E_PDATA_TS);
+
+   if ( ts_info != NULL || PINFO_FD_VISITED(pinfo) || openhpsdr_e_streams == NULL ) {
+       return ts_info;
+   }
+
+   if ( ddc_num < 0 || ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) ) {
+       return NULL;
+   }
+
+   ts_info = wmem_new0(wmem_file_scope(), openhpsdr_e_ts_info_t);
+
+   stream = openhpsdr_e_find_stream(pinfo, TRUE, HPSDR_E_DG_DDCIQ, (guint16)ddc_num, &created);
+
+   if ( !stream->ts_valid ) {
+       ts_info->first = TRUE;
+
+   } else {
+       ts_info->expected = stream->last_ts + stream->last_samples;
+       ts_info->delta = (gint64)(time_stamp - ts_info->expected);
+
+       if ( time_stamp < stream->last_ts ) {
+           ts_info->reset = TRUE;
+           ts_info->first = TRUE;
+           ts_info->back = stream->last_ts - time_stamp;
+
+       } else if ( ts_info->delta > 0 && seq_info != NULL && seq_info->lost > 0 &&
+                   ts_info->delta == (gint64)seq_info->lost * stream->last_samples ) {
+           ts_info->lost = TRUE;
+       }
+   }
+
+   if ( ts_info->first ) {
+       stream->base_ts = time_stamp;
+       stream->base_time = pinfo->abs_ts;
+   }
+
+   stream->ts_valid = TRUE;
+   stream->last_ts = time_stamp;
+   stream->last_samples = samples_num;
+
+   nstime_delta(&elapsed, &pinfo->abs_ts, &stream->base_time);
+   elapsed_sec = nstime_to_sec(&elapsed);
+
+   if ( elapsed_sec >= HPSDR_E_TS_MIN_BASELINE ) {
+       ts_info->have_rate = TRUE;
+       ts_info->rate = (gdouble)(time_stamp - stream->base_ts) / elapsed_sec;
+
+       config = openhpsdr_e_config_at(pinfo);
+       if ( config != NULL && config->ddcc != NULL && ddc_num < HPSDR_E_NUM_DDC &&
+            config->ddcc->rate[ddc_num] != 0 ) {
+           nominal = config->ddcc->rate[ddc_num] * 1000.0;
+           ts_info->have_drift = TRUE;
+           ts_info->drift_ppm = ((ts_info->rate / nominal) - 1.0) * 1000000.0;
+       }
+   }
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_TS, ts_info);
+
+   return ts_info;
+}
+
+// Add the timestamp analysis items, expert info and Info column notes.
+// Called with a NULL tree for the expert info and Info column without a tree.
+void openhpsdr_e_ts_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_ts_info_t *ts_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *ts_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *ts_tree = NULL;
+
+   if ( ts_info == NULL ) { return; }
+
+   ts_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_ts, tvb, offset, 8, placehold,
+       "Timestamp Analysis");
+   proto_item_set_generated(ts_item);
+   ts_tree = proto_item_add_subtree(ts_item, ett_openhpsdr_e_ts);
+
+   if ( ts_info->reset ) {
+       generated_item = proto_tree_add_boolean(ts_tree, hf_openhpsdr_e_ts_reset, tvb, offset, 8, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(ts_item, ": Reset");
+       expert_add_info_format(pinfo, ts_item, &ei_ts_reset,
+           "Timestamp went back %" G_GINT64_MODIFIER "u samples, sample clock estimate restarted",
+           ts_info->back);
+       col_append_str(pinfo->cinfo, COL_INFO, " [TS Reset]");
+       return;
+   }
+
+   if ( ts_info->first ) {
+       generated_item = proto_tree_add_boolean(ts_tree, hf_openhpsdr_e_ts_first, tvb, offset, 8, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(ts_item, ": First timestamp of stream");
+       return;
+   }
+
+   generated_item = proto_tree_add_uint64(ts_tree, hf_openhpsdr_e_ts_expected, tvb, offset, 8, ts_info->expected);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_int64(ts_tree, hf_openhpsdr_e_ts_delta, tvb, offset, 8, ts_info->delta);
+   proto_item_set_generated(generated_item);
+
+   if ( ts_info->delta > 0 ) {
+       generated_item = proto_tree_add_boolean(ts_tree, hf_openhpsdr_e_ts_gap, tvb, offset, 8, TRUE);
+       proto_item_set_generated(generated_item);
+       if ( ts_info->lost ) {
+           // Already reported by the sequence analysis.
+           proto_item_append_text(ts_item, ": Gap of %" G_GINT64_MODIFIER "d samples (lost datagrams)",
+               ts_info->delta);
+       } else {
+           proto_item_append_text(ts_item, ": Gap of %" G_GINT64_MODIFIER "d samples", ts_info->delta);
+           expert_add_info_format(pinfo, ts_item, &ei_ts_gap,
+               "Timestamp gap of %" G_GINT64_MODIFIER "d samples", ts_info->delta);
+           col_append_str(pinfo->cinfo, COL_INFO, " [TS Gap]");
+       }
+
+   } else if ( ts_info->delta < 0 ) {
+       generated_item = proto_tree_add_boolean(ts_tree, hf_openhpsdr_e_ts_overlap, tvb, offset, 8, TRUE);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(ts_item, ": Overlap of %" G_GINT64_MODIFIER "d samples", -ts_info->delta);
+       expert_add_info_format(pinfo, ts_item, &ei_ts_overlap,
+           "Timestamp overlap of %" G_GINT64_MODIFIER "d samples", -ts_info->delta);
+       col_append_str(pinfo->cinfo, COL_INFO, " [TS Overlap]");
+   }
+
+   if ( ts_info->have_rate ) {
+       generated_item = proto_tree_add_double(ts_tree, hf_openhpsdr_e_ts_rate, tvb, offset, 8, ts_info->rate);
+       proto_item_set_generated(generated_item);
+   }
+
+   if ( ts_info->have_drift ) {
+       generated_item = proto_tree_add_double(ts_tree, hf_openhpsdr_e_ts_drift, tvb, offset, 8, ts_info->drift_ppm);
+       proto_item_set_generated(generated_item);
+   }
+
+}
+
+// DDC I&Q data rate analysis.
+// Datagrams are counted over a HPSDR_E_RATE_WINDOW of capture time. The count
+// starts again when the configuration in effect changes. Lost datagrams lower
+// the observed rate, so hardware overruns and capture drops show up here too.
+openhpsdr_e_rate_info_t *openhpsdr_e_rate_analysis(packet_info *pinfo, gint ddc_num, guint16 samples_num,
+    openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_rate_info_t *rate_info = NULL;
+   openhpsdr_e_config_t *config = NULL;
+   gboolean created = FALSE;
+   guint32 ddc_config = 0;
+   nstime_t elapsed;
+   gdouble elapsed_sec = 0.0;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_rate_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_RATE);
+   }
+
+   if ( openhpsdr_e_streams == NULL || ddc_num < 0 || ddc_num >= HPSDR_E_NUM_DDC ||
+        ( seq_info != NULL && seq_info->duplicate ) ) {
+       return NULL;
+   }
+
+   // Only a change of this DDC starts a new window. The HPC changes (PTT, CWX,
+   // frequencies) that add timeline entries do not change the data rate.
+   config = openhpsdr_e_config_at(pinfo);
+   if ( config != NULL && config->ddcc != NULL ) {
+       // Rate, sample bits, a DDCC seen (0x02) and the enable bit
+       ddc_config = ( (guint32)config->ddcc->rate[ddc_num] << 16 ) |
+                    ( (guint32)config->ddcc->sample_bits[ddc_num] << 8 ) |
+                    ( ( config->ddcc->enable[ddc_num / 8] >> (ddc_num % 8) ) & 0x01 ) | 0x02;
+   }
+
+   stream = openhpsdr_e_find_stream(pinfo, TRUE, HPSDR_E_DG_DDCIQ, (guint16)ddc_num, &created);
+
+   if ( !stream->rate_valid || stream->rate_config != ddc_config ) {
+       stream->rate_valid = TRUE;
+       stream->rate_config = ddc_config;
+       stream->rate_start = pinfo->abs_ts;
+       stream->rate_count = 0;
+       return NULL;
+   }
+
+   stream->rate_count++;
+
+   nstime_delta(&elapsed, &pinfo->abs_ts, &stream->rate_start);
+   elapsed_sec = nstime_to_sec(&elapsed);
+
+   if ( elapsed_sec < HPSDR_E_RATE_WINDOW ) { return NULL; }
+
+   rate_info = wmem_new0(wmem_file_scope(), openhpsdr_e_rate_info_t);
+   rate_info->window = elapsed_sec;
+   rate_info->datagrams = stream->rate_count;
+   rate_info->observed = stream->rate_count / elapsed_sec;
+
+   if ( config != NULL && config->ddcc != NULL && samples_num != 0 &&
+        config->ddcc->rate[ddc_num] != 0 &&
+        ( config->ddcc->enable[ddc_num / 8] & (1 << (ddc_num % 8)) ) ) {
+       rate_info->have_expected = TRUE;
+       rate_info->expected = ( config->ddcc->rate[ddc_num] * 1000.0 ) / samples_num;
+       rate_info->deviation = ( ( rate_info->observed / rate_info->expected ) - 1.0 ) * 100.0;
+       rate_info->out_of_range = ( fabs(rate_info->deviation) > openhpsdr_e_rate_tolerance );
+   }
+
+   // This datagram opens the next window.
+   stream->rate_start = pinfo->abs_ts;
+   stream->rate_count = 0;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_RATE, rate_info);
+
+   return rate_info;
+}
+
+// Add the data rate items on the datagram closing a measurement window.
+// Called with a NULL tree for the expert info and Info column without a tree.
+void openhpsdr_e_rate_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    gint ddc_num, openhpsdr_e_rate_info_t *rate_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *rate_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *rate_tree = NULL;
+
+   if ( rate_info == NULL ) { return; }
+
+   rate_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_rate, tvb, offset, 0, placehold,
+       "Data Rate Analysis: %.1f datagrams/s", rate_info->observed);
+   proto_item_set_generated(rate_item);
+   rate_tree = proto_item_add_subtree(rate_item, ett_openhpsdr_e_rate);
+
+   generated_item = proto_tree_add_double(rate_tree, hf_openhpsdr_e_rate_observed, tvb, offset, 0,
+                        rate_info->observed);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(rate_tree, hf_openhpsdr_e_rate_window, tvb, offset, 0,
+                        rate_info->window);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(rate_tree, hf_openhpsdr_e_rate_datagrams, tvb, offset, 0,
+                        rate_info->datagrams);
+   proto_item_set_generated(generated_item);
+
+   if ( !rate_info->have_expected ) { return; }
+
+   proto_item_append_text(rate_item, ", expected %.1f", rate_info->expected);
+
+   generated_item = proto_tree_add_double(rate_tree, hf_openhpsdr_e_rate_expected, tvb, offset, 0,
+                        rate_info->expected);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(rate_tree, hf_openhpsdr_e_rate_deviation, tvb, offset, 0,
+                        rate_info->deviation);
+   proto_item_set_generated(generated_item);
+
+   if ( rate_info->out_of_range ) {
+       expert_add_info_format(pinfo, rate_item, &ei_rate_deviation,
+           "DDC %d: %.1f datagrams/s observed, %.1f expected from the DDC Command (%+.1f%%)",
+           ddc_num, rate_info->observed, rate_info->expected, rate_info->deviation);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Rate]");
+   }
+
+}
+
+// Wire bandwidth in Mbit/s of a stream of datagrams.
+// overhead: lower layer header bytes of each datagram.
+static gdouble openhpsdr_e_wire_mbps(gdouble datagrams_per_sec, guint32 datagram_len, guint32 overhead)
+{
+   return datagrams_per_sec * (datagram_len + overhead + HPSDR_E_WIRE_OVERHEAD) * 8.0 / 1000000.0;
+}
+
+// Lower layer header bytes of this frame: Ethernet with any 802.1Q tags,
+// IPv4 or IPv6 and UDP. The frame length less the UDP data. A reassembled
+// (IP fragmented) datagram is longer than its frame, the headers are then
+// taken as Ethernet and the IP version of the frame.
+guint32 openhpsdr_e_frame_overhead(tvbuff_t *tvb, packet_info *pinfo)
+{
+   guint32 data_len = tvb_reported_length(tvb);
+
+   if ( pinfo->fd->pkt_len > data_len + HPSDR_E_UDP_HDR_LEN ) {
+       return pinfo->fd->pkt_len - data_len;
+   }
+
+   return 14 + openhpsdr_e_ip_overhead(tvb, pinfo);
+}
+
+// IP and UDP header bytes, the part of the frame overhead counted in the MTU.
+// The IP header is the one in the frame just before the UDP header, found by
+// its version, header length and source address, so IPv4 options and IPv6
+// extension headers are counted. When it is not found (a reassembled
+// datagram) the IPv4 or IPv6 header without options is counted.
+guint32 openhpsdr_e_ip_overhead(tvbuff_t *tvb, packet_info *pinfo)
+{
+   tvbuff_t *frame_tvb = tvb_get_ds_tvb(tvb);
+   gint udp_start = tvb_raw_offset(tvb) - HPSDR_E_UDP_HDR_LEN;
+   gint ip_start = 0;
+   guint32 ip_len = 0;
+
+   if ( pinfo->net_src.type == AT_IPv6 ) {
+       // Version 6, source address at byte 8
+       for ( ip_len = HPSDR_E_IPV6_HDR_LEN; ip_len <= HPSDR_E_IPV6_HDR_MAX; ip_len += 8 ) {
+           ip_start = udp_start - (gint)ip_len;
+           if ( ip_start < 0 ) { break; }
+           if ( ( tvb_get_guint8(frame_tvb, ip_start) >> 4 ) == 6 &&
+                tvb_memeql(frame_tvb, ip_start + 8, (const guint8 *)pinfo->net_src.data, 16) == 0 ) {
+               return ip_len + HPSDR_E_UDP_HDR_LEN;
+           }
+       }
+       return HPSDR_E_IPV6_HDR_LEN + HPSDR_E_UDP_HDR_LEN;
+   }
+
+   if ( pinfo->net_src.type == AT_IPv4 ) {
+       // Version 4 and the header length in words, source address at byte 12
+       for ( ip_len = HPSDR_E_IPV4_HDR_LEN; ip_len <= HPSDR_E_IPV4_HDR_MAX; ip_len += 4 ) {
+           ip_start = udp_start - (gint)ip_len;
+           if ( ip_start < 0 ) { break; }
+           if ( tvb_get_guint8(frame_tvb, ip_start) == ( 0x40 | ( ip_len / 4 ) ) &&
+                tvb_memeql(frame_tvb, ip_start + 12, (const guint8 *)pinfo->net_src.data, 4) == 0 ) {
+               return ip_len + HPSDR_E_UDP_HDR_LEN;
+           }
+       }
+   }
+
+   return HPSDR_E_IPV4_HDR_LEN + HPSDR_E_UDP_HDR_LEN;
+}
+
+// Bandwidth budget of the configuration in effect, on the first pass.
+// DDC I&Q datagrams use the samples per datagram last seen from the DDC, or
+// HPSDR_E_IQ_PAYLOAD bytes of samples. Synchronous and multiplexed DDCs are
+// counted as independent streams. Command and status datagrams are not counted.
+// The lower layer headers are those last seen on a DDC I&Q datagram of the radio.
+openhpsdr_e_budget_t *openhpsdr_e_budget_analysis(packet_info *pinfo)
+{
+   openhpsdr_e_budget_t *budget = NULL;
+   openhpsdr_e_config_t *config = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_stream_t *stream = NULL;
+   guint32 sample_bytes = 0;
+   guint32 samples = 0;
+   guint32 datagrams = 0;
+   guint32 update = 0;
+   guint32 overhead = 0;
+   guint32 duc_rate = 0;
+   int i = -1;
 
-    // DDC Audio Field Arrary
-    static hf_register_info hf_ddca[] = {
-       { &hf_openhpsdr_e_ddca_banner,
-           { "openHPSDR Ethernet - DDC Audio" , "openhpsdr-e.ddca.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_sequence_num,
-           { "Sequence Number", "openhpsdr-e.ddca.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_sample_bits,
-           { "Bits Per Sample", "openhpsdr-e.ddca.sample-bits",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_separator,
-           { "DDC Audio Data Sample Separator" , "openhpsdr-e.ddca.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_sample_idx,
-           { "Sample Index", "openhpsdr-e.ddca.sample-idx",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_l_sample,
-           { "DDC Left  Audio Sample From Host", "openhpsdr-e.ddca.sample-l",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddca_r_sample,
-           { "DDC Right Audio Sample From Host", "openhpsdr-e.ddca.sample-r",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_budget_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_BUDGET);
+   }
 
-   // DUC I&Q Data Field Arrary
-    static hf_register_info hf_duciq[] = {
-       { &hf_openhpsdr_e_duciq_banner,
-           { "openHPSDR Ethernet - DUC I&Q Data" , "openhpsdr-e.duciq.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_sequence_num,
-           { "Sequence Number", "openhpsdr-e.duciq.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_duc,
-           { "Duc Number" , "openhpsdr-e.wbd.duc",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_sample_bits,
-           { "Bits Per Sample", "openhpsdr-e.duciq.sample-bits",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_separator,
-           { "DUC I&Q Data Sample Separator" , "openhpsdr-e.duciq.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_sample_idx,
-           { "Sample Index", "openhpsdr-e.duciq.sample-idx",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_i_sample,
-           { "DUC I Sample From Host", "openhpsdr-e.duciq.sample-i",
-            FT_UINT24, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_duciq_q_sample,
-           { "DUC Q Sample From Host", "openhpsdr-e.duciq.sample-q",
-            FT_UINT24, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
+   config = openhpsdr_e_config_at(pinfo);
+   radio = openhpsdr_e_find_radio(pinfo, FALSE);
+   if ( config == NULL || radio == NULL || openhpsdr_e_streams == NULL ) { return NULL; }
 
-   // DDC I&Q Data Field Arrary
-    static hf_register_info hf_ddciq[] = {
-       { &hf_openhpsdr_e_ddciq_banner,
-           { "openHPSDR Ethernet - DDC I&Q Data" , "openhpsdr-e.ddciq.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_sequence_num,
-           { "Sequence Number    ", "openhpsdr-e.ddciq.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_time_stamp,
-           { "Time Stamp         ", "openhpsdr-e.ddciq.time-stamp",
-            FT_UINT64, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_ddc,
-           { "DDC Number         " , "openhpsdr-e.ddciq.ddc",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_sample_bits,
-           { "Bits Per Sample    ", "openhpsdr-e.ddciq.sample-bits",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_samples_per_frame,
-           { "Sample Per Frame   ", "openhpsdr-e.ddciq.sample-per-frame",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_ethernet_frame_size,
-           { "Ethernet Frame Size", "openhpsdr-e.ddciq.ethernet-frame-size",
-            FT_UINT16, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_separator,
-           { "DDC I&Q Data Sample Separator" , "openhpsdr-e.ddciq.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_sample_idx,
-           { "Sample Index", "openhpsdr-e.ddciq.sample-idx",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_8b_i_sample,
-           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_8b_q_sample,
-           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
-            FT_UINT8, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_16b_i_sample,
-           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_16b_q_sample,
-           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_24b_i_sample,
-           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
-            FT_UINT24, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_24b_q_sample,
-           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
-            FT_UINT24, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_32b_i_sample,
-           { "DDC I Sample From Hardware", "openhpsdr-e.ddciq.sample-i",
-            FT_UINT32, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_ddciq_32b_q_sample,
-           { "DDC Q Sample From Hardware", "openhpsdr-e.ddciq.sample-q",
-            FT_UINT32, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
+   budget = wmem_new0(wmem_file_scope(), openhpsdr_e_budget_t);
+   budget->link = openhpsdr_e_link_speed;
+   overhead = radio->frame_overhead ? radio->frame_overhead : HPSDR_E_FRAME_OVERHEAD;
+
+   if ( config->ddcc != NULL ) {
+       for ( i = 0; i < HPSDR_E_NUM_DDC; i++ ) {
+           if ( !( config->ddcc->enable[i / 8] & (1 << (i % 8)) ) || config->ddcc->rate[i] == 0 ) { continue; }
+
+           sample_bytes = ( config->ddcc->sample_bits[i] ? config->ddcc->sample_bits[i] : 24 ) / 8 * 2;
+           if ( sample_bytes == 0 ) { continue; }
+
+           // The DDC I&Q stream of the radio, the hardware is the destination of the DDCC.
+           // Looked up only, a stream added here would not be new to the sequence analysis.
+           stream = openhpsdr_e_lookup_stream(pinfo, FALSE, HPSDR_E_DG_DDCIQ, (guint16)i);
+           samples = ( stream != NULL && stream->last_samples ) ? stream->last_samples :
+                     HPSDR_E_IQ_PAYLOAD / sample_bytes;
+
+           budget->ddciq += openhpsdr_e_wire_mbps( ( config->ddcc->rate[i] * 1000.0 ) / samples,
+                                HPSDR_E_DDCIQ_HDR_LEN + samples * sample_bytes, overhead);
+       }
+   }
+
+   if ( radio->wb_enable != 0 ) {
+       samples = radio->wb_samples ? radio->wb_samples : HPSDR_E_WB_SAMPLES;
+       sample_bytes = ( radio->wb_bits ? radio->wb_bits : HPSDR_E_WB_BITS ) / 8;
+       update = radio->wb_rate ? radio->wb_rate : HPSDR_E_WB_RATE;
+       datagrams = radio->wb_datagrams ? radio->wb_datagrams : HPSDR_E_WB_DATAGRAMS;
+
+       for ( i = 0; i < HPSDR_E_NUM_ADC; i++ ) {
+           if ( !( radio->wb_enable & (1 << i) ) ) { continue; }
+           budget->wbd += openhpsdr_e_wire_mbps( ( datagrams * 1000.0 ) / update, 4 + samples * sample_bytes,
+                              overhead);
+       }
+   }
+
+   budget->micl = openhpsdr_e_wire_mbps( (gdouble)HPSDR_E_AUDIO_RATE / HPSDR_E_MICL_SAMPLES, HPSDR_E_MICL_LEN,
+                      overhead);
+   budget->ddca = openhpsdr_e_wire_mbps( (gdouble)HPSDR_E_AUDIO_RATE / HPSDR_E_DDCA_SAMPLES, HPSDR_E_DDCA_LEN,
+                      overhead);
+
+   if ( config->ducc != NULL ) {
+       sample_bytes = ( config->ducc->duc0_bits ? config->ducc->duc0_bits : 24 ) / 8 * 2;
+       duc_rate = config->ducc->duc0_rate ? config->ducc->duc0_rate : HPSDR_E_DUC_RATE;
+       budget->duciq = openhpsdr_e_wire_mbps(( duc_rate * 1000.0 ) / HPSDR_E_DUCIQ_SAMPLES,
+                           HPSDR_E_DUCIQ_HDR_LEN + HPSDR_E_DUCIQ_SAMPLES * sample_bytes, overhead);
+   }
 
-    // Memory Mapped Field Arrary
-    static hf_register_info hf_mem[] = {
-       { &hf_openhpsdr_e_mem_banner,
-           { "openHPSDR Ethernet - Memory Mapped" , "openhpsdr-e.mem.banner",
-            FT_STRING , BASE_NONE,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_mem_sequence_num,
-           { "Sequence Number", "openhpsdr-e.mem.squence-num",
-            FT_UINT32, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_mem_separator,
-           { "Memory Mapped Separator" , "openhpsdr-e.ddciq.sep",
-            FT_STRING, STR_ASCII,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_mem_idx,
-           { "Address/Data Index", "openhpsdr-e.mem.idx",
-            FT_UINT8, BASE_DEC,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_mem_address,
-           { "Memory Address    ", "openhpsdr-e.mem.address",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-       { &hf_openhpsdr_e_mem_data,
-           { "Memory Data       ", "openhpsdr-e.mem.data",
-            FT_UINT16, BASE_HEX,
-            NULL, ZERO_MASK,
-            NULL, HFILL }
-       },
-   };
+   budget->hw_to_host = budget->ddciq + budget->wbd + budget->micl;
+   budget->host_to_hw = budget->duciq + budget->ddca;
 
-   proto_openhpsdr_e = proto_register_protocol (
-       "OpenHPSDR Ethernet - Protocol 2", // name
-       "HPSDR-ETH_P2",                    // short name
-       "hpsdr-e"                          // abbrev
-   );
+   if ( budget->link != 0 ) {
+       budget->load = ( MAX(budget->hw_to_host, budget->host_to_hw) / budget->link ) * 100.0;
+   }
 
-   // Register the arrays
-   proto_register_field_array(proto_openhpsdr_e, hf, array_length(hf));
-   proto_register_field_array(proto_openhpsdr_e, hf_cr, array_length(hf_cr));
-   proto_register_field_array(proto_openhpsdr_e, hf_ddcc, array_length(hf_ddcc));
-   proto_register_field_array(proto_openhpsdr_e, hf_hps, array_length(hf_hps));
-   proto_register_field_array(proto_openhpsdr_e, hf_ducc, array_length(hf_ducc));
-   proto_register_field_array(proto_openhpsdr_e, hf_micl, array_length(hf_micl));
-   proto_register_field_array(proto_openhpsdr_e, hf_hpc, array_length(hf_hpc));
-   proto_register_field_array(proto_openhpsdr_e, hf_wbd, array_length(hf_wbd));
-   proto_register_field_array(proto_openhpsdr_e, hf_ddca, array_length(hf_ddca));
-   proto_register_field_array(proto_openhpsdr_e, hf_duciq, array_length(hf_duciq));
-   proto_register_field_array(proto_openhpsdr_e, hf_ddciq, array_length(hf_ddciq));
-   proto_register_field_array(proto_openhpsdr_e, hf_mem, array_length(hf_mem));
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_BUDGET, budget);
 
-   proto_register_subtree_array(ett, array_length(ett));
+   return budget;
+}
 
-   // Required function calls to register expert items
-   expert_openhpsdr_e_cr = expert_register_protocol(proto_openhpsdr_e);
-   expert_register_field_array(expert_openhpsdr_e_cr, ei_cr, array_length(ei_cr));
+// Add the bandwidth budget items, expert info and Info column note.
+// Called with a NULL tree for the expert info and Info column without a tree.
+void openhpsdr_e_budget_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_budget_t *budget)
+{
+   const char *placehold = NULL ;
 
-    //Register configuration preferences
-   openhpsdr_e_prefs = prefs_register_protocol(proto_openhpsdr_e,NULL);
+   proto_item *budget_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *budget_tree = NULL;
+
+   if ( budget == NULL ) { return; }
+
+   budget_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_budget, tvb, offset, 0, placehold,
+       "Bandwidth Budget: %.1f Mbit/s to host, %.1f Mbit/s to hardware (%.0f%% of %u Mbit/s)",
+       budget->hw_to_host, budget->host_to_hw, budget->load, budget->link);
+   proto_item_set_generated(budget_item);
+   budget_tree = proto_item_add_subtree(budget_item, ett_openhpsdr_e_budget);
+
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_ddciq, tvb, offset, 0, budget->ddciq);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_wbd, tvb, offset, 0, budget->wbd);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_micl, tvb, offset, 0, budget->micl);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_hw_to_host, tvb, offset, 0,
+                        budget->hw_to_host);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_duciq, tvb, offset, 0, budget->duciq);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_ddca, tvb, offset, 0, budget->ddca);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_host_to_hw, tvb, offset, 0,
+                        budget->host_to_hw);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(budget_tree, hf_openhpsdr_e_budget_link, tvb, offset, 0, budget->link);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(budget_tree, hf_openhpsdr_e_budget_load, tvb, offset, 0, budget->load);
+   proto_item_set_generated(generated_item);
+
+   if ( budget->load > 100.0 ) {
+       expert_add_info_format(pinfo, budget_item, &ei_budget_over,
+           "Configuration needs %.1f Mbit/s, the link is %u Mbit/s",
+           MAX(budget->hw_to_host, budget->host_to_hw), budget->link);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Over Budget]");
+   }
 
-   prefs_register_bool_preference(openhpsdr_e_prefs,"strict_size",
-       "Strict Checking of Datagram Size",
-       "Disable checking for added bytes at the end of the datagrams."
-       " Disables the warning message.",
-       &openhpsdr_e_strict_size);
+}
 
-   prefs_register_bool_preference(openhpsdr_e_prefs,"strict_pad",
-       "Strict Pad Checking",
-       "Strict checking of the amount of pad bytes at the end of the datagrams."
-       " When enabled, Wireshark (not the openHPSDR dissector) will display"
-       " a \"Malformed Packet\" error for a datagram without the correct"
-       " number of pad bytes."
-       " When disabled, checking is only for one pad byte instead of checking"
-       " for the correct number of pad bytes.",
-       &openhpsdr_e_strict_pad);
+// Export the samples of an in order DDC I&Q datagram, on the first pass.
+// The sample rate comes from the DDC Command in effect, the frequency from the
+// High Priority Command in effect.
+void openhpsdr_e_ddciq_export(tvbuff_t *tvb, packet_info *pinfo, gint ddc_num, guint16 samples_num,
+    guint16 sample_bits, openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_config_t *config = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
+   guint32 sample_rate = 0;
+   guint64 frequency = 0;
+   guint64 lost_samples = 0;
+   guint length = 0;
+
+   if ( openhpsdr_e_export_format == HPSDR_E_EXPORT_NONE || PINFO_FD_VISITED(pinfo) ) { return; }
+   if ( ddc_num < 0 || ddc_num >= HPSDR_E_NUM_DDC ) { return; }
+   if ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) { return; }
+
+   length = samples_num * (sample_bits / 8) * 2;
+   if ( tvb_captured_length(tvb) < 16 + length ) { return; }
+
+   config = openhpsdr_e_config_at(pinfo);
+   // Each radio has its own export files
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
+   if ( radio == NULL ) { return; }
+   if ( radio->export_files == NULL ) {
+       radio->export_files = openhpsdr_e_export_new(address_to_str(pinfo->pool, &pinfo->src));
+   }
 
-   prefs_register_bool_preference(openhpsdr_e_prefs,"ddciq_iq_mtu_check",
-       "DDC I&Q Samples MTU Check (DDCIQ)",
-       "Check to see if the number of I&Q Samples"
-       " will exceed the maximum Ethernet MTU (1500 bytes)."
-       " When disabled, there will be no checking"
-       " to see if the MTU will be exceeded.",
-       &openhpsdr_e_ddciq_mtu_check);
+   if ( config != NULL && config->ddcc != NULL ) {
+       sample_rate = config->ddcc->rate[ddc_num] * 1000;
+   }
+
+   if ( config != NULL && config->hpc != NULL ) {
+       frequency = config->hpc->ddc_freq[ddc_num];
+       if ( radio->phase_word ) {
+           frequency = ( frequency * HPSDR_E_CLOCK_HZ ) >> 32;
+       }
+   }
+
+   if ( seq_info != NULL && !seq_info->first ) {
+       lost_samples = (guint64)seq_info->lost * samples_num;
+   }
 
+   openhpsdr_e_export_ddciq((openhpsdr_e_export_t *)radio->export_files, openhpsdr_e_export_dir,
+       openhpsdr_e_export_format, openhpsdr_e_export_gaps, (guint)ddc_num, tvb_get_ptr(tvb, 16, length), samples_num, sample_bits, lost_samples,
+       sample_rate, frequency, nstime_to_sec(&pinfo->abs_ts));
 }
 
+// Inter-arrival time of a stream datagram, on the first pass.
+openhpsdr_e_iat_info_t *openhpsdr_e_iat_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_iat_info_t *iat_info = NULL;
+   gboolean created = FALSE;
 
-gint cr_packet_end_pad(tvbuff_t *tvb, proto_tree *tree, gint offset, gint size)
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_iat_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_IAT);
+   }
+
+   if ( openhpsdr_e_streams == NULL ) { return NULL; }
+
+   stream = openhpsdr_e_find_stream(pinfo, from_hw, dg_type, index, &created);
+
+   if ( !stream->iat_valid ) {
+       stream->iat_valid = TRUE;
+       stream->last_arrival = pinfo->abs_ts;
+       stream->burst = 1;
+       return NULL;
+   }
+
+   iat_info = wmem_new0(wmem_file_scope(), openhpsdr_e_iat_info_t);
+   nstime_delta(&iat_info->delta, &pinfo->abs_ts, &stream->last_arrival);
+
+   if ( iat_info->delta.secs == 0 && iat_info->delta.nsecs >= 0 &&
+        iat_info->delta.nsecs < HPSDR_E_BURST_GAP_US * 1000 ) {
+       stream->burst++;
+   } else {
+       stream->burst = 1;
+   }
+   iat_info->burst = stream->burst;
+   stream->last_arrival = pinfo->abs_ts;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_IAT, iat_info);
+
+   return iat_info;
+}
+
+void openhpsdr_e_iat_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, openhpsdr_e_iat_info_t *iat_info)
 {
-   gint length = -1;
+   proto_item *generated_item = NULL;
 
-   proto_item *local_append_text_item = NULL;
+   if ( tree == NULL || iat_info == NULL ) { return; }
 
-   if (openhpsdr_e_strict_pad) { length = size; }
-   else { length = 1; }
+   generated_item = proto_tree_add_time(tree, hf_openhpsdr_e_iat, tvb, offset, 0, &iat_info->delta);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(tree, hf_openhpsdr_e_iat_burst, tvb, offset, 0, iat_info->burst);
+   proto_item_set_generated(generated_item);
+}
 
-   local_append_text_item = proto_tree_add_item(tree,hf_openhpsdr_e_cr_pad,tvb,offset,
-                         length,ENC_BIG_ENDIAN);
+// FFT size of a wide band spectrum frame: the samples of one full spectrum
+// (General datagram), rounded down to a power of two.
+guint openhpsdr_e_wb_fft_len(openhpsdr_e_radio_t *radio)
+{
+   guint samples = HPSDR_E_WB_SAMPLES * HPSDR_E_WB_DATAGRAMS;
+   guint fft_len = HPSDR_E_WB_FFT_MAX;
 
-   if (openhpsdr_e_strict_pad) { proto_item_append_text(local_append_text_item," (%d Bytes)",size); }
-   else { proto_item_append_text(local_append_text_item," (%d Bytes) -Disabled",size); }
-   offset += size;
+   if ( radio != NULL && radio->wb_datagrams != 0 ) {
+       samples = (radio->wb_samples ? radio->wb_samples : HPSDR_E_WB_SAMPLES) * radio->wb_datagrams;
+   }
 
-   return offset;
+   while ( fft_len > samples && fft_len > HPSDR_E_WB_FFT_MIN ) {
+       fft_len >>= 1;
+   }
+
+   return fft_len;
 }
 
-guint8 cr_discovery_reply(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset)
+// Wide band spectrum analysis, on the first pass. A sequence restart or lost
+// datagrams start a new frame; the capture timing (bursts) does not.
+openhpsdr_e_wb_frame_t *openhpsdr_e_wb_analysis(tvbuff_t *tvb, packet_info *pinfo, guint16 adc_num,
+    openhpsdr_e_seq_info_t *seq_info)
 {
-   //guint8 board_id = -1;
-   guint8 value = -1;
-   guint8 boolean_byte = -1;
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_wb_frame_t frame;
+   openhpsdr_e_wb_frame_t *wb_frame = NULL;
+   gboolean created = FALSE;
+   gboolean restart = FALSE;
+   guint sample_bits = HPSDR_E_WB_BITS;
+   guint samples_num = 0;
+   gchar *name = NULL;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_wb_frame_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_WB);
+   }
 
-   const char *placehold = NULL;
+   if ( !openhpsdr_e_wb_spectrum || openhpsdr_e_streams == NULL ) { return NULL; }
+   if ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) { return NULL; }
 
-   proto_item *append_text_item_disc = NULL;
+   radio = openhpsdr_e_find_radio(pinfo, FALSE);
+   if ( radio != NULL && radio->wb_bits != 0 ) { sample_bits = radio->wb_bits; }
+   if ( sample_bits != 8 && sample_bits != 16 && sample_bits != 24 && sample_bits != 32 ) { return NULL; }
 
-//   const guint8 *discovery_ether_mac;
-   const guint8 *cr_ether_mac;
-   cr_ether_mac = tvb_get_ptr(tvb, 5, 6); // Has to be defined before using.
+   samples_num = tvb_captured_length_remaining(tvb, 4) / (sample_bits / 8);
+   if ( samples_num == 0 ) { return NULL; }
 
-   proto_tree_add_ether(tree, hf_openhpsdr_e_cr_disc_mac, tvb,offset, 6, cr_ether_mac);
-   offset += 6;
+   stream = openhpsdr_e_find_stream(pinfo, TRUE, HPSDR_E_DG_WBD, adc_num, &created);
+   if ( stream->wb == NULL ) {
+       name = g_strdup_printf("adc%u", adc_num);
+       stream->wb = openhpsdr_e_wb_new(name);
+       g_free(name);
+   }
 
-   board_id = tvb_get_guint8(tvb, offset);
-   proto_tree_add_item(tree,hf_openhpsdr_e_cr_disc_board,tvb,offset,1,ENC_BIG_ENDIAN);
-   offset += 1;
+   restart = seq_info == NULL || seq_info->first || seq_info->restart || seq_info->lost > 0;
 
-   value = tvb_get_guint8(tvb, offset);
-   proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_proto_ver,tvb,offset,1,value,
-       "openHPSDR Protocol: %d.%.1d",(value/10),(value%10));
-   offset += 1;
+   if ( !openhpsdr_e_wb_add((openhpsdr_e_wb_adc_t *)stream->wb, tvb_get_ptr(tvb, 4, samples_num * (sample_bits / 8)),
+            samples_num, sample_bits, openhpsdr_e_wb_fft_len(radio), restart, openhpsdr_e_wb_spectrum_dir,
+            nstime_to_sec(&pinfo->abs_ts), &frame) ) {
+       return NULL;
+   }
 
-   value = tvb_get_guint8(tvb, offset);
-   proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_fw_ver,tvb,offset,1,value,
-       "Firmware   Version: %d.%.1d",(value/10),(value%10));
-   offset += 1;
+   wb_frame = wmem_new(wmem_file_scope(), openhpsdr_e_wb_frame_t);
+   *wb_frame = frame;
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_WB, wb_frame);
+
+   return wb_frame;
+}
+
+void openhpsdr_e_wb_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_wb_frame_t *frame)
+{
+   guint i = 0;
+
+   const char *placehold = NULL ;
+
+   proto_item *spectrum_item = NULL;
+   proto_tree *spectrum_tree = NULL;
+   proto_item *generated_item = NULL;
+
+   if ( frame == NULL ) { return; }
+
+   col_append_fstr(pinfo->cinfo, COL_INFO, " [Spectrum %u]", frame->number);
+
+   if ( tree == NULL ) { return; }
+
+   if ( frame->spurs_num > 0 ) {
+       spectrum_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_wb_spectrum, tvb, offset, 0, placehold,
+           "Spectrum Frame %u: %u Point FFT, Noise Floor %.1f dBFS, Spur %.1f dBFS at %.3f MHz",
+           frame->number, frame->fft_len, frame->noise_floor, frame->spur_dbfs[0], frame->spur_freq[0] / 1000000.0);
+   } else {
+       spectrum_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_wb_spectrum, tvb, offset, 0, placehold,
+           "Spectrum Frame %u: %u Point FFT, Noise Floor %.1f dBFS",
+           frame->number, frame->fft_len, frame->noise_floor);
+   }
+   proto_item_set_generated(spectrum_item);
+   spectrum_tree = proto_item_add_subtree(spectrum_item, ett_openhpsdr_e_wb_spectrum);
+
+   generated_item = proto_tree_add_uint(spectrum_tree, hf_openhpsdr_e_wb_frame, tvb, offset, 0, frame->number);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(spectrum_tree, hf_openhpsdr_e_wb_fft_len, tvb, offset, 0, frame->fft_len);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(spectrum_tree, hf_openhpsdr_e_wb_noise_floor, tvb, offset, 0,
+                        frame->noise_floor);
+   proto_item_set_generated(generated_item);
+
+   for ( i = 0; i < frame->spurs_num; i++ ) {
+       generated_item = proto_tree_add_double(spectrum_tree, hf_openhpsdr_e_wb_spur_freq, tvb, offset, 0,
+                            frame->spur_freq[i]);
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_double(spectrum_tree, hf_openhpsdr_e_wb_spur_dbfs, tvb, offset, 0,
+                            frame->spur_dbfs[i]);
+       proto_item_set_generated(generated_item);
+   }
+
+   generated_item = proto_tree_add_double(spectrum_tree, hf_openhpsdr_e_wb_peak, tvb, offset, 0, frame->peak_dbfs);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(spectrum_tree, hf_openhpsdr_e_wb_clipped, tvb, offset, 0, frame->clipped);
+   proto_item_set_generated(generated_item);
+   if ( frame->clipped > 0 ) {
+       expert_add_info_format(pinfo, generated_item, &ei_wb_overload,
+           "ADC overload: %u clipped samples in spectrum frame %u", frame->clipped, frame->number);
+   }
+   generated_item = proto_tree_add_uint(spectrum_tree, hf_openhpsdr_e_wb_overloads, tvb, offset, 0, frame->overloads);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(spectrum_tree, hf_openhpsdr_e_wb_averaged, tvb, offset, 0, frame->averaged);
+   proto_item_set_generated(generated_item);
+}
+
+// Export the samples of an in order Mic / Line or DDC Audio datagram, on the
+// first pass. stream: HPSDR_E_EXPORT_MICL (from the radio) or
+// HPSDR_E_EXPORT_DDCA (to the radio).
+void openhpsdr_e_audio_export(tvbuff_t *tvb, packet_info *pinfo, guint stream, guint channels,
+    openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   guint64 lost_frames = 0;
+   guint length = 64 * channels * 2;
+
+   if ( !openhpsdr_e_audio_wav || PINFO_FD_VISITED(pinfo) ) { return; }
+   if ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) { return; }
+   if ( tvb_captured_length(tvb) < 4 + length ) { return; }
+
+   // Each radio has its own export files
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
+   if ( radio == NULL ) { return; }
+   if ( radio->export_files == NULL ) {
+       radio->export_files = openhpsdr_e_export_new(address_to_str(pinfo->pool,
+                                 ( stream == HPSDR_E_EXPORT_MICL ) ? &pinfo->src : &pinfo->dst));
+   }
+
+   if ( seq_info != NULL && !seq_info->first ) {
+       lost_frames = (guint64)seq_info->lost * 64;
+   }
+
+   openhpsdr_e_export_audio((openhpsdr_e_export_t *)radio->export_files, openhpsdr_e_export_dir, stream,
+       tvb_get_ptr(tvb, 4, length), 64, channels, lost_frames, nstime_to_sec(&pinfo->abs_ts));
+}
+
+// Pacing analysis of a stream of samples_num sample datagrams at sample_rate,
+// on the first pass. The samples of lost datagrams are counted as played.
+// Duplicate and out of order datagrams are left out.
+openhpsdr_e_pacing_info_t *openhpsdr_e_pacing_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, guint32 samples_num, guint32 sample_rate, openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_pacing_info_t *pacing_info = NULL;
+   gboolean created = FALSE;
+   guint64 lost_samples = 0;
+   gdouble buffer = openhpsdr_e_pacing_buffer / 1000.0;
+   gdouble late = 0.0;
+   nstime_t elapsed;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_pacing_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_PACING);
+   }
+
+   if ( openhpsdr_e_streams == NULL || sample_rate == 0 ) { return NULL; }
+   if ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) { return NULL; }
+
+   stream = openhpsdr_e_find_stream(pinfo, from_hw, dg_type, index, &created);
+
+   if ( !stream->pace_valid || ( seq_info != NULL && seq_info->restart ) ) {
+       stream->pace_valid = TRUE;
+       stream->pace_base = pinfo->abs_ts;
+       stream->pace_samples = samples_num;
+       stream->depth_base = pinfo->abs_ts;
+       stream->depth_samples = samples_num;
+       stream->late_min = 0.0;
+       stream->late_max = 0.0;
+       return NULL;
+   }
+
+   if ( seq_info != NULL ) {
+       lost_samples = (guint64)seq_info->lost * samples_num;
+   }
+   stream->pace_samples += lost_samples;
+   stream->depth_samples += lost_samples;
+
+   pacing_info = wmem_new0(wmem_file_scope(), openhpsdr_e_pacing_info_t);
+
+   // Jitter buffer needed: the spread of the arrivals against one schedule.
+   nstime_delta(&elapsed, &pinfo->abs_ts, &stream->depth_base);
+   late = nstime_to_sec(&elapsed) - ( (gdouble)stream->depth_samples / sample_rate );
+   stream->late_min = MIN(stream->late_min, late);
+   stream->late_max = MAX(stream->late_max, late);
+   pacing_info->depth = ( stream->late_max - stream->late_min ) * 1000.0;
+
+   nstime_delta(&elapsed, &pinfo->abs_ts, &stream->pace_base);
+   late = nstime_to_sec(&elapsed) - ( (gdouble)stream->pace_samples / sample_rate );
+   pacing_info->lateness = late * 1000.0;
+
+   if ( late > buffer ) {
+       pacing_info->underrun = TRUE;
+       stream->underruns++;
+   } else if ( late < -buffer ) {
+       pacing_info->overrun = TRUE;
+       stream->overruns++;
+   }
+
+   if ( pacing_info->underrun || pacing_info->overrun ) {
+       stream->pace_base = pinfo->abs_ts;
+       stream->pace_samples = 0;
+   }
+   stream->pace_samples += samples_num;
+   stream->depth_samples += samples_num;
+
+   pacing_info->underruns = stream->underruns;
+   pacing_info->overruns = stream->overruns;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_PACING, pacing_info);
+
+   return pacing_info;
+}
+
+// Add the pacing items. Called with a NULL tree for the expert info and Info
+// column without a tree.
+void openhpsdr_e_pacing_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_pacing_info_t *pacing_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *pacing_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *pacing_tree = NULL;
+
+   if ( pacing_info == NULL ) { return; }
+
+   pacing_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_pacing, tvb, offset, 0, placehold,
+       "Pacing Analysis: %+.3f mS, Jitter Buffer Needed %.3f mS", pacing_info->lateness, pacing_info->depth);
+   proto_item_set_generated(pacing_item);
+   pacing_tree = proto_item_add_subtree(pacing_item, ett_openhpsdr_e_pacing);
+
+   generated_item = proto_tree_add_double(pacing_tree, hf_openhpsdr_e_pacing_lateness, tvb, offset, 0,
+                        pacing_info->lateness);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(pacing_tree, hf_openhpsdr_e_pacing_depth, tvb, offset, 0,
+                        pacing_info->depth);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_boolean(pacing_tree, hf_openhpsdr_e_pacing_underrun, tvb, offset, 0,
+                        pacing_info->underrun);
+   proto_item_set_generated(generated_item);
+   if ( pacing_info->underrun ) {
+       expert_add_info_format(pinfo, generated_item, &ei_pacing_underrun,
+           "Under-run: %.3f mS late, the jitter buffer is %u mS", pacing_info->lateness, openhpsdr_e_pacing_buffer);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Under-run]");
+   }
+   generated_item = proto_tree_add_boolean(pacing_tree, hf_openhpsdr_e_pacing_overrun, tvb, offset, 0,
+                        pacing_info->overrun);
+   proto_item_set_generated(generated_item);
+   if ( pacing_info->overrun ) {
+       expert_add_info_format(pinfo, generated_item, &ei_pacing_overrun,
+           "Over-run: %.3f mS early, the jitter buffer holds %u mS", -pacing_info->lateness,
+           openhpsdr_e_pacing_buffer * 2);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Over-run]");
+   }
+   generated_item = proto_tree_add_uint(pacing_tree, hf_openhpsdr_e_pacing_underruns, tvb, offset, 0,
+                        pacing_info->underruns);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(pacing_tree, hf_openhpsdr_e_pacing_overruns, tvb, offset, 0,
+                        pacing_info->overruns);
+   proto_item_set_generated(generated_item);
+}
+
+// DUC I&Q FIFO model of a DUC, on the first pass. Duplicate and out of order
+// datagrams are left out. A gap of HPSDR_E_FIFO_IDLE ends a transmission, the
+// model starts again with an empty FIFO.
+openhpsdr_e_fifo_info_t *openhpsdr_e_fifo_analysis(packet_info *pinfo, gint duc_num,
+    openhpsdr_e_seq_info_t *seq_info)
+{
+   openhpsdr_e_stream_t *stream = NULL;
+   openhpsdr_e_fifo_info_t *fifo_info = NULL;
+   openhpsdr_e_config_t *config = NULL;
+   gboolean created = FALSE;
+   gdouble size = (gdouble)openhpsdr_e_duc_fifo;
+   gdouble samples = HPSDR_E_DUCIQ_SAMPLES;
+   gdouble interval = 0.0;
+   guint32 rate = HPSDR_E_DUC_RATE * 1000;
+   nstime_t elapsed;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_fifo_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_FIFO);
+   }
+
+   if ( openhpsdr_e_streams == NULL || duc_num < 0 || openhpsdr_e_duc_fifo < HPSDR_E_DUCIQ_SAMPLES ) {
+       return NULL;
+   }
+   if ( seq_info != NULL && ( seq_info->duplicate || seq_info->out_of_order ) ) { return NULL; }
+
+   stream = openhpsdr_e_find_stream(pinfo, FALSE, HPSDR_E_DG_DUCIQ, (guint16)duc_num, &created);
+
+   if ( stream->fifo_valid ) {
+       nstime_delta(&elapsed, &pinfo->abs_ts, &stream->fifo_time);
+       interval = nstime_to_sec(&elapsed);
+   }
+   stream->fifo_time = pinfo->abs_ts;
+
+   if ( !stream->fifo_valid || interval > HPSDR_E_FIFO_IDLE || ( seq_info != NULL && seq_info->restart ) ) {
+       stream->fifo_valid = TRUE;
+       stream->fifo_fill = samples;
+       stream->fifo_draining = FALSE;
+       return NULL;
+   }
+
+   fifo_info = wmem_new0(wmem_file_scope(), openhpsdr_e_fifo_info_t);
+
+   config = openhpsdr_e_config_at(pinfo);
+   if ( config != NULL && config->ducc != NULL && config->ducc->duc0_rate != 0 ) {
+       fifo_info->have_rate = TRUE;
+       rate = config->ducc->duc0_rate * 1000;
+   }
+   fifo_info->rate = rate;
+   fifo_info->interval = interval * 1000.0;
+   fifo_info->expected = ( samples * 1000.0 ) / rate;
+
+   // Taken by the DUC since the previous datagram.
+   if ( stream->fifo_draining ) {
+       stream->fifo_fill -= interval * rate;
+       if ( stream->fifo_fill < 0 ) {
+           fifo_info->underrun = TRUE;
+           fifo_info->starved = ( -stream->fifo_fill * 1000.0 ) / rate;
+           stream->fifo_underruns++;
+           stream->fifo_fill = 0;
+           stream->fifo_draining = FALSE;
+       } else if ( stream->fifo_fill < size / 4 ) {
+           fifo_info->behind = TRUE;
+       }
+   }
+
+   if ( seq_info != NULL ) {
+       samples += (gdouble)seq_info->lost * HPSDR_E_DUCIQ_SAMPLES;
+   }
+   stream->fifo_fill += samples;
+   if ( stream->fifo_fill > size ) {
+       fifo_info->overflow = TRUE;
+       stream->fifo_overflows++;
+       stream->fifo_fill = size;
+   }
+   fifo_info->ahead = stream->fifo_fill > ( size * 3 ) / 4;
+
+   if ( !stream->fifo_draining && stream->fifo_fill >= size / 2 ) {
+       stream->fifo_draining = TRUE;
+   }
+
+   fifo_info->fill = stream->fifo_fill;
+   fifo_info->fill_ms = ( stream->fifo_fill * 1000.0 ) / rate;
+   fifo_info->underruns = stream->fifo_underruns;
+   fifo_info->overflows = stream->fifo_overflows;
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_FIFO, fifo_info);
+
+   return fifo_info;
+}
+
+// Add the DUC FIFO model items. Called with a NULL tree for the expert info and
+// Info column without a tree.
+void openhpsdr_e_fifo_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_fifo_info_t *fifo_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *fifo_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *fifo_tree = NULL;
+
+   if ( fifo_info == NULL ) { return; }
+
+   fifo_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_fifo, tvb, offset, 0, placehold,
+       "DUC FIFO Model: %.0f Samples (%.3f mS), Interval %.3f mS, Expected %.3f mS",
+       fifo_info->fill, fifo_info->fill_ms, fifo_info->interval, fifo_info->expected);
+   proto_item_set_generated(fifo_item);
+   if ( !fifo_info->have_rate ) {
+       proto_item_append_text(fifo_item, " (assumed %u ksps)", HPSDR_E_DUC_RATE);
+   }
+   fifo_tree = proto_item_add_subtree(fifo_item, ett_openhpsdr_e_fifo);
+
+   generated_item = proto_tree_add_uint(fifo_tree, hf_openhpsdr_e_fifo_rate, tvb, offset, 0, fifo_info->rate);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(fifo_tree, hf_openhpsdr_e_fifo_interval, tvb, offset, 0,
+                        fifo_info->interval);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(fifo_tree, hf_openhpsdr_e_fifo_expected, tvb, offset, 0,
+                        fifo_info->expected);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(fifo_tree, hf_openhpsdr_e_fifo_fill, tvb, offset, 0, fifo_info->fill);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_double(fifo_tree, hf_openhpsdr_e_fifo_fill_ms, tvb, offset, 0,
+                        fifo_info->fill_ms);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_boolean(fifo_tree, hf_openhpsdr_e_fifo_behind, tvb, offset, 0,
+                        fifo_info->behind);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_boolean(fifo_tree, hf_openhpsdr_e_fifo_ahead, tvb, offset, 0,
+                        fifo_info->ahead);
+   proto_item_set_generated(generated_item);
+
+   generated_item = proto_tree_add_boolean(fifo_tree, hf_openhpsdr_e_fifo_underrun, tvb, offset, 0,
+                        fifo_info->underrun);
+   proto_item_set_generated(generated_item);
+   if ( fifo_info->underrun ) {
+       expert_add_info_format(pinfo, generated_item, &ei_fifo_underrun,
+           "Likely DUC FIFO under-run: %.3f mS since the previous datagram, the FIFO was empty for %.3f mS",
+           fifo_info->interval, fifo_info->starved);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Under-run]");
+
+       generated_item = proto_tree_add_double(fifo_tree, hf_openhpsdr_e_fifo_starved, tvb, offset, 0,
+                            fifo_info->starved);
+       proto_item_set_generated(generated_item);
+   }
+
+   generated_item = proto_tree_add_boolean(fifo_tree, hf_openhpsdr_e_fifo_overflow, tvb, offset, 0,
+                        fifo_info->overflow);
+   proto_item_set_generated(generated_item);
+   if ( fifo_info->overflow ) {
+       expert_add_info_format(pinfo, generated_item, &ei_fifo_overflow,
+           "DUC FIFO overflow: %.3f mS since the previous datagram, the FIFO holds %u samples",
+           fifo_info->interval, openhpsdr_e_duc_fifo);
+       col_append_str(pinfo->cinfo, COL_INFO, " [Overflow]");
+   }
+
+   generated_item = proto_tree_add_uint(fifo_tree, hf_openhpsdr_e_fifo_underruns, tvb, offset, 0,
+                        fifo_info->underruns);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(fifo_tree, hf_openhpsdr_e_fifo_overflows, tvb, offset, 0,
+                        fifo_info->overflows);
+   proto_item_set_generated(generated_item);
+}
+
+// Transmit latency, on the first pass. shown: the HPSDR_E_TX_* milestones the
+// datagram shows, HPSDR_E_TX_KEY for a High Priority Command with PTT on.
+openhpsdr_e_tx_info_t *openhpsdr_e_tx_analysis(packet_info *pinfo, guint8 dg_type, guint8 shown)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_tx_info_t *tx_info = NULL;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_tx_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_TX);
+   }
+
+   // Only a PTT command opens a radio not seen before
+   radio = openhpsdr_e_find_radio(pinfo, ( dg_type == HPSDR_E_DG_HPC && ( shown & HPSDR_E_TX_KEY ) ));
+   if ( radio == NULL ) { return NULL; }
+
+   if ( dg_type == HPSDR_E_DG_HPC ) {
+       if ( !( shown & HPSDR_E_TX_KEY ) ) {
+           radio->tx_keyed = FALSE;
+           return NULL;
+       }
+       if ( radio->tx_keyed ) { return NULL; }
+
+       radio->tx_keyed = TRUE;
+       radio->tx_events++;
+       radio->tx_key_time = pinfo->abs_ts;
+       radio->tx_key_frame = pinfo->num;
+       radio->tx_seen = HPSDR_E_TX_KEY;
+   } else {
+       // Milestones not yet reached in the open event
+       shown &= ~radio->tx_seen;
+       if ( !radio->tx_keyed || shown == 0 ) { return NULL; }
+       radio->tx_seen |= shown;
+   }
+
+   tx_info = wmem_new0(wmem_file_scope(), openhpsdr_e_tx_info_t);
+   tx_info->event = radio->tx_events;
+   tx_info->key_frame = radio->tx_key_frame;
+   tx_info->milestones = shown;
+   nstime_delta(&tx_info->latency, &pinfo->abs_ts, &radio->tx_key_time);
+
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_TX, tx_info);
+
+   return tx_info;
+}
+
+void openhpsdr_e_tx_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, openhpsdr_e_tx_info_t *tx_info)
+{
+   const char *placehold = NULL ;
+
+   proto_item *tx_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *tx_tree = NULL;
+
+   if ( tree == NULL || tx_info == NULL ) { return; }
+
+   if ( tx_info->milestones & HPSDR_E_TX_KEY ) {
+       tx_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_tx, tvb, offset, 0, placehold,
+           "Transmit Event %u: PTT On", tx_info->event);
+   } else {
+       tx_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_tx, tvb, offset, 0, placehold,
+           "Transmit Event %u: %s%s%s%.3f mS after the PTT command", tx_info->event,
+           ( tx_info->milestones & HPSDR_E_TX_PTT ) ? "PTT Status, " : "",
+           ( tx_info->milestones & HPSDR_E_TX_DUCIQ ) ? "First DUC I&Q, " : "",
+           ( tx_info->milestones & HPSDR_E_TX_RF ) ? "First RF, " : "",
+           nstime_to_msec(&tx_info->latency));
+   }
+   proto_item_set_generated(tx_item);
+   tx_tree = proto_item_add_subtree(tx_item, ett_openhpsdr_e_tx);
 
-   // XML Hardware Description
-   if ( board_id == 254 ) {
+   generated_item = proto_tree_add_uint(tx_tree, hf_openhpsdr_e_tx_event, tvb, offset, 0, tx_info->event);
+   proto_item_set_generated(generated_item);
 
-     proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,0,placehold,
-        "!!! XML Hardware Description Not Defined in Version 2.9 of Protocol !!!");
+   if ( tx_info->milestones & HPSDR_E_TX_KEY ) { return; }
 
-   // Full Hardware Description
-   } else if (board_id == 255 ) {
+   generated_item = proto_tree_add_uint(tx_tree, hf_openhpsdr_e_tx_key_frame, tvb, offset, 0, tx_info->key_frame);
+   proto_item_set_generated(generated_item);
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc0_ver,tvb,offset,1,value,
-         "Mercury0   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   if ( tx_info->milestones & HPSDR_E_TX_PTT ) {
+       generated_item = proto_tree_add_time(tx_tree, hf_openhpsdr_e_tx_ptt, tvb, offset, 0, &tx_info->latency);
+       proto_item_set_generated(generated_item);
+   }
+   if ( tx_info->milestones & HPSDR_E_TX_DUCIQ ) {
+       generated_item = proto_tree_add_time(tx_tree, hf_openhpsdr_e_tx_duciq, tvb, offset, 0, &tx_info->latency);
+       proto_item_set_generated(generated_item);
+   }
+   if ( tx_info->milestones & HPSDR_E_TX_RF ) {
+       generated_item = proto_tree_add_time(tx_tree, hf_openhpsdr_e_tx_rf, tvb, offset, 0, &tx_info->latency);
+       proto_item_set_generated(generated_item);
+   }
+}
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc1_ver,tvb,offset,1,value,
-         "Mercury1   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+// CW keying, on the first pass. key_down: the key state of the datagram.
+openhpsdr_e_cw_info_t *openhpsdr_e_cw_analysis(packet_info *pinfo, guint8 source, gboolean key_down)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_cw_info_t *cw_info = NULL;
+   openhpsdr_e_config_t *config = NULL;
+   gdouble dot = 0.0;
+   gdouble extra = 0.0;
+   nstime_t elapsed;
+
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_cw_info_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_CW);
+   }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc2_ver,tvb,offset,1,value,
-         "Mercury2   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   // Only a key down opens a radio not seen before
+   radio = openhpsdr_e_find_radio(pinfo, key_down);
+   if ( radio == NULL ) { return NULL; }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc3_ver,tvb,offset,1,value,
-         "Mercury3   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   if ( !radio->cw_valid[source] ) {
+       radio->cw_valid[source] = TRUE;
+       radio->cw_down[source] = key_down;
+       radio->cw_last_time[source] = pinfo->abs_ts;
+       return NULL;
+   }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_penny_ver,tvb,offset,1,value,
-         "Penny      Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   if ( key_down == radio->cw_down[source] ) {
+       radio->cw_last_time[source] = pinfo->abs_ts;
+       return NULL;
+   }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_metis_ver,tvb,offset,1,value,
-         "Metis      Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   cw_info = wmem_new0(wmem_file_scope(), openhpsdr_e_cw_info_t);
+   cw_info->source = source;
+   cw_info->key_down = key_down;
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_hpsdr_fw, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   // The High Priority Status is periodic, a hardware edge happened somewhere
+   // since the previous one. A High Priority Command is only sent on a change,
+   // the host edge is the command itself and has no resolution.
+   if ( source == HPSDR_E_CW_HW ) {
+       nstime_delta(&elapsed, &pinfo->abs_ts, &radio->cw_last_time[source]);
+       cw_info->resolution = nstime_to_msec(&elapsed);
+   }
+   radio->cw_last_time[source] = pinfo->abs_ts;
+
+   config = openhpsdr_e_config_at(pinfo);
+   if ( config != NULL && config->ducc != NULL && config->ducc->keyer_speed != 0 ) {
+       cw_info->have_keyer = TRUE;
+       cw_info->wpm = config->ducc->keyer_speed;
+       cw_info->weight = config->ducc->keyer_weight;
+       // PARIS timing, the weight moves time from the space to the mark
+       dot = 1200.0 / cw_info->wpm;
+       extra = ( dot * ( (gdouble)cw_info->weight - 50.0 ) ) / 50.0;
+       cw_info->jitter = cw_info->resolution > ( dot * HPSDR_E_CW_TOLERANCE );
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_udp_ports, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( radio->cw_have_edge[source] ) {
+       nstime_delta(&elapsed, &pinfo->abs_ts, &radio->cw_edge_time[source]);
+       cw_info->length = nstime_to_msec(&elapsed);
+
+       if ( !cw_info->have_keyer ) {
+           cw_info->element = key_down ? HPSDR_E_CW_SPACE : HPSDR_E_CW_MARK;
+       } else if ( !key_down ) {
+           cw_info->element = ( cw_info->length < ( 2.0 * dot ) ) ? HPSDR_E_CW_DOT : HPSDR_E_CW_DASH;
+           cw_info->expected = ( ( cw_info->element == HPSDR_E_CW_DOT ) ? dot : 3.0 * dot ) + extra;
+       } else if ( cw_info->length < ( 2.0 * dot ) ) {
+           cw_info->element = HPSDR_E_CW_SPACE;
+           cw_info->expected = dot - extra;
+       } else {
+           cw_info->element = HPSDR_E_CW_GAP;
+       }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_fixed_ip, tvb,offset, 1, boolean_byte);
-      offset += 1;
+       if ( cw_info->expected > 0 ) {
+           cw_info->error = cw_info->length - cw_info->expected;
+           cw_info->off_timing = fabs(cw_info->error) >
+               ( ( dot * HPSDR_E_CW_TOLERANCE ) + cw_info->resolution + radio->cw_edge_res[source] );
+       }
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_mem, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   radio->cw_down[source] = key_down;
+   radio->cw_have_edge[source] = TRUE;
+   radio->cw_edge_time[source] = pinfo->abs_ts;
+   radio->cw_edge_res[source] = cw_info->resolution;
+
+   if ( key_down && source == HPSDR_E_CW_HOST ) {
+       radio->cw_pending = TRUE;
+       radio->cw_key_time = pinfo->abs_ts;
+       radio->cw_key_frame = pinfo->num;
+   } else if ( key_down && radio->cw_pending ) {
+       radio->cw_pending = FALSE;
+       nstime_delta(&elapsed, &pinfo->abs_ts, &radio->cw_key_time);
+       if ( nstime_to_sec(&elapsed) < HPSDR_E_CW_IDLE ) {
+           cw_info->have_latency = TRUE;
+           cw_info->key_frame = radio->cw_key_frame;
+           cw_info->latency = elapsed;
+       }
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_alex_rx_filters, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_CW, cw_info);
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_alex_tx_filters, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   return cw_info;
+}
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_vita_49, tvb,offset, 1, boolean_byte);
-      offset += 1;
+void openhpsdr_e_cw_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_cw_info_t *cw_info)
+{
+   const char *placehold = NULL ;
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_dsp_clock, tvb,offset, 4,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," Hz");
-      offset += 4;
+   proto_item *cw_item = NULL;
+   proto_item *generated_item = NULL;
+   proto_tree *cw_tree = NULL;
 
-      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,5,placehold,
-         "Additional Settings   : Reserved for Future Use");
-      offset += 5;
+   if ( cw_info == NULL ) { return; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   cw_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_cw, tvb, offset, 0, placehold,
+       "CW Keying: %s Key %s",
+       ( cw_info->source == HPSDR_E_CW_HOST ) ? "Host" : "Hardware",
+       cw_info->key_down ? "Down" : "Up");
+   proto_item_set_generated(cw_item);
+   if ( cw_info->source == HPSDR_E_CW_HW ) {
+       proto_item_append_text(cw_item, ", Resolution %.3f mS", cw_info->resolution);
+   }
+   if ( cw_info->element != HPSDR_E_CW_NONE ) {
+       proto_item_append_text(cw_item, ", %s %.3f mS",
+           val_to_str_const(cw_info->element, cw_elements, "Unknown"), cw_info->length);
+   }
+   cw_tree = proto_item_add_subtree(cw_item, ett_openhpsdr_e_cw);
+
+   generated_item = proto_tree_add_boolean(cw_tree, hf_openhpsdr_e_cw_key, tvb, offset, 0, cw_info->key_down);
+   proto_item_set_generated(generated_item);
+   generated_item = proto_tree_add_uint(cw_tree, hf_openhpsdr_e_cw_element, tvb, offset, 0, cw_info->element);
+   proto_item_set_generated(generated_item);
+   if ( cw_info->element != HPSDR_E_CW_NONE ) {
+       generated_item = proto_tree_add_double(cw_tree, hf_openhpsdr_e_cw_length, tvb, offset, 0, cw_info->length);
+       proto_item_set_generated(generated_item);
+   }
+   if ( cw_info->source == HPSDR_E_CW_HW ) {
+       generated_item = proto_tree_add_double(cw_tree, hf_openhpsdr_e_cw_resolution, tvb, offset, 0,
+                            cw_info->resolution);
+       proto_item_set_generated(generated_item);
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_dither, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( cw_info->have_keyer ) {
+       generated_item = proto_tree_add_uint(cw_tree, hf_openhpsdr_e_cw_wpm, tvb, offset, 0, cw_info->wpm);
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_uint(cw_tree, hf_openhpsdr_e_cw_weight, tvb, offset, 0, cw_info->weight);
+       proto_item_set_generated(generated_item);
+
+       if ( cw_info->source == HPSDR_E_CW_HW ) {
+           generated_item = proto_tree_add_boolean(cw_tree, hf_openhpsdr_e_cw_jitter, tvb, offset, 0,
+                                cw_info->jitter);
+           proto_item_set_generated(generated_item);
+           if ( cw_info->jitter ) {
+               expert_add_info_format(pinfo, generated_item, &ei_cw_jitter,
+                   "CW key edge resolution %.3f mS, above a quarter dot at %u WPM",
+                   cw_info->resolution, cw_info->wpm);
+           }
+       }
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_adc_random, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( cw_info->expected > 0 ) {
+       generated_item = proto_tree_add_double(cw_tree, hf_openhpsdr_e_cw_expected, tvb, offset, 0,
+                            cw_info->expected);
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_double(cw_tree, hf_openhpsdr_e_cw_error, tvb, offset, 0, cw_info->error);
+       proto_item_set_generated(generated_item);
+
+       generated_item = proto_tree_add_boolean(cw_tree, hf_openhpsdr_e_cw_off_timing, tvb, offset, 0,
+                            cw_info->off_timing);
+       proto_item_set_generated(generated_item);
+       if ( cw_info->off_timing ) {
+           expert_add_info_format(pinfo, generated_item, &ei_cw_timing,
+               "CW %s of %.3f mS, expected %.3f mS at %u WPM weight %u",
+               val_to_str_const(cw_info->element, cw_elements, "Unknown"), cw_info->length,
+               cw_info->expected, cw_info->wpm, cw_info->weight);
+           col_append_str(pinfo->cinfo, COL_INFO, " [CW Off Timing]");
+       }
+   }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   if ( cw_info->have_latency ) {
+       generated_item = proto_tree_add_uint(cw_tree, hf_openhpsdr_e_cw_key_frame, tvb, offset, 0,
+                            cw_info->key_frame);
+       proto_item_set_generated(generated_item);
+       generated_item = proto_tree_add_time(cw_tree, hf_openhpsdr_e_cw_latency, tvb, offset, 0, &cw_info->latency);
+       proto_item_set_generated(generated_item);
+       proto_item_append_text(cw_item, ", Latency %.3f mS", nstime_to_msec(&cw_info->latency));
+   }
+}
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_freq_phase, tvb,offset, 1, boolean_byte);
-      offset += 1;
+// High Priority Status telemetry in watts, volts and SWR with the power bridge
+// calibration of the radio board, and the time series export, on the first
+// pass.
+openhpsdr_e_telem_t *openhpsdr_e_telem_analysis(tvbuff_t *tvb, packet_info *pinfo, gboolean ptt)
+{
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_telem_t *telem = NULL;
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_atten, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( PINFO_FD_VISITED(pinfo) ) {
+       return (openhpsdr_e_telem_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+                  HPSDR_E_PDATA_TELEM);
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( tvb_captured_length(tvb) < HPSDR_E_HPS_TELEM_LEN ) { return NULL; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
-      offset += 2;
+   radio = openhpsdr_e_find_radio(pinfo, TRUE);
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_var, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   // Exciter power 0 at byte 6, Alex 0 forward at 14 and reverse at 22,
+   // supply voltage at 49
+   telem = wmem_new(wmem_file_scope(), openhpsdr_e_telem_t);
+   openhpsdr_e_telem_convert(( radio != NULL ) ? radio->board_id : 0xFF, tvb_get_ntohs(tvb, 6),
+       tvb_get_ntohs(tvb, 14), tvb_get_ntohs(tvb, 22), tvb_get_ntohs(tvb, 49), telem);
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_size, tvb,offset, 1,
-        ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," Bits");
-      offset += 1;
+   if ( radio != NULL && openhpsdr_e_telem_format != HPSDR_E_TELEM_NONE ) {
+       if ( radio->telem == NULL ) {
+           radio->telem = openhpsdr_e_telem_new(address_to_str(pinfo->pool, &pinfo->src));
+       }
+       openhpsdr_e_telem_add((openhpsdr_e_telem_series_t *)radio->telem, telem, ptt,
+           nstime_to_sec(&pinfo->abs_ts), openhpsdr_e_export_dir, openhpsdr_e_telem_format,
+           openhpsdr_e_telem_interval);
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_update, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_TELEM, telem);
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_update_rate,
-         tvb,offset, 1, ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," mS");
-      offset += 1;
+   return telem;
+}
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_datagram, tvb,offset, 1, boolean_byte);
-      offset += 1;
+// Queue the tap record of a datagram. from_hw: the hardware is the source.
+void openhpsdr_e_tap_queue(packet_info *pinfo, gboolean from_hw, guint8 dg_type, gint index,
+    guint32 sequence_num, guint32 samples, guint8 sample_bits, openhpsdr_e_seq_info_t *seq_info,
+    openhpsdr_e_iat_info_t *iat_info, openhpsdr_e_pacing_info_t *pacing_info,
+    openhpsdr_e_fifo_info_t *fifo_info, openhpsdr_e_tx_info_t *tx_info, openhpsdr_e_cw_info_t *cw_info)
+{
+   openhpsdr_e_tap_info_t *tap_info = NULL;
+
+   if ( !have_tap_listener(openhpsdr_e_tap) ) { return; }
+
+   tap_info = wmem_new0(pinfo->pool, openhpsdr_e_tap_info_t);
+   copy_address_shallow(&tap_info->hw_addr, from_hw ? &pinfo->src : &pinfo->dst);
+   tap_info->dg_type = dg_type;
+   tap_info->index = index;
+   tap_info->sequence_num = sequence_num;
+   tap_info->samples = samples;
+   tap_info->sample_bits = sample_bits;
+   tap_info->frame_len = pinfo->fd->pkt_len;
+
+   if ( seq_info != NULL ) {
+       tap_info->lost = seq_info->lost;
+       tap_info->duplicate = seq_info->duplicate;
+       tap_info->out_of_order = seq_info->out_of_order;
+   }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_wb_fixed_datagrams_frame, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   if ( iat_info != NULL ) {
+       tap_info->have_iat = TRUE;
+       tap_info->iat_us = (guint32)MIN(nstime_to_sec(&iat_info->delta) * 1000000.0, (gdouble)G_MAXINT32);
+       tap_info->burst = iat_info->burst;
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rates, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( pacing_info != NULL ) {
+       tap_info->have_pacing = TRUE;
+       tap_info->lateness_us = (gint32)CLAMP(pacing_info->lateness * 1000.0, (gdouble)-G_MAXINT32, (gdouble)G_MAXINT32);
+       tap_info->depth_us = (guint32)MIN(pacing_info->depth * 1000.0, (gdouble)G_MAXINT32);
+       tap_info->underrun = pacing_info->underrun;
+       tap_info->overrun = pacing_info->overrun;
+   }
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_min, tvb,offset, 2,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," ksps");
-      offset += 2;
+   if ( fifo_info != NULL ) {
+       tap_info->have_fifo = TRUE;
+       tap_info->fifo_fill = (guint32)fifo_info->fill;
+       tap_info->behind = fifo_info->behind;
+       tap_info->ahead = fifo_info->ahead;
+       tap_info->underrun = fifo_info->underrun;
+       tap_info->overrun = fifo_info->overflow;
+   }
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_rate_max, tvb,offset, 2,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," ksps");
-      offset += 2;
+   if ( tx_info != NULL ) {
+       tap_info->tx_milestones = tx_info->milestones;
+       tap_info->tx_latency_us = (guint32)MIN(nstime_to_sec(&tx_info->latency) * 1000000.0, (gdouble)G_MAXINT32);
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cic_dec, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( cw_info != NULL ) {
+       tap_info->have_cw = TRUE;
+       tap_info->cw_source = cw_info->source;
+       tap_info->cw_element = cw_info->element;
+       tap_info->cw_length_us = (guint32)MIN(cw_info->length * 1000.0, (gdouble)G_MAXINT32);
+       tap_info->cw_resolution_us = (guint32)MIN(cw_info->resolution * 1000.0, (gdouble)G_MAXINT32);
+       tap_info->cw_off_timing = cw_info->off_timing;
+       tap_info->cw_jitter = cw_info->jitter;
+       tap_info->have_cw_latency = cw_info->have_latency;
+       tap_info->cw_latency_us = (guint32)MIN(nstime_to_sec(&cw_info->latency) * 1000000.0, (gdouble)G_MAXINT32);
+   }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_sync_ddc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   tap_queue_packet(openhpsdr_e_tap, pinfo, tap_info);
+}
 
-      // 3.7 Change: Per 3.7 - DDC Multiplex Removed.
-      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved,tvb,offset,1,placehold,
-           "Number Multiplexed DDC       : Per 3.7 - DDC Multiplex Removed.");
-      offset += 1;
+// Stream state table of a new stats tree.
+static void openhpsdr_e_st_data_init(stats_tree *st)
+{
+   if ( openhpsdr_e_st_data == NULL ) {
+       openhpsdr_e_st_data = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                  (GDestroyNotify)g_hash_table_destroy);
+   }
+   g_hash_table_insert(openhpsdr_e_st_data, st, g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free));
+}
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_channels, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+static void openhpsdr_e_stats_tree_init(stats_tree *st)
+{
+   st_node_streams = stats_tree_create_node(st, st_str_streams, 0, TRUE);
+   openhpsdr_e_st_data_init(st);
+}
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_rate, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," ksps");
-      offset += 1;
+// The state of a stream node of a stats tree, made on first use.
+static openhpsdr_e_st_stream_t *openhpsdr_e_st_stream(stats_tree *st, int node)
+{
+   GHashTable *streams = NULL;
+   openhpsdr_e_st_stream_t *stream = NULL;
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_size, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," Bits");
-      offset += 1;
+   if ( openhpsdr_e_st_data == NULL ) { return NULL; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_codec_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
-      offset += 2;
+   streams = (GHashTable *)g_hash_table_lookup(openhpsdr_e_st_data, st);
+   if ( streams == NULL ) { return NULL; }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_iq_time_stamp, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   stream = (openhpsdr_e_st_stream_t *)g_hash_table_lookup(streams, GINT_TO_POINTER(node));
+   if ( stream == NULL ) {
+       stream = g_new0(openhpsdr_e_st_stream_t, 1);
+       g_hash_table_insert(streams, GINT_TO_POINTER(node), stream);
+   }
 
-      proto_tree_add_string_format(tree,hf_openhpsdr_e_reserved ,tvb,offset,5,placehold,
-         "Additional DDC Settings      : Reserved for Future Use");
-      offset += 5;
+   return stream;
+}
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+// Stats tree node name of a stream: the datagram type and the DDC, ADC or DUC.
+static gchar *openhpsdr_e_st_stream_name(packet_info *pinfo, const openhpsdr_e_tap_info_t *tap_info)
+{
+   const char *dg_name = NULL;
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   dg_name = val_to_str_const(tap_info->dg_type, openhpsdr_e_dg_type_vals, "Unknown");
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_mic, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( tap_info->dg_type == HPSDR_E_DG_WBD ) {
+       return wmem_strdup_printf(pinfo->pool, "%s - ADC %d", dg_name, tap_info->index);
+   } else if ( tap_info->dg_type == HPSDR_E_DG_DUCIQ ) {
+       return wmem_strdup_printf(pinfo->pool, "%s - DUC %d", dg_name, tap_info->index);
+   } else if ( tap_info->dg_type == HPSDR_E_DG_DDCIQ ) {
+       return wmem_strdup_printf(pinfo->pool, "%s - DDC %d", dg_name, tap_info->index);
+   }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_line, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   return wmem_strdup(pinfo->pool, dg_name);
+}
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_rate, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," ksps");
-      offset += 1;
+// Streams by radio. Each stream node counts datagrams, its children count the
+// samples, the frame kbit (the Rate column is then Mbit/s) and the sequence
+// problems.
+static tap_packet_status openhpsdr_e_stats_tree_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt _U_,
+    const void *p)
+{
+   const openhpsdr_e_tap_info_t *tap_info = (const openhpsdr_e_tap_info_t *)p;
+   openhpsdr_e_st_stream_t *st_stream = NULL;
+   gchar *radio_name = NULL;
+   gchar *stream_name = NULL;
+   int radio_node = -1;
+   int stream_node = -1;
+   guint32 bits = 0;
+
+   radio_name = wmem_strdup_printf(pinfo->pool, "Radio %s", address_to_str(pinfo->pool, &tap_info->hw_addr));
+   stream_name = openhpsdr_e_st_stream_name(pinfo, tap_info);
+
+   tick_stat_node(st, st_str_streams, 0, TRUE);
+   radio_node = tick_stat_node(st, radio_name, st_node_streams, TRUE);
+   stream_node = tick_stat_node(st, stream_name, radio_node, TRUE);
+
+   if ( tap_info->samples != 0 ) {
+       increase_stat_node(st, "Samples", stream_node, FALSE, tap_info->samples);
+   }
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_size, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," Bits");
-      offset += 1;
+   st_stream = openhpsdr_e_st_stream(st, stream_node);
+   if ( st_stream != NULL ) {
+       bits = st_stream->carry_bits + tap_info->frame_len * 8;
+       increase_stat_node(st, "Frame kbit (Rate = Mbit/s)", stream_node, FALSE, bits / 1000);
+       st_stream->carry_bits = bits % 1000;
+   }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_codec_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
-      offset += 2;
+   increase_stat_node(st, "Lost", stream_node, FALSE, tap_info->lost);
+   increase_stat_node(st, "Duplicate", stream_node, FALSE, tap_info->duplicate ? 1 : 0);
+   increase_stat_node(st, "Out of Order", stream_node, FALSE, tap_info->out_of_order ? 1 : 0);
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_freq_phase, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   return TAP_PACKET_REDRAW;
+}
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_rate, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," ksps");
-      offset += 1;
+// Histogram bin of an inter-arrival time in uS.
+static guint openhpsdr_e_iat_bin(guint32 value)
+{
+   guint octave = 0;
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_tx_iq_size, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," Bits");
-      offset += 1;
+   if ( value < (1U << HPSDR_E_IAT_SUB_BITS) ) { return value; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_iq_samples, tvb,offset, 2, ENC_BIG_ENDIAN);
-      offset += 2;
+   while ( ( value >> octave ) >= (2U << HPSDR_E_IAT_SUB_BITS) ) { octave++; }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_env_track, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   return ( octave + 1 ) * (1U << HPSDR_E_IAT_SUB_BITS) + ( ( value >> octave ) & ((1U << HPSDR_E_IAT_SUB_BITS) - 1) );
+}
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_sidetone, tvb,offset, 1, boolean_byte);
-      offset += 1;
+// Lowest inter-arrival time in uS of a histogram bin.
+static guint32 openhpsdr_e_iat_bin_value(guint bin)
+{
+   guint octave = 0;
+   guint32 sub = 0;
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_host, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( bin < (1U << HPSDR_E_IAT_SUB_BITS) ) { return bin; }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_iambic, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   octave = bin / (1U << HPSDR_E_IAT_SUB_BITS) - 1;
+   sub = bin % (1U << HPSDR_E_IAT_SUB_BITS);
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_break, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   return ( (1U << HPSDR_E_IAT_SUB_BITS) + sub ) << octave;
+}
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_cw_hang, tvb,offset, 2,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," mS");
-      offset += 2;
+static void openhpsdr_e_stats_tree_iat_init(stats_tree *st)
+{
+   st_node_iat = stats_tree_create_node(st, st_str_iat, 0, TRUE);
+   openhpsdr_e_st_data_init(st);
+}
+
+// Inter-arrival time by radio and stream: a power of two histogram node, the
+// percentiles and the longest burst. The percentiles are the low edge of a
+// 1/8 octave bin.
+static tap_packet_status openhpsdr_e_stats_tree_iat_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt _U_,
+    const void *p)
+{
+   const openhpsdr_e_tap_info_t *tap_info = (const openhpsdr_e_tap_info_t *)p;
+   openhpsdr_e_st_stream_t *st_stream = NULL;
+   gchar *radio_name = NULL;
+   gchar *stream_name = NULL;
+   int radio_node = -1;
+   int stream_node = -1;
+   guint32 seen = 0;
+   guint bin = 0;
+   int i = -1;
 
-      append_text_item_disc = proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_delay, tvb,offset, 1,
-         ENC_BIG_ENDIAN);
-      proto_item_append_text(append_text_item_disc," mS");
-      offset += 1;
+   static const gchar *ranges[] = {
+       "0-1", "2-3", "4-7", "8-15", "16-31", "32-63", "64-127", "128-255", "256-511", "512-1023",
+       "1024-2047", "2048-4095", "4096-8191", "8192-16383", "16384-32767", "32768-65535",
+       "65536-131071", "131072-262143", "262144-524287", "524288-1048575", "1048576-"
+   };
+   static const struct {
+       const gchar *name;
+       guint32 permille;
+   } percentiles[] = {
+       { "p50", 500 }, { "p99", 990 }, { "p99.9", 999 }
+   };
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_phase_shift, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( !tap_info->have_iat ) { return TAP_PACKET_DONT_REDRAW; }
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_full_hw_duc_atten, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   radio_name = wmem_strdup_printf(pinfo->pool, "Radio %s", address_to_str(pinfo->pool, &tap_info->hw_addr));
+   stream_name = openhpsdr_e_st_stream_name(pinfo, tap_info);
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_oc, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   tick_stat_node(st, st_str_iat, 0, TRUE);
+   radio_node = tick_stat_node(st, radio_name, st_node_iat, TRUE);
+   stream_node = tick_stat_node(st, stream_name, radio_node, TRUE);
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_ddc_cal, tvb,offset, 2, ENC_BIG_ENDIAN);
-      offset += 2;
+   st_stream = openhpsdr_e_st_stream(st, stream_node);
+   if ( st_stream == NULL ) { return TAP_PACKET_REDRAW; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_full_hw_gen_adc, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   if ( !st_stream->have_range ) {
+       stats_tree_create_range_node_string(st, "Histogram", stream_node, G_N_ELEMENTS(ranges), (gchar **)ranges);
+       st_stream->have_range = TRUE;
+   }
+   stats_tree_tick_range(st, "Histogram", stream_node, (gint)tap_info->iat_us);
 
-      openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
+   st_stream->hist[openhpsdr_e_iat_bin(tap_info->iat_us)]++;
+   st_stream->iat_count++;
 
-   // "Standard" Boards
-   } else {
+   for ( i = 0; i < (int)G_N_ELEMENTS(percentiles); i++ ) {
+       seen = 0;
+       for ( bin = 0; bin < HPSDR_E_IAT_BINS; bin++ ) {
+           seen += st_stream->hist[bin];
+           if ( (guint64)seen * 1000 >= (guint64)st_stream->iat_count * percentiles[i].permille ) { break; }
+       }
+       set_int_stat_node(st, percentiles[i].name, stream_node, FALSE,
+           (gint)openhpsdr_e_iat_bin_value(MIN(bin, HPSDR_E_IAT_BINS - 1)));
+   }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc0_ver,tvb,offset,1,value,
-         "Mercury0   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   if ( tap_info->burst > st_stream->max_burst ) {
+       st_stream->max_burst = tap_info->burst;
+   }
+   set_int_stat_node(st, "Max Burst (Datagrams)", stream_node, FALSE, (gint)st_stream->max_burst);
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc1_ver,tvb,offset,1,value,
-         "Mercury1   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   return TAP_PACKET_REDRAW;
+}
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc2_ver,tvb,offset,1,value,
-         "Mercury2   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+static void openhpsdr_e_stats_tree_pacing_init(stats_tree *st)
+{
+   st_node_pacing = stats_tree_create_node(st, st_str_pacing, 0, TRUE);
+   openhpsdr_e_st_data_init(st);
+}
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_merc3_ver,tvb,offset,1,value,
-         "Mercury3   Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+// Pacing by radio and stream. Mic / Line and DDC Audio: the under-runs and
+// over-runs for the jitter buffer preference, the latest datagram and the
+// jitter buffer that would have been needed. DUC I&Q: the FIFO model
+// under-runs and overflows, the datagrams sent behind or ahead and the lowest
+// FIFO fill.
+static tap_packet_status openhpsdr_e_stats_tree_pacing_packet(stats_tree *st, packet_info *pinfo,
+    epan_dissect_t *edt _U_, const void *p)
+{
+   const openhpsdr_e_tap_info_t *tap_info = (const openhpsdr_e_tap_info_t *)p;
+   openhpsdr_e_st_stream_t *st_stream = NULL;
+   gchar *radio_name = NULL;
+   gchar *stream_name = NULL;
+   int radio_node = -1;
+   int stream_node = -1;
+
+   if ( !tap_info->have_pacing && !tap_info->have_fifo ) { return TAP_PACKET_DONT_REDRAW; }
+
+   radio_name = wmem_strdup_printf(pinfo->pool, "Radio %s", address_to_str(pinfo->pool, &tap_info->hw_addr));
+   stream_name = openhpsdr_e_st_stream_name(pinfo, tap_info);
+
+   tick_stat_node(st, st_str_pacing, 0, TRUE);
+   radio_node = tick_stat_node(st, radio_name, st_node_pacing, TRUE);
+   stream_node = tick_stat_node(st, stream_name, radio_node, TRUE);
+
+   increase_stat_node(st, "Under-runs", stream_node, FALSE, tap_info->underrun ? 1 : 0);
+   increase_stat_node(st, tap_info->have_fifo ? "Overflows" : "Over-runs", stream_node, FALSE,
+       tap_info->overrun ? 1 : 0);
+
+   st_stream = openhpsdr_e_st_stream(st, stream_node);
+   if ( st_stream == NULL ) { return TAP_PACKET_REDRAW; }
+
+   if ( tap_info->have_fifo ) {
+       increase_stat_node(st, "Host Behind", stream_node, FALSE, tap_info->behind ? 1 : 0);
+       increase_stat_node(st, "Host Ahead", stream_node, FALSE, tap_info->ahead ? 1 : 0);
+       if ( !st_stream->have_fill || tap_info->fifo_fill < st_stream->min_fill ) {
+           st_stream->min_fill = tap_info->fifo_fill;
+           st_stream->have_fill = TRUE;
+       }
+       set_int_stat_node(st, "Min FIFO Fill (Samples)", stream_node, FALSE, (gint)st_stream->min_fill);
+       return TAP_PACKET_REDRAW;
+   }
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_penny_ver,tvb,offset,1,value,
-         "Penny      Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   if ( tap_info->lateness_us > st_stream->max_late ) {
+       st_stream->max_late = tap_info->lateness_us;
+   }
+   set_int_stat_node(st, "Max Lateness (uS)", stream_node, FALSE, st_stream->max_late);
+   set_int_stat_node(st, "Jitter Buffer Needed (uS)", stream_node, FALSE, (gint)tap_info->depth_us);
 
-      value = tvb_get_guint8(tvb, offset);
-      proto_tree_add_uint_format(tree,hf_openhpsdr_e_cr_disc_metis_ver,tvb,offset,1,value,
-         "Metis      Version: %d.%.1d",(value/10),(value%10));
-      offset += 1;
+   return TAP_PACKET_REDRAW;
+}
 
-      proto_tree_add_item(tree,hf_openhpsdr_e_cr_disc_ddc_num,tvb,offset,1,ENC_BIG_ENDIAN);
-      offset += 1;
+static void openhpsdr_e_stats_tree_tx_init(stats_tree *st)
+{
+   st_node_tx = stats_tree_create_node(st, st_str_tx, 0, TRUE);
+}
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_freq_phase, tvb,offset, 1, boolean_byte);
-      offset += 1;
+// Transmit latency by radio: the transmit events and the average, minimum and
+// maximum time from the PTT command to each milestone.
+static tap_packet_status openhpsdr_e_stats_tree_tx_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt _U_,
+    const void *p)
+{
+   const openhpsdr_e_tap_info_t *tap_info = (const openhpsdr_e_tap_info_t *)p;
+   gchar *radio_name = NULL;
+   int radio_node = -1;
 
-      boolean_byte = tvb_get_guint8(tvb, offset);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_big_endian, tvb,offset, 1, boolean_byte);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_little_endian, tvb,offset, 1, boolean_byte);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_three_byte_ddciq, tvb,offset, 1, boolean_byte);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_float_ddciq, tvb,offset, 1, boolean_byte);
-      proto_tree_add_boolean(tree, hf_openhpsdr_e_cr_disc_double_ddciq, tvb,offset, 1, boolean_byte);
-      offset += 1;
+   if ( tap_info->tx_milestones == 0 ) { return TAP_PACKET_DONT_REDRAW; }
 
-      proto_tree_add_item(tree, hf_openhpsdr_e_cr_disc_beta_ver, tvb,offset, 1, ENC_BIG_ENDIAN);
-      offset += 1;
+   radio_name = wmem_strdup_printf(pinfo->pool, "Radio %s", address_to_str(pinfo->pool, &tap_info->hw_addr));
 
-      offset = cr_packet_end_pad(tvb,tree,offset,36);
-      openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
+   tick_stat_node(st, st_str_tx, 0, TRUE);
+   radio_node = tick_stat_node(st, radio_name, st_node_tx, TRUE);
+
+   if ( tap_info->tx_milestones & HPSDR_E_TX_KEY ) {
+       tick_stat_node(st, "Transmit Events", radio_node, FALSE);
+   }
+   if ( tap_info->tx_milestones & HPSDR_E_TX_PTT ) {
+       avg_stat_node_add_value(st, "PTT Status", radio_node, FALSE, (gint)tap_info->tx_latency_us);
+   }
+   if ( tap_info->tx_milestones & HPSDR_E_TX_DUCIQ ) {
+       avg_stat_node_add_value(st, "First DUC I&Q", radio_node, FALSE, (gint)tap_info->tx_latency_us);
+   }
+   if ( tap_info->tx_milestones & HPSDR_E_TX_RF ) {
+       avg_stat_node_add_value(st, "First RF", radio_node, FALSE, (gint)tap_info->tx_latency_us);
    }
 
-   return board_id;
+   return TAP_PACKET_REDRAW;
 }
 
-void openhpsdr_e_check_frame_length(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset)
+static void openhpsdr_e_stats_tree_cw_init(stats_tree *st)
 {
+   st_node_cw = stats_tree_create_node(st, st_str_cw, 0, TRUE);
+}
 
-   guint length_remaining = -1;
-   const char *placehold = NULL ;
+// CW keying by radio and key source: the average, minimum and maximum element
+// lengths, the hardware key edge resolution, the elements off timing, the
+// coarse edges and the host to hardware keying latency.
+static tap_packet_status openhpsdr_e_stats_tree_cw_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt _U_,
+    const void *p)
+{
+   const openhpsdr_e_tap_info_t *tap_info = (const openhpsdr_e_tap_info_t *)p;
+   gchar *radio_name = NULL;
+   int radio_node = -1;
+   int source_node = -1;
 
-   proto_item *ei_item = NULL;
+   if ( !tap_info->have_cw ) { return TAP_PACKET_DONT_REDRAW; }
 
-   if ( !(openhpsdr_e_strict_size) ) { return; }
+   radio_name = wmem_strdup_printf(pinfo->pool, "Radio %s", address_to_str(pinfo->pool, &tap_info->hw_addr));
 
-   if ( tvb_captured_length(tvb) > (guint)offset) {
-       length_remaining = tvb_ensure_captured_length_remaining(tvb, offset);
-       ei_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_cr_ei, tvb,
-                     offset, length_remaining, placehold,"Extra Length");
-       expert_add_info_format(pinfo,ei_item,&ei_cr_extra_length,
-           "Extra Bytes in packet, %d extra bytes.",length_remaining);
+   tick_stat_node(st, st_str_cw, 0, TRUE);
+   radio_node = tick_stat_node(st, radio_name, st_node_cw, TRUE);
+   source_node = tick_stat_node(st, ( tap_info->cw_source == HPSDR_E_CW_HOST ) ? "Host Key" : "Hardware Key",
+                     radio_node, TRUE);
+
+   if ( tap_info->cw_source == HPSDR_E_CW_HW ) {
+       avg_stat_node_add_value(st, "Edge Resolution", source_node, FALSE, (gint)tap_info->cw_resolution_us);
+   }
+   if ( tap_info->cw_element != HPSDR_E_CW_NONE ) {
+       avg_stat_node_add_value(st, val_to_str_const(tap_info->cw_element, cw_elements, "Unknown"), source_node,
+           FALSE, (gint)tap_info->cw_length_us);
    }
+   if ( tap_info->cw_off_timing ) {
+       tick_stat_node(st, "Off Timing", source_node, FALSE);
+   }
+   if ( tap_info->cw_jitter ) {
+       tick_stat_node(st, "Coarse Edges", source_node, FALSE);
+   }
+   if ( tap_info->have_cw_latency ) {
+       avg_stat_node_add_value(st, "Keying Latency", radio_node, FALSE, (gint)tap_info->cw_latency_us);
+   }
+
+   return TAP_PACKET_REDRAW;
+}
 
+static void openhpsdr_e_stats_tree_cleanup(stats_tree *st)
+{
+   if ( openhpsdr_e_st_data != NULL ) {
+       g_hash_table_remove(openhpsdr_e_st_data, st);
+   }
 }
 
 // Port 1024  Command Reply (cr)  - My name for protocol
@@ -11819,6 +7487,9 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
    gint data_length = -1;
 
    guint cr_command = -1;
+   guint32 sequence_num = -1;
+   const char *cr_info = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
 
    guint8 boolean_byte = -1;  //only need one of these
    guint8 value = -1;         //
@@ -11834,6 +7505,55 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode: Info column, service ports and board ID.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   cr_command = tvb_get_guint8(tvb, 4);
+
+   if (cr_command == 0x00 && pinfo->destport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "General - Host to Hardware";
+       cr_general_ports(tvb, pinfo, 5);
+
+   } else if (cr_command == 0x02 && pinfo->destport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Discovery - Host Discovery Query";
+
+   } else if (cr_command == 0x02 && pinfo->srcport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Discovery - Hardware Discovery Reply";
+       radio = openhpsdr_e_find_radio(pinfo, !PINFO_FD_VISITED(pinfo));
+
+   } else if (cr_command == 0x03 && pinfo->destport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Set IP Address - Host Set IP Address";
+
+   } else if (cr_command == 0x03 && pinfo->srcport == HPSDR_E_PORT_COM_REP) {
+       // See the Erase / In Use Discovery Reply note below.
+       if (  tvb_get_guint32(tvb,0,6) == 0 && tvb_get_guint64(tvb,15,8) == 0 ) {
+           cr_info = "Erase - Acknowledgment or Complete";
+       } else {
+           cr_info = "Discovery - Hardware Discovery Reply (Hardware In Use)";
+           radio = openhpsdr_e_find_radio(pinfo, !PINFO_FD_VISITED(pinfo));
+       }
+
+   } else if (cr_command == 0x04 && pinfo->destport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Erase - Host Erase Command";
+
+   } else if (cr_command == 0x04 && pinfo->srcport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Program - Hardware: Response to Program";
+
+   } else if (cr_command == 0x05 && pinfo->destport == HPSDR_E_PORT_COM_REP) {
+       cr_info = "Program - Host Program Data";
+
+   } else {
+       cr_info = "Unknown Command";
+   }
+
+   // Board ID and address of the radio, for the datagrams after the discovery
+   // reply. The reply is from the radio.
+   if ( radio != NULL && !PINFO_FD_VISITED(pinfo) ) {
+       radio->board_id = tvb_get_guint8(tvb, 11);
+       openhpsdr_e_radio_hw_addr(radio, &pinfo->src);
+   }
+
+   col_add_fstr(pinfo->cinfo, COL_INFO, "%s, Seq: %u", cr_info, sequence_num);
+
    if (tree) {
        proto_item *parent_tree_cr_item = NULL;
        proto_tree *openhpsdr_e_cr_tree = NULL;
@@ -11857,13 +7577,11 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
 
                proto_item_append_text(append_text_item," :General - Host to Hardware");
 
-               openhpsdr_e_cr_ddcc_port = tvb_get_guint16(tvb, offset,2);
                append_text_item= proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_ddcc_port,
                                      tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
                offset += 2;
 
-               openhpsdr_e_cr_ducc_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_ducc_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
@@ -11876,43 +7594,36 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
                */
                offset += 2;
 
-               openhpsdr_e_cr_hpc_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_hpc_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
                offset += 2;
 
-               openhpsdr_e_cr_hps_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_hps_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Source Port");
                offset += 2;
 
-               openhpsdr_e_cr_ddca_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_ddca_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
                offset += 2;
 
-               openhpsdr_e_cr_duciq_base_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_duciq_base_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
                offset += 2;
 
-               openhpsdr_e_cr_ddciq_base_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_ddciq_base_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Source Port");
                offset += 2;
 
-               openhpsdr_e_cr_micl_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_micl_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Source Port");
                offset += 2;
 
-               openhpsdr_e_cr_wbd_base_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_wbd_base_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Source Port");
@@ -11946,13 +7657,11 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
                proto_tree_add_item(openhpsdr_e_cr_tree,hf_openhpsdr_e_cr_gen_wb_datagrams_full_spec,tvb,offset,1, ENC_BIG_ENDIAN);
                offset += 1;
 
-               openhpsdr_e_cr_mem_host_port  = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_mem_host_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Dest Port");
                offset += 2;
 
-               openhpsdr_e_cr_mem_hw_port = tvb_get_guint16(tvb, offset,2);
                append_text_item = proto_tree_add_item(openhpsdr_e_cr_tree, hf_openhpsdr_e_cr_gen_mem_hw_port,
                                       tvb,offset, 2, ENC_BIG_ENDIAN);
                proto_item_append_text(append_text_item," -Source Port");
@@ -12139,50 +7848,21 @@ static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree
 
 }
 
-static gboolean
-dissect_openhpsdr_e_cr_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is hard defined to use UDP destination or source port of 1024.
-
-   // Heuristics test
-   // - Used packet-smb.c for an example.
-   // Since the older HPSDR USB over IP uses the same UDP port.
-   // Test the first two bytes for the USB over IP id.
-   if ( tvb_get_guint16(tvb, 0,2) == 0xEFFE ) {
-       return FALSE;
-   }
-
-   // Make sure it's port 1024 traffic
-   if ( (pinfo->srcport == HPSDR_E_PORT_COM_REP) || (pinfo->destport == HPSDR_E_PORT_COM_REP) ) {
-
-       dissect_openhpsdr_e_cr(tvb, pinfo, tree);
-       return TRUE;
-
-   } else {
-       return FALSE;
-   }
-
-
-}
-
 // Host to Hardware
 // To Port    Name
 // 1025       DDC Command
 static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_ddcc_cmd_t *cmd = NULL;
+   openhpsdr_e_delta_t *delta = NULL;
+   openhpsdr_e_budget_t *budget = NULL;
    guint8 value = -1;
 
    int i = -1;
 
-   int *array0[80];
-   int *array1[80];
-   int *array2[80];
-   int *array3[80];
-   int *array4[80];
-   int *array5[80];
-   int *array6[80];
-   int *array7[80];
 
    const char *placehold = NULL ;
 
@@ -12190,6 +7870,23 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   cmd = openhpsdr_e_ddcc_cmd(tvb, pinfo);
+   openhpsdr_e_config_update(pinfo, HPSDR_E_DG_DDCC, cmd);
+   delta = openhpsdr_e_delta_analysis(pinfo, HPSDR_E_DG_DDCC, cmd, sizeof(openhpsdr_e_ddcc_cmd_t));
+   budget = openhpsdr_e_budget_analysis(pinfo);
+   if ( cmd != NULL ) {
+       col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, ADCs: %u, DDCs Enabled: %u",
+           sequence_num, cmd->adc_num, cmd->ddc_on);
+   } else {
+       col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, ADCs: %u",
+           sequence_num, tvb_get_guint8(tvb, 4));
+   }
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, FALSE, HPSDR_E_DG_DDCC, 0, sequence_num);
+   openhpsdr_e_tap_queue(pinfo, FALSE, HPSDR_E_DG_DDCC, 0, sequence_num, 0, 0, seq_info, NULL, NULL, NULL, NULL, NULL);
+
    if (tree) {
 
        proto_item *parent_tree_ddcc_item = NULL;
@@ -12214,8 +7911,16 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            "openHPSDR Ethernet - DDC Command");
 
        proto_tree_add_item(openhpsdr_e_ddcc_tree, hf_openhpsdr_e_ddcc_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_ddcc_tree, offset, seq_info);
+       openhpsdr_e_delta_tree(tvb, pinfo, openhpsdr_e_ddcc_tree, offset, delta);
+       openhpsdr_e_budget_tree(tvb, pinfo, openhpsdr_e_ddcc_tree, offset, budget);
        offset += 4;
 
+       if ( openhpsdr_e_ddcc_delta_items(tvb, openhpsdr_e_ddcc_tree, delta, cmd) ) {
+           openhpsdr_e_check_frame_length(tvb,pinfo,tree,HPSDR_E_DDCC_LEN);
+           return;
+       }
+
        proto_tree_add_item(openhpsdr_e_ddcc_tree, hf_openhpsdr_e_ddcc_adc_num, tvb,offset, 1, ENC_BIG_ENDIAN);
        offset += 1;
 
@@ -12223,543 +7928,28 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            tvb, offset,2, value,"ADC Dither and Random");
        openhpsdr_e_ddcc_ditram_tree = proto_item_add_subtree(ditram_tree_ddcc_item,ett_openhpsdr_e_ddcc_ditram);
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither0, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither4, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither6, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_dither7, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_ddcc_ditram_tree, tvb, offset,
+           hf_openhpsdr_e_ddcc_adc_dither_flags, ett_openhpsdr_e_ddcc_ditram_flags,
+           openhpsdr_e_ddcc_dither_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random0, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random4, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random6, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_ditram_tree, hf_openhpsdr_e_ddcc_adc_random7, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_ddcc_ditram_tree, tvb, offset,
+           hf_openhpsdr_e_ddcc_adc_random_flags, ett_openhpsdr_e_ddcc_ditram_flags,
+           openhpsdr_e_ddcc_random_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
        state_tree_ddcc_item = proto_tree_add_uint_format(openhpsdr_e_ddcc_tree, hf_openhpsdr_e_ddcc_state_sub,
            tvb, offset,10, value,"DDC State");
        openhpsdr_e_ddcc_state_tree = proto_item_add_subtree(state_tree_ddcc_item,ett_openhpsdr_e_ddcc_state);
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc0, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc4, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc6, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc7, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc8, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc9, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc10, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc11, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc12, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc13, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc14, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc15, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc16, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc17, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc18, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc19, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc20, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc21, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc22, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc23, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc24, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc25, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc26, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc27, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc28, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc29, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc30, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc31, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc32, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc33, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc34, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc35, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc36, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc37, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc38, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc39, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc40, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc41, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc42, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc43, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc44, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc45, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc46, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc47, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc48, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc49, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc50, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc51, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc52, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc53, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc54, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc55, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc56, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc57, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc58, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc59, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc60, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc61, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc62, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc63, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc64, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc65, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc66, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc67, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc68, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc69, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc70, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc71, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc72, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc73, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc74, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc75, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc76, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc77, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc78, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_ddcc_state_tree, hf_openhpsdr_e_ddcc_ddc79, tvb,offset, 1, value);
-       offset += 1;
+       for (i=0;i<HPSDR_E_NUM_DDC / 8;i++) {
+           proto_tree_add_bitmask_with_flags(openhpsdr_e_ddcc_state_tree, tvb, offset,
+               hf_openhpsdr_e_ddcc_ddc_state_flags[i], ett_openhpsdr_e_ddcc_state_flags,
+               openhpsdr_e_ddcc_state_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
+           offset += 1;
+       }
 
 
-       array0[0] = &hf_openhpsdr_e_ddcc_ddc_asign0;
-       array1[0] = &hf_openhpsdr_e_ddcc_ddc_rate0;
-       array2[0] = &hf_openhpsdr_e_ddcc_ddc_cic1_0;
-       array3[0] = &hf_openhpsdr_e_ddcc_ddc_cic2_0;
-       array4[0] = &hf_openhpsdr_e_ddcc_ddc_size0;
-       array0[1] = &hf_openhpsdr_e_ddcc_ddc_asign1;
-       array1[1] = &hf_openhpsdr_e_ddcc_ddc_rate1;
-       array2[1] = &hf_openhpsdr_e_ddcc_ddc_cic1_1;
-       array3[1] = &hf_openhpsdr_e_ddcc_ddc_cic2_1;
-       array4[1] = &hf_openhpsdr_e_ddcc_ddc_size1;
-       array0[2] = &hf_openhpsdr_e_ddcc_ddc_asign2;
-       array1[2] = &hf_openhpsdr_e_ddcc_ddc_rate2;
-       array2[2] = &hf_openhpsdr_e_ddcc_ddc_cic1_2;
-       array3[2] = &hf_openhpsdr_e_ddcc_ddc_cic2_2;
-       array4[2] = &hf_openhpsdr_e_ddcc_ddc_size2;
-       array0[3] = &hf_openhpsdr_e_ddcc_ddc_asign3;
-       array1[3] = &hf_openhpsdr_e_ddcc_ddc_rate3;
-       array2[3] = &hf_openhpsdr_e_ddcc_ddc_cic1_3;
-       array3[3] = &hf_openhpsdr_e_ddcc_ddc_cic2_3;
-       array4[3] = &hf_openhpsdr_e_ddcc_ddc_size3;
-       array0[4] = &hf_openhpsdr_e_ddcc_ddc_asign4;
-       array1[4] = &hf_openhpsdr_e_ddcc_ddc_rate4;
-       array2[4] = &hf_openhpsdr_e_ddcc_ddc_cic1_4;
-       array3[4] = &hf_openhpsdr_e_ddcc_ddc_cic2_4;
-       array4[4] = &hf_openhpsdr_e_ddcc_ddc_size4;
-       array0[5] = &hf_openhpsdr_e_ddcc_ddc_asign5;
-       array1[5] = &hf_openhpsdr_e_ddcc_ddc_rate5;
-       array2[5] = &hf_openhpsdr_e_ddcc_ddc_cic1_5;
-       array3[5] = &hf_openhpsdr_e_ddcc_ddc_cic2_5;
-       array4[5] = &hf_openhpsdr_e_ddcc_ddc_size5;
-       array0[6] = &hf_openhpsdr_e_ddcc_ddc_asign6;
-       array1[6] = &hf_openhpsdr_e_ddcc_ddc_rate6;
-       array2[6] = &hf_openhpsdr_e_ddcc_ddc_cic1_6;
-       array3[6] = &hf_openhpsdr_e_ddcc_ddc_cic2_6;
-       array4[6] = &hf_openhpsdr_e_ddcc_ddc_size6;
-       array0[7] = &hf_openhpsdr_e_ddcc_ddc_asign7;
-       array1[7] = &hf_openhpsdr_e_ddcc_ddc_rate7;
-       array2[7] = &hf_openhpsdr_e_ddcc_ddc_cic1_7;
-       array3[7] = &hf_openhpsdr_e_ddcc_ddc_cic2_7;
-       array4[7] = &hf_openhpsdr_e_ddcc_ddc_size7;
-       array0[8] = &hf_openhpsdr_e_ddcc_ddc_asign8;
-       array1[8] = &hf_openhpsdr_e_ddcc_ddc_rate8;
-       array2[8] = &hf_openhpsdr_e_ddcc_ddc_cic1_8;
-       array3[8] = &hf_openhpsdr_e_ddcc_ddc_cic2_8;
-       array4[8] = &hf_openhpsdr_e_ddcc_ddc_size8;
-       array0[9] = &hf_openhpsdr_e_ddcc_ddc_asign9;
-       array1[9] = &hf_openhpsdr_e_ddcc_ddc_rate9;
-       array2[9] = &hf_openhpsdr_e_ddcc_ddc_cic1_9;
-       array3[9] = &hf_openhpsdr_e_ddcc_ddc_cic2_9;
-       array4[9] = &hf_openhpsdr_e_ddcc_ddc_size9;
-       array0[10] = &hf_openhpsdr_e_ddcc_ddc_asign10;
-       array1[10] = &hf_openhpsdr_e_ddcc_ddc_rate10;
-       array2[10] = &hf_openhpsdr_e_ddcc_ddc_cic1_10;
-       array3[10] = &hf_openhpsdr_e_ddcc_ddc_cic2_10;
-       array4[10] = &hf_openhpsdr_e_ddcc_ddc_size10;
-       array0[11] = &hf_openhpsdr_e_ddcc_ddc_asign11;
-       array1[11] = &hf_openhpsdr_e_ddcc_ddc_rate11;
-       array2[11] = &hf_openhpsdr_e_ddcc_ddc_cic1_11;
-       array3[11] = &hf_openhpsdr_e_ddcc_ddc_cic2_11;
-       array4[11] = &hf_openhpsdr_e_ddcc_ddc_size11;
-       array0[12] = &hf_openhpsdr_e_ddcc_ddc_asign12;
-       array1[12] = &hf_openhpsdr_e_ddcc_ddc_rate12;
-       array2[12] = &hf_openhpsdr_e_ddcc_ddc_cic1_12;
-       array3[12] = &hf_openhpsdr_e_ddcc_ddc_cic2_12;
-       array4[12] = &hf_openhpsdr_e_ddcc_ddc_size12;
-       array0[13] = &hf_openhpsdr_e_ddcc_ddc_asign13;
-       array1[13] = &hf_openhpsdr_e_ddcc_ddc_rate13;
-       array2[13] = &hf_openhpsdr_e_ddcc_ddc_cic1_13;
-       array3[13] = &hf_openhpsdr_e_ddcc_ddc_cic2_13;
-       array4[13] = &hf_openhpsdr_e_ddcc_ddc_size13;
-       array0[14] = &hf_openhpsdr_e_ddcc_ddc_asign14;
-       array1[14] = &hf_openhpsdr_e_ddcc_ddc_rate14;
-       array2[14] = &hf_openhpsdr_e_ddcc_ddc_cic1_14;
-       array3[14] = &hf_openhpsdr_e_ddcc_ddc_cic2_14;
-       array4[14] = &hf_openhpsdr_e_ddcc_ddc_size14;
-       array0[15] = &hf_openhpsdr_e_ddcc_ddc_asign15;
-       array1[15] = &hf_openhpsdr_e_ddcc_ddc_rate15;
-       array2[15] = &hf_openhpsdr_e_ddcc_ddc_cic1_15;
-       array3[15] = &hf_openhpsdr_e_ddcc_ddc_cic2_15;
-       array4[15] = &hf_openhpsdr_e_ddcc_ddc_size15;
-       array0[16] = &hf_openhpsdr_e_ddcc_ddc_asign16;
-       array1[16] = &hf_openhpsdr_e_ddcc_ddc_rate16;
-       array2[16] = &hf_openhpsdr_e_ddcc_ddc_cic1_16;
-       array3[16] = &hf_openhpsdr_e_ddcc_ddc_cic2_16;
-       array4[16] = &hf_openhpsdr_e_ddcc_ddc_size16;
-       array0[17] = &hf_openhpsdr_e_ddcc_ddc_asign17;
-       array1[17] = &hf_openhpsdr_e_ddcc_ddc_rate17;
-       array2[17] = &hf_openhpsdr_e_ddcc_ddc_cic1_17;
-       array3[17] = &hf_openhpsdr_e_ddcc_ddc_cic2_17;
-       array4[17] = &hf_openhpsdr_e_ddcc_ddc_size17;
-       array0[18] = &hf_openhpsdr_e_ddcc_ddc_asign18;
-       array1[18] = &hf_openhpsdr_e_ddcc_ddc_rate18;
-       array2[18] = &hf_openhpsdr_e_ddcc_ddc_cic1_18;
-       array3[18] = &hf_openhpsdr_e_ddcc_ddc_cic2_18;
-       array4[18] = &hf_openhpsdr_e_ddcc_ddc_size18;
-       array0[19] = &hf_openhpsdr_e_ddcc_ddc_asign19;
-       array1[19] = &hf_openhpsdr_e_ddcc_ddc_rate19;
-       array2[19] = &hf_openhpsdr_e_ddcc_ddc_cic1_19;
-       array3[19] = &hf_openhpsdr_e_ddcc_ddc_cic2_19;
-       array4[19] = &hf_openhpsdr_e_ddcc_ddc_size19;
-       array0[20] = &hf_openhpsdr_e_ddcc_ddc_asign20;
-       array1[20] = &hf_openhpsdr_e_ddcc_ddc_rate20;
-       array2[20] = &hf_openhpsdr_e_ddcc_ddc_cic1_20;
-       array3[20] = &hf_openhpsdr_e_ddcc_ddc_cic2_20;
-       array4[20] = &hf_openhpsdr_e_ddcc_ddc_size20;
-       array0[21] = &hf_openhpsdr_e_ddcc_ddc_asign21;
-       array1[21] = &hf_openhpsdr_e_ddcc_ddc_rate21;
-       array2[21] = &hf_openhpsdr_e_ddcc_ddc_cic1_21;
-       array3[21] = &hf_openhpsdr_e_ddcc_ddc_cic2_21;
-       array4[21] = &hf_openhpsdr_e_ddcc_ddc_size21;
-       array0[22] = &hf_openhpsdr_e_ddcc_ddc_asign22;
-       array1[22] = &hf_openhpsdr_e_ddcc_ddc_rate22;
-       array2[22] = &hf_openhpsdr_e_ddcc_ddc_cic1_22;
-       array3[22] = &hf_openhpsdr_e_ddcc_ddc_cic2_22;
-       array4[22] = &hf_openhpsdr_e_ddcc_ddc_size22;
-       array0[23] = &hf_openhpsdr_e_ddcc_ddc_asign23;
-       array1[23] = &hf_openhpsdr_e_ddcc_ddc_rate23;
-       array2[23] = &hf_openhpsdr_e_ddcc_ddc_cic1_23;
-       array3[23] = &hf_openhpsdr_e_ddcc_ddc_cic2_23;
-       array4[23] = &hf_openhpsdr_e_ddcc_ddc_size23;
-       array0[24] = &hf_openhpsdr_e_ddcc_ddc_asign24;
-       array1[24] = &hf_openhpsdr_e_ddcc_ddc_rate24;
-       array2[24] = &hf_openhpsdr_e_ddcc_ddc_cic1_24;
-       array3[24] = &hf_openhpsdr_e_ddcc_ddc_cic2_24;
-       array4[24] = &hf_openhpsdr_e_ddcc_ddc_size24;
-       array0[25] = &hf_openhpsdr_e_ddcc_ddc_asign25;
-       array1[25] = &hf_openhpsdr_e_ddcc_ddc_rate25;
-       array2[25] = &hf_openhpsdr_e_ddcc_ddc_cic1_25;
-       array3[25] = &hf_openhpsdr_e_ddcc_ddc_cic2_25;
-       array4[25] = &hf_openhpsdr_e_ddcc_ddc_size25;
-       array0[26] = &hf_openhpsdr_e_ddcc_ddc_asign26;
-       array1[26] = &hf_openhpsdr_e_ddcc_ddc_rate26;
-       array2[26] = &hf_openhpsdr_e_ddcc_ddc_cic1_26;
-       array3[26] = &hf_openhpsdr_e_ddcc_ddc_cic2_26;
-       array4[26] = &hf_openhpsdr_e_ddcc_ddc_size26;
-       array0[27] = &hf_openhpsdr_e_ddcc_ddc_asign27;
-       array1[27] = &hf_openhpsdr_e_ddcc_ddc_rate27;
-       array2[27] = &hf_openhpsdr_e_ddcc_ddc_cic1_27;
-       array3[27] = &hf_openhpsdr_e_ddcc_ddc_cic2_27;
-       array4[27] = &hf_openhpsdr_e_ddcc_ddc_size27;
-       array0[28] = &hf_openhpsdr_e_ddcc_ddc_asign28;
-       array1[28] = &hf_openhpsdr_e_ddcc_ddc_rate28;
-       array2[28] = &hf_openhpsdr_e_ddcc_ddc_cic1_28;
-       array3[28] = &hf_openhpsdr_e_ddcc_ddc_cic2_28;
-       array4[28] = &hf_openhpsdr_e_ddcc_ddc_size28;
-       array0[29] = &hf_openhpsdr_e_ddcc_ddc_asign29;
-       array1[29] = &hf_openhpsdr_e_ddcc_ddc_rate29;
-       array2[29] = &hf_openhpsdr_e_ddcc_ddc_cic1_29;
-       array3[29] = &hf_openhpsdr_e_ddcc_ddc_cic2_29;
-       array4[29] = &hf_openhpsdr_e_ddcc_ddc_size29;
-       array0[30] = &hf_openhpsdr_e_ddcc_ddc_asign30;
-       array1[30] = &hf_openhpsdr_e_ddcc_ddc_rate30;
-       array2[30] = &hf_openhpsdr_e_ddcc_ddc_cic1_30;
-       array3[30] = &hf_openhpsdr_e_ddcc_ddc_cic2_30;
-       array4[30] = &hf_openhpsdr_e_ddcc_ddc_size30;
-       array0[31] = &hf_openhpsdr_e_ddcc_ddc_asign31;
-       array1[31] = &hf_openhpsdr_e_ddcc_ddc_rate31;
-       array2[31] = &hf_openhpsdr_e_ddcc_ddc_cic1_31;
-       array3[31] = &hf_openhpsdr_e_ddcc_ddc_cic2_31;
-       array4[31] = &hf_openhpsdr_e_ddcc_ddc_size31;
-       array0[32] = &hf_openhpsdr_e_ddcc_ddc_asign32;
-       array1[32] = &hf_openhpsdr_e_ddcc_ddc_rate32;
-       array2[32] = &hf_openhpsdr_e_ddcc_ddc_cic1_32;
-       array3[32] = &hf_openhpsdr_e_ddcc_ddc_cic2_32;
-       array4[32] = &hf_openhpsdr_e_ddcc_ddc_size32;
-       array0[33] = &hf_openhpsdr_e_ddcc_ddc_asign33;
-       array1[33] = &hf_openhpsdr_e_ddcc_ddc_rate33;
-       array2[33] = &hf_openhpsdr_e_ddcc_ddc_cic1_33;
-       array3[33] = &hf_openhpsdr_e_ddcc_ddc_cic2_33;
-       array4[33] = &hf_openhpsdr_e_ddcc_ddc_size33;
-       array0[34] = &hf_openhpsdr_e_ddcc_ddc_asign34;
-       array1[34] = &hf_openhpsdr_e_ddcc_ddc_rate34;
-       array2[34] = &hf_openhpsdr_e_ddcc_ddc_cic1_34;
-       array3[34] = &hf_openhpsdr_e_ddcc_ddc_cic2_34;
-       array4[34] = &hf_openhpsdr_e_ddcc_ddc_size34;
-       array0[35] = &hf_openhpsdr_e_ddcc_ddc_asign35;
-       array1[35] = &hf_openhpsdr_e_ddcc_ddc_rate35;
-       array2[35] = &hf_openhpsdr_e_ddcc_ddc_cic1_35;
-       array3[35] = &hf_openhpsdr_e_ddcc_ddc_cic2_35;
-       array4[35] = &hf_openhpsdr_e_ddcc_ddc_size35;
-       array0[36] = &hf_openhpsdr_e_ddcc_ddc_asign36;
-       array1[36] = &hf_openhpsdr_e_ddcc_ddc_rate36;
-       array2[36] = &hf_openhpsdr_e_ddcc_ddc_cic1_36;
-       array3[36] = &hf_openhpsdr_e_ddcc_ddc_cic2_36;
-       array4[36] = &hf_openhpsdr_e_ddcc_ddc_size36;
-       array0[37] = &hf_openhpsdr_e_ddcc_ddc_asign37;
-       array1[37] = &hf_openhpsdr_e_ddcc_ddc_rate37;
-       array2[37] = &hf_openhpsdr_e_ddcc_ddc_cic1_37;
-       array3[37] = &hf_openhpsdr_e_ddcc_ddc_cic2_37;
-       array4[37] = &hf_openhpsdr_e_ddcc_ddc_size37;
-       array0[38] = &hf_openhpsdr_e_ddcc_ddc_asign38;
-       array1[38] = &hf_openhpsdr_e_ddcc_ddc_rate38;
-       array2[38] = &hf_openhpsdr_e_ddcc_ddc_cic1_38;
-       array3[38] = &hf_openhpsdr_e_ddcc_ddc_cic2_38;
-       array4[38] = &hf_openhpsdr_e_ddcc_ddc_size38;
-       array0[39] = &hf_openhpsdr_e_ddcc_ddc_asign39;
-       array1[39] = &hf_openhpsdr_e_ddcc_ddc_rate39;
-       array2[39] = &hf_openhpsdr_e_ddcc_ddc_cic1_39;
-       array3[39] = &hf_openhpsdr_e_ddcc_ddc_cic2_39;
-       array4[39] = &hf_openhpsdr_e_ddcc_ddc_size39;
-       array0[40] = &hf_openhpsdr_e_ddcc_ddc_asign40;
-       array1[40] = &hf_openhpsdr_e_ddcc_ddc_rate40;
-       array2[40] = &hf_openhpsdr_e_ddcc_ddc_cic1_40;
-       array3[40] = &hf_openhpsdr_e_ddcc_ddc_cic2_40;
-       array4[40] = &hf_openhpsdr_e_ddcc_ddc_size40;
-       array0[41] = &hf_openhpsdr_e_ddcc_ddc_asign41;
-       array1[41] = &hf_openhpsdr_e_ddcc_ddc_rate41;
-       array2[41] = &hf_openhpsdr_e_ddcc_ddc_cic1_41;
-       array3[41] = &hf_openhpsdr_e_ddcc_ddc_cic2_41;
-       array4[41] = &hf_openhpsdr_e_ddcc_ddc_size41;
-       array0[42] = &hf_openhpsdr_e_ddcc_ddc_asign42;
-       array1[42] = &hf_openhpsdr_e_ddcc_ddc_rate42;
-       array2[42] = &hf_openhpsdr_e_ddcc_ddc_cic1_42;
-       array3[42] = &hf_openhpsdr_e_ddcc_ddc_cic2_42;
-       array4[42] = &hf_openhpsdr_e_ddcc_ddc_size42;
-       array0[43] = &hf_openhpsdr_e_ddcc_ddc_asign43;
-       array1[43] = &hf_openhpsdr_e_ddcc_ddc_rate43;
-       array2[43] = &hf_openhpsdr_e_ddcc_ddc_cic1_43;
-       array3[43] = &hf_openhpsdr_e_ddcc_ddc_cic2_43;
-       array4[43] = &hf_openhpsdr_e_ddcc_ddc_size43;
-       array0[44] = &hf_openhpsdr_e_ddcc_ddc_asign44;
-       array1[44] = &hf_openhpsdr_e_ddcc_ddc_rate44;
-       array2[44] = &hf_openhpsdr_e_ddcc_ddc_cic1_44;
-       array3[44] = &hf_openhpsdr_e_ddcc_ddc_cic2_44;
-       array4[44] = &hf_openhpsdr_e_ddcc_ddc_size44;
-       array0[45] = &hf_openhpsdr_e_ddcc_ddc_asign45;
-       array1[45] = &hf_openhpsdr_e_ddcc_ddc_rate45;
-       array2[45] = &hf_openhpsdr_e_ddcc_ddc_cic1_45;
-       array3[45] = &hf_openhpsdr_e_ddcc_ddc_cic2_45;
-       array4[45] = &hf_openhpsdr_e_ddcc_ddc_size45;
-       array0[46] = &hf_openhpsdr_e_ddcc_ddc_asign46;
-       array1[46] = &hf_openhpsdr_e_ddcc_ddc_rate46;
-       array2[46] = &hf_openhpsdr_e_ddcc_ddc_cic1_46;
-       array3[46] = &hf_openhpsdr_e_ddcc_ddc_cic2_46;
-       array4[46] = &hf_openhpsdr_e_ddcc_ddc_size46;
-       array0[47] = &hf_openhpsdr_e_ddcc_ddc_asign47;
-       array1[47] = &hf_openhpsdr_e_ddcc_ddc_rate47;
-       array2[47] = &hf_openhpsdr_e_ddcc_ddc_cic1_47;
-       array3[47] = &hf_openhpsdr_e_ddcc_ddc_cic2_47;
-       array4[47] = &hf_openhpsdr_e_ddcc_ddc_size47;
-       array0[48] = &hf_openhpsdr_e_ddcc_ddc_asign48;
-       array1[48] = &hf_openhpsdr_e_ddcc_ddc_rate48;
-       array2[48] = &hf_openhpsdr_e_ddcc_ddc_cic1_48;
-       array3[48] = &hf_openhpsdr_e_ddcc_ddc_cic2_48;
-       array4[48] = &hf_openhpsdr_e_ddcc_ddc_size48;
-       array0[49] = &hf_openhpsdr_e_ddcc_ddc_asign49;
-       array1[49] = &hf_openhpsdr_e_ddcc_ddc_rate49;
-       array2[49] = &hf_openhpsdr_e_ddcc_ddc_cic1_49;
-       array3[49] = &hf_openhpsdr_e_ddcc_ddc_cic2_49;
-       array4[49] = &hf_openhpsdr_e_ddcc_ddc_size49;
-       array0[50] = &hf_openhpsdr_e_ddcc_ddc_asign50;
-       array1[50] = &hf_openhpsdr_e_ddcc_ddc_rate50;
-       array2[50] = &hf_openhpsdr_e_ddcc_ddc_cic1_50;
-       array3[50] = &hf_openhpsdr_e_ddcc_ddc_cic2_50;
-       array4[50] = &hf_openhpsdr_e_ddcc_ddc_size50;
-       array0[51] = &hf_openhpsdr_e_ddcc_ddc_asign51;
-       array1[51] = &hf_openhpsdr_e_ddcc_ddc_rate51;
-       array2[51] = &hf_openhpsdr_e_ddcc_ddc_cic1_51;
-       array3[51] = &hf_openhpsdr_e_ddcc_ddc_cic2_51;
-       array4[51] = &hf_openhpsdr_e_ddcc_ddc_size51;
-       array0[52] = &hf_openhpsdr_e_ddcc_ddc_asign52;
-       array1[52] = &hf_openhpsdr_e_ddcc_ddc_rate52;
-       array2[52] = &hf_openhpsdr_e_ddcc_ddc_cic1_52;
-       array3[52] = &hf_openhpsdr_e_ddcc_ddc_cic2_52;
-       array4[52] = &hf_openhpsdr_e_ddcc_ddc_size52;
-       array0[53] = &hf_openhpsdr_e_ddcc_ddc_asign53;
-       array1[53] = &hf_openhpsdr_e_ddcc_ddc_rate53;
-       array2[53] = &hf_openhpsdr_e_ddcc_ddc_cic1_53;
-       array3[53] = &hf_openhpsdr_e_ddcc_ddc_cic2_53;
-       array4[53] = &hf_openhpsdr_e_ddcc_ddc_size53;
-       array0[54] = &hf_openhpsdr_e_ddcc_ddc_asign54;
-       array1[54] = &hf_openhpsdr_e_ddcc_ddc_rate54;
-       array2[54] = &hf_openhpsdr_e_ddcc_ddc_cic1_54;
-       array3[54] = &hf_openhpsdr_e_ddcc_ddc_cic2_54;
-       array4[54] = &hf_openhpsdr_e_ddcc_ddc_size54;
-       array0[55] = &hf_openhpsdr_e_ddcc_ddc_asign55;
-       array1[55] = &hf_openhpsdr_e_ddcc_ddc_rate55;
-       array2[55] = &hf_openhpsdr_e_ddcc_ddc_cic1_55;
-       array3[55] = &hf_openhpsdr_e_ddcc_ddc_cic2_55;
-       array4[55] = &hf_openhpsdr_e_ddcc_ddc_size55;
-       array0[56] = &hf_openhpsdr_e_ddcc_ddc_asign56;
-       array1[56] = &hf_openhpsdr_e_ddcc_ddc_rate56;
-       array2[56] = &hf_openhpsdr_e_ddcc_ddc_cic1_56;
-       array3[56] = &hf_openhpsdr_e_ddcc_ddc_cic2_56;
-       array4[56] = &hf_openhpsdr_e_ddcc_ddc_size56;
-       array0[57] = &hf_openhpsdr_e_ddcc_ddc_asign57;
-       array1[57] = &hf_openhpsdr_e_ddcc_ddc_rate57;
-       array2[57] = &hf_openhpsdr_e_ddcc_ddc_cic1_57;
-       array3[57] = &hf_openhpsdr_e_ddcc_ddc_cic2_57;
-       array4[57] = &hf_openhpsdr_e_ddcc_ddc_size57;
-       array0[58] = &hf_openhpsdr_e_ddcc_ddc_asign58;
-       array1[58] = &hf_openhpsdr_e_ddcc_ddc_rate58;
-       array2[58] = &hf_openhpsdr_e_ddcc_ddc_cic1_58;
-       array3[58] = &hf_openhpsdr_e_ddcc_ddc_cic2_58;
-       array4[58] = &hf_openhpsdr_e_ddcc_ddc_size58;
-       array0[59] = &hf_openhpsdr_e_ddcc_ddc_asign59;
-       array1[59] = &hf_openhpsdr_e_ddcc_ddc_rate59;
-       array2[59] = &hf_openhpsdr_e_ddcc_ddc_cic1_59;
-       array3[59] = &hf_openhpsdr_e_ddcc_ddc_cic2_59;
-       array4[59] = &hf_openhpsdr_e_ddcc_ddc_size59;
-       array0[60] = &hf_openhpsdr_e_ddcc_ddc_asign60;
-       array1[60] = &hf_openhpsdr_e_ddcc_ddc_rate60;
-       array2[60] = &hf_openhpsdr_e_ddcc_ddc_cic1_60;
-       array3[60] = &hf_openhpsdr_e_ddcc_ddc_cic2_60;
-       array4[60] = &hf_openhpsdr_e_ddcc_ddc_size60;
-       array0[61] = &hf_openhpsdr_e_ddcc_ddc_asign61;
-       array1[61] = &hf_openhpsdr_e_ddcc_ddc_rate61;
-       array2[61] = &hf_openhpsdr_e_ddcc_ddc_cic1_61;
-       array3[61] = &hf_openhpsdr_e_ddcc_ddc_cic2_61;
-       array4[61] = &hf_openhpsdr_e_ddcc_ddc_size61;
-       array0[62] = &hf_openhpsdr_e_ddcc_ddc_asign62;
-       array1[62] = &hf_openhpsdr_e_ddcc_ddc_rate62;
-       array2[62] = &hf_openhpsdr_e_ddcc_ddc_cic1_62;
-       array3[62] = &hf_openhpsdr_e_ddcc_ddc_cic2_62;
-       array4[62] = &hf_openhpsdr_e_ddcc_ddc_size62;
-       array0[63] = &hf_openhpsdr_e_ddcc_ddc_asign63;
-       array1[63] = &hf_openhpsdr_e_ddcc_ddc_rate63;
-       array2[63] = &hf_openhpsdr_e_ddcc_ddc_cic1_63;
-       array3[63] = &hf_openhpsdr_e_ddcc_ddc_cic2_63;
-       array4[63] = &hf_openhpsdr_e_ddcc_ddc_size63;
-       array0[64] = &hf_openhpsdr_e_ddcc_ddc_asign64;
-       array1[64] = &hf_openhpsdr_e_ddcc_ddc_rate64;
-       array2[64] = &hf_openhpsdr_e_ddcc_ddc_cic1_64;
-       array3[64] = &hf_openhpsdr_e_ddcc_ddc_cic2_64;
-       array4[64] = &hf_openhpsdr_e_ddcc_ddc_size64;
-       array0[65] = &hf_openhpsdr_e_ddcc_ddc_asign65;
-       array1[65] = &hf_openhpsdr_e_ddcc_ddc_rate65;
-       array2[65] = &hf_openhpsdr_e_ddcc_ddc_cic1_65;
-       array3[65] = &hf_openhpsdr_e_ddcc_ddc_cic2_65;
-       array4[65] = &hf_openhpsdr_e_ddcc_ddc_size65;
-       array0[66] = &hf_openhpsdr_e_ddcc_ddc_asign66;
-       array1[66] = &hf_openhpsdr_e_ddcc_ddc_rate66;
-       array2[66] = &hf_openhpsdr_e_ddcc_ddc_cic1_66;
-       array3[66] = &hf_openhpsdr_e_ddcc_ddc_cic2_66;
-       array4[66] = &hf_openhpsdr_e_ddcc_ddc_size66;
-       array0[67] = &hf_openhpsdr_e_ddcc_ddc_asign67;
-       array1[67] = &hf_openhpsdr_e_ddcc_ddc_rate67;
-       array2[67] = &hf_openhpsdr_e_ddcc_ddc_cic1_67;
-       array3[67] = &hf_openhpsdr_e_ddcc_ddc_cic2_67;
-       array4[67] = &hf_openhpsdr_e_ddcc_ddc_size67;
-       array0[68] = &hf_openhpsdr_e_ddcc_ddc_asign68;
-       array1[68] = &hf_openhpsdr_e_ddcc_ddc_rate68;
-       array2[68] = &hf_openhpsdr_e_ddcc_ddc_cic1_68;
-       array3[68] = &hf_openhpsdr_e_ddcc_ddc_cic2_68;
-       array4[68] = &hf_openhpsdr_e_ddcc_ddc_size68;
-       array0[69] = &hf_openhpsdr_e_ddcc_ddc_asign69;
-       array1[69] = &hf_openhpsdr_e_ddcc_ddc_rate69;
-       array2[69] = &hf_openhpsdr_e_ddcc_ddc_cic1_69;
-       array3[69] = &hf_openhpsdr_e_ddcc_ddc_cic2_69;
-       array4[69] = &hf_openhpsdr_e_ddcc_ddc_size69;
-       array0[70] = &hf_openhpsdr_e_ddcc_ddc_asign70;
-       array1[70] = &hf_openhpsdr_e_ddcc_ddc_rate70;
-       array2[70] = &hf_openhpsdr_e_ddcc_ddc_cic1_70;
-       array3[70] = &hf_openhpsdr_e_ddcc_ddc_cic2_70;
-       array4[70] = &hf_openhpsdr_e_ddcc_ddc_size70;
-       array0[71] = &hf_openhpsdr_e_ddcc_ddc_asign71;
-       array1[71] = &hf_openhpsdr_e_ddcc_ddc_rate71;
-       array2[71] = &hf_openhpsdr_e_ddcc_ddc_cic1_71;
-       array3[71] = &hf_openhpsdr_e_ddcc_ddc_cic2_71;
-       array4[71] = &hf_openhpsdr_e_ddcc_ddc_size71;
-       array0[72] = &hf_openhpsdr_e_ddcc_ddc_asign72;
-       array1[72] = &hf_openhpsdr_e_ddcc_ddc_rate72;
-       array2[72] = &hf_openhpsdr_e_ddcc_ddc_cic1_72;
-       array3[72] = &hf_openhpsdr_e_ddcc_ddc_cic2_72;
-       array4[72] = &hf_openhpsdr_e_ddcc_ddc_size72;
-       array0[73] = &hf_openhpsdr_e_ddcc_ddc_asign73;
-       array1[73] = &hf_openhpsdr_e_ddcc_ddc_rate73;
-       array2[73] = &hf_openhpsdr_e_ddcc_ddc_cic1_73;
-       array3[73] = &hf_openhpsdr_e_ddcc_ddc_cic2_73;
-       array4[73] = &hf_openhpsdr_e_ddcc_ddc_size73;
-       array0[74] = &hf_openhpsdr_e_ddcc_ddc_asign74;
-       array1[74] = &hf_openhpsdr_e_ddcc_ddc_rate74;
-       array2[74] = &hf_openhpsdr_e_ddcc_ddc_cic1_74;
-       array3[74] = &hf_openhpsdr_e_ddcc_ddc_cic2_74;
-       array4[74] = &hf_openhpsdr_e_ddcc_ddc_size74;
-       array0[75] = &hf_openhpsdr_e_ddcc_ddc_asign75;
-       array1[75] = &hf_openhpsdr_e_ddcc_ddc_rate75;
-       array2[75] = &hf_openhpsdr_e_ddcc_ddc_cic1_75;
-       array3[75] = &hf_openhpsdr_e_ddcc_ddc_cic2_75;
-       array4[75] = &hf_openhpsdr_e_ddcc_ddc_size75;
-       array0[76] = &hf_openhpsdr_e_ddcc_ddc_asign76;
-       array1[76] = &hf_openhpsdr_e_ddcc_ddc_rate76;
-       array2[76] = &hf_openhpsdr_e_ddcc_ddc_cic1_76;
-       array3[76] = &hf_openhpsdr_e_ddcc_ddc_cic2_76;
-       array4[76] = &hf_openhpsdr_e_ddcc_ddc_size76;
-       array0[77] = &hf_openhpsdr_e_ddcc_ddc_asign77;
-       array1[77] = &hf_openhpsdr_e_ddcc_ddc_rate77;
-       array2[77] = &hf_openhpsdr_e_ddcc_ddc_cic1_77;
-       array3[77] = &hf_openhpsdr_e_ddcc_ddc_cic2_77;
-       array4[77] = &hf_openhpsdr_e_ddcc_ddc_size77;
-       array0[78] = &hf_openhpsdr_e_ddcc_ddc_asign78;
-       array1[78] = &hf_openhpsdr_e_ddcc_ddc_rate78;
-       array2[78] = &hf_openhpsdr_e_ddcc_ddc_cic1_78;
-       array3[78] = &hf_openhpsdr_e_ddcc_ddc_cic2_78;
-       array4[78] = &hf_openhpsdr_e_ddcc_ddc_size78;
-       array0[79] = &hf_openhpsdr_e_ddcc_ddc_asign79;
-       array1[79] = &hf_openhpsdr_e_ddcc_ddc_rate79;
-       array2[79] = &hf_openhpsdr_e_ddcc_ddc_cic1_79;
-       array3[79] = &hf_openhpsdr_e_ddcc_ddc_cic2_79;
-       array4[79] = &hf_openhpsdr_e_ddcc_ddc_size79;
 
        config_tree_ddcc_item = proto_tree_add_uint_format(openhpsdr_e_ddcc_tree, hf_openhpsdr_e_ddcc_config_sub,
            tvb, offset,480, value,"DDC Configuration");
@@ -12767,21 +7957,21 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
 
        for (i=0;i<=79;i++) {
 
-          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, *array0[i], tvb,offset, 1, ENC_BIG_ENDIAN);
+          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, hf_openhpsdr_e_ddcc_ddc_asign[i], tvb,offset, 1, ENC_BIG_ENDIAN);
           offset += 1;
 
-          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, *array1[i], tvb,offset, 2, ENC_BIG_ENDIAN);
+          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, hf_openhpsdr_e_ddcc_ddc_rate[i], tvb,offset, 2, ENC_BIG_ENDIAN);
           offset += 2;
 
-          append_text_item = proto_tree_add_item(openhpsdr_e_ddcc_config_tree, *array2[i], tvb,offset, 1, ENC_BIG_ENDIAN);
+          append_text_item = proto_tree_add_item(openhpsdr_e_ddcc_config_tree, hf_openhpsdr_e_ddcc_ddc_cic1[i], tvb,offset, 1, ENC_BIG_ENDIAN);
           proto_item_append_text(append_text_item,"  :Future Use");
           offset += 1;
 
-          append_text_item = proto_tree_add_item(openhpsdr_e_ddcc_config_tree, *array3[i], tvb,offset, 1, ENC_BIG_ENDIAN);
+          append_text_item = proto_tree_add_item(openhpsdr_e_ddcc_config_tree, hf_openhpsdr_e_ddcc_ddc_cic2[i], tvb,offset, 1, ENC_BIG_ENDIAN);
           proto_item_append_text(append_text_item,"  :Future Use");
           offset += 1;
 
-          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, *array4[i], tvb,offset, 1, ENC_BIG_ENDIAN);
+          proto_tree_add_item(openhpsdr_e_ddcc_config_tree, hf_openhpsdr_e_ddcc_ddc_size[i], tvb,offset, 1, ENC_BIG_ENDIAN);
           offset += 1;
        }
 
@@ -12789,664 +7979,16 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            "Reserved for Future Use: 866 Bytes");
        offset += 866;
 
-       array0[0] = &hf_openhpsdr_e_ddcc_ddc_sync0_0;
-       array1[0] = &hf_openhpsdr_e_ddcc_ddc_sync1_0;
-       array2[0] = &hf_openhpsdr_e_ddcc_ddc_sync2_0;
-       array3[0] = &hf_openhpsdr_e_ddcc_ddc_sync3_0;
-       array4[0] = &hf_openhpsdr_e_ddcc_ddc_sync4_0;
-       array5[0] = &hf_openhpsdr_e_ddcc_ddc_sync5_0;
-       array6[0] = &hf_openhpsdr_e_ddcc_ddc_sync6_0;
-       array7[0] = &hf_openhpsdr_e_ddcc_ddc_sync7_0;
-       array0[1] = &hf_openhpsdr_e_ddcc_ddc_sync0_1;
-       array1[1] = &hf_openhpsdr_e_ddcc_ddc_sync1_1;
-       array2[1] = &hf_openhpsdr_e_ddcc_ddc_sync2_1;
-       array3[1] = &hf_openhpsdr_e_ddcc_ddc_sync3_1;
-       array4[1] = &hf_openhpsdr_e_ddcc_ddc_sync4_1;
-       array5[1] = &hf_openhpsdr_e_ddcc_ddc_sync5_1;
-       array6[1] = &hf_openhpsdr_e_ddcc_ddc_sync6_1;
-       array7[1] = &hf_openhpsdr_e_ddcc_ddc_sync7_1;
-       array0[2] = &hf_openhpsdr_e_ddcc_ddc_sync0_2;
-       array1[2] = &hf_openhpsdr_e_ddcc_ddc_sync1_2;
-       array2[2] = &hf_openhpsdr_e_ddcc_ddc_sync2_2;
-       array3[2] = &hf_openhpsdr_e_ddcc_ddc_sync3_2;
-       array4[2] = &hf_openhpsdr_e_ddcc_ddc_sync4_2;
-       array5[2] = &hf_openhpsdr_e_ddcc_ddc_sync5_2;
-       array6[2] = &hf_openhpsdr_e_ddcc_ddc_sync6_2;
-       array7[2] = &hf_openhpsdr_e_ddcc_ddc_sync7_2;
-       array0[3] = &hf_openhpsdr_e_ddcc_ddc_sync0_3;
-       array1[3] = &hf_openhpsdr_e_ddcc_ddc_sync1_3;
-       array2[3] = &hf_openhpsdr_e_ddcc_ddc_sync2_3;
-       array3[3] = &hf_openhpsdr_e_ddcc_ddc_sync3_3;
-       array4[3] = &hf_openhpsdr_e_ddcc_ddc_sync4_3;
-       array5[3] = &hf_openhpsdr_e_ddcc_ddc_sync5_3;
-       array6[3] = &hf_openhpsdr_e_ddcc_ddc_sync6_3;
-       array7[3] = &hf_openhpsdr_e_ddcc_ddc_sync7_3;
-       array0[4] = &hf_openhpsdr_e_ddcc_ddc_sync0_4;
-       array1[4] = &hf_openhpsdr_e_ddcc_ddc_sync1_4;
-       array2[4] = &hf_openhpsdr_e_ddcc_ddc_sync2_4;
-       array3[4] = &hf_openhpsdr_e_ddcc_ddc_sync3_4;
-       array4[4] = &hf_openhpsdr_e_ddcc_ddc_sync4_4;
-       array5[4] = &hf_openhpsdr_e_ddcc_ddc_sync5_4;
-       array6[4] = &hf_openhpsdr_e_ddcc_ddc_sync6_4;
-       array7[4] = &hf_openhpsdr_e_ddcc_ddc_sync7_4;
-       array0[5] = &hf_openhpsdr_e_ddcc_ddc_sync0_5;
-       array1[5] = &hf_openhpsdr_e_ddcc_ddc_sync1_5;
-       array2[5] = &hf_openhpsdr_e_ddcc_ddc_sync2_5;
-       array3[5] = &hf_openhpsdr_e_ddcc_ddc_sync3_5;
-       array4[5] = &hf_openhpsdr_e_ddcc_ddc_sync4_5;
-       array5[5] = &hf_openhpsdr_e_ddcc_ddc_sync5_5;
-       array6[5] = &hf_openhpsdr_e_ddcc_ddc_sync6_5;
-       array7[5] = &hf_openhpsdr_e_ddcc_ddc_sync7_5;
-       array0[6] = &hf_openhpsdr_e_ddcc_ddc_sync0_6;
-       array1[6] = &hf_openhpsdr_e_ddcc_ddc_sync1_6;
-       array2[6] = &hf_openhpsdr_e_ddcc_ddc_sync2_6;
-       array3[6] = &hf_openhpsdr_e_ddcc_ddc_sync3_6;
-       array4[6] = &hf_openhpsdr_e_ddcc_ddc_sync4_6;
-       array5[6] = &hf_openhpsdr_e_ddcc_ddc_sync5_6;
-       array6[6] = &hf_openhpsdr_e_ddcc_ddc_sync6_6;
-       array7[6] = &hf_openhpsdr_e_ddcc_ddc_sync7_6;
-       array0[7] = &hf_openhpsdr_e_ddcc_ddc_sync0_7;
-       array1[7] = &hf_openhpsdr_e_ddcc_ddc_sync1_7;
-       array2[7] = &hf_openhpsdr_e_ddcc_ddc_sync2_7;
-       array3[7] = &hf_openhpsdr_e_ddcc_ddc_sync3_7;
-       array4[7] = &hf_openhpsdr_e_ddcc_ddc_sync4_7;
-       array5[7] = &hf_openhpsdr_e_ddcc_ddc_sync5_7;
-       array6[7] = &hf_openhpsdr_e_ddcc_ddc_sync6_7;
-       array7[7] = &hf_openhpsdr_e_ddcc_ddc_sync7_7;
-       array0[8] = &hf_openhpsdr_e_ddcc_ddc_sync0_8;
-       array1[8] = &hf_openhpsdr_e_ddcc_ddc_sync1_8;
-       array2[8] = &hf_openhpsdr_e_ddcc_ddc_sync2_8;
-       array3[8] = &hf_openhpsdr_e_ddcc_ddc_sync3_8;
-       array4[8] = &hf_openhpsdr_e_ddcc_ddc_sync4_8;
-       array5[8] = &hf_openhpsdr_e_ddcc_ddc_sync5_8;
-       array6[8] = &hf_openhpsdr_e_ddcc_ddc_sync6_8;
-       array7[8] = &hf_openhpsdr_e_ddcc_ddc_sync7_8;
-       array0[9] = &hf_openhpsdr_e_ddcc_ddc_sync0_9;
-       array1[9] = &hf_openhpsdr_e_ddcc_ddc_sync1_9;
-       array2[9] = &hf_openhpsdr_e_ddcc_ddc_sync2_9;
-       array3[9] = &hf_openhpsdr_e_ddcc_ddc_sync3_9;
-       array4[9] = &hf_openhpsdr_e_ddcc_ddc_sync4_9;
-       array5[9] = &hf_openhpsdr_e_ddcc_ddc_sync5_9;
-       array6[9] = &hf_openhpsdr_e_ddcc_ddc_sync6_9;
-       array7[9] = &hf_openhpsdr_e_ddcc_ddc_sync7_9;
-       array0[10] = &hf_openhpsdr_e_ddcc_ddc_sync0_10;
-       array1[10] = &hf_openhpsdr_e_ddcc_ddc_sync1_10;
-       array2[10] = &hf_openhpsdr_e_ddcc_ddc_sync2_10;
-       array3[10] = &hf_openhpsdr_e_ddcc_ddc_sync3_10;
-       array4[10] = &hf_openhpsdr_e_ddcc_ddc_sync4_10;
-       array5[10] = &hf_openhpsdr_e_ddcc_ddc_sync5_10;
-       array6[10] = &hf_openhpsdr_e_ddcc_ddc_sync6_10;
-       array7[10] = &hf_openhpsdr_e_ddcc_ddc_sync7_10;
-       array0[11] = &hf_openhpsdr_e_ddcc_ddc_sync0_11;
-       array1[11] = &hf_openhpsdr_e_ddcc_ddc_sync1_11;
-       array2[11] = &hf_openhpsdr_e_ddcc_ddc_sync2_11;
-       array3[11] = &hf_openhpsdr_e_ddcc_ddc_sync3_11;
-       array4[11] = &hf_openhpsdr_e_ddcc_ddc_sync4_11;
-       array5[11] = &hf_openhpsdr_e_ddcc_ddc_sync5_11;
-       array6[11] = &hf_openhpsdr_e_ddcc_ddc_sync6_11;
-       array7[11] = &hf_openhpsdr_e_ddcc_ddc_sync7_11;
-       array0[12] = &hf_openhpsdr_e_ddcc_ddc_sync0_12;
-       array1[12] = &hf_openhpsdr_e_ddcc_ddc_sync1_12;
-       array2[12] = &hf_openhpsdr_e_ddcc_ddc_sync2_12;
-       array3[12] = &hf_openhpsdr_e_ddcc_ddc_sync3_12;
-       array4[12] = &hf_openhpsdr_e_ddcc_ddc_sync4_12;
-       array5[12] = &hf_openhpsdr_e_ddcc_ddc_sync5_12;
-       array6[12] = &hf_openhpsdr_e_ddcc_ddc_sync6_12;
-       array7[12] = &hf_openhpsdr_e_ddcc_ddc_sync7_12;
-       array0[13] = &hf_openhpsdr_e_ddcc_ddc_sync0_13;
-       array1[13] = &hf_openhpsdr_e_ddcc_ddc_sync1_13;
-       array2[13] = &hf_openhpsdr_e_ddcc_ddc_sync2_13;
-       array3[13] = &hf_openhpsdr_e_ddcc_ddc_sync3_13;
-       array4[13] = &hf_openhpsdr_e_ddcc_ddc_sync4_13;
-       array5[13] = &hf_openhpsdr_e_ddcc_ddc_sync5_13;
-       array6[13] = &hf_openhpsdr_e_ddcc_ddc_sync6_13;
-       array7[13] = &hf_openhpsdr_e_ddcc_ddc_sync7_13;
-       array0[14] = &hf_openhpsdr_e_ddcc_ddc_sync0_14;
-       array1[14] = &hf_openhpsdr_e_ddcc_ddc_sync1_14;
-       array2[14] = &hf_openhpsdr_e_ddcc_ddc_sync2_14;
-       array3[14] = &hf_openhpsdr_e_ddcc_ddc_sync3_14;
-       array4[14] = &hf_openhpsdr_e_ddcc_ddc_sync4_14;
-       array5[14] = &hf_openhpsdr_e_ddcc_ddc_sync5_14;
-       array6[14] = &hf_openhpsdr_e_ddcc_ddc_sync6_14;
-       array7[14] = &hf_openhpsdr_e_ddcc_ddc_sync7_14;
-       array0[15] = &hf_openhpsdr_e_ddcc_ddc_sync0_15;
-       array1[15] = &hf_openhpsdr_e_ddcc_ddc_sync1_15;
-       array2[15] = &hf_openhpsdr_e_ddcc_ddc_sync2_15;
-       array3[15] = &hf_openhpsdr_e_ddcc_ddc_sync3_15;
-       array4[15] = &hf_openhpsdr_e_ddcc_ddc_sync4_15;
-       array5[15] = &hf_openhpsdr_e_ddcc_ddc_sync5_15;
-       array6[15] = &hf_openhpsdr_e_ddcc_ddc_sync6_15;
-       array7[15] = &hf_openhpsdr_e_ddcc_ddc_sync7_15;
-       array0[16] = &hf_openhpsdr_e_ddcc_ddc_sync0_16;
-       array1[16] = &hf_openhpsdr_e_ddcc_ddc_sync1_16;
-       array2[16] = &hf_openhpsdr_e_ddcc_ddc_sync2_16;
-       array3[16] = &hf_openhpsdr_e_ddcc_ddc_sync3_16;
-       array4[16] = &hf_openhpsdr_e_ddcc_ddc_sync4_16;
-       array5[16] = &hf_openhpsdr_e_ddcc_ddc_sync5_16;
-       array6[16] = &hf_openhpsdr_e_ddcc_ddc_sync6_16;
-       array7[16] = &hf_openhpsdr_e_ddcc_ddc_sync7_16;
-       array0[17] = &hf_openhpsdr_e_ddcc_ddc_sync0_17;
-       array1[17] = &hf_openhpsdr_e_ddcc_ddc_sync1_17;
-       array2[17] = &hf_openhpsdr_e_ddcc_ddc_sync2_17;
-       array3[17] = &hf_openhpsdr_e_ddcc_ddc_sync3_17;
-       array4[17] = &hf_openhpsdr_e_ddcc_ddc_sync4_17;
-       array5[17] = &hf_openhpsdr_e_ddcc_ddc_sync5_17;
-       array6[17] = &hf_openhpsdr_e_ddcc_ddc_sync6_17;
-       array7[17] = &hf_openhpsdr_e_ddcc_ddc_sync7_17;
-       array0[18] = &hf_openhpsdr_e_ddcc_ddc_sync0_18;
-       array1[18] = &hf_openhpsdr_e_ddcc_ddc_sync1_18;
-       array2[18] = &hf_openhpsdr_e_ddcc_ddc_sync2_18;
-       array3[18] = &hf_openhpsdr_e_ddcc_ddc_sync3_18;
-       array4[18] = &hf_openhpsdr_e_ddcc_ddc_sync4_18;
-       array5[18] = &hf_openhpsdr_e_ddcc_ddc_sync5_18;
-       array6[18] = &hf_openhpsdr_e_ddcc_ddc_sync6_18;
-       array7[18] = &hf_openhpsdr_e_ddcc_ddc_sync7_18;
-       array0[19] = &hf_openhpsdr_e_ddcc_ddc_sync0_19;
-       array1[19] = &hf_openhpsdr_e_ddcc_ddc_sync1_19;
-       array2[19] = &hf_openhpsdr_e_ddcc_ddc_sync2_19;
-       array3[19] = &hf_openhpsdr_e_ddcc_ddc_sync3_19;
-       array4[19] = &hf_openhpsdr_e_ddcc_ddc_sync4_19;
-       array5[19] = &hf_openhpsdr_e_ddcc_ddc_sync5_19;
-       array6[19] = &hf_openhpsdr_e_ddcc_ddc_sync6_19;
-       array7[19] = &hf_openhpsdr_e_ddcc_ddc_sync7_19;
-       array0[20] = &hf_openhpsdr_e_ddcc_ddc_sync0_20;
-       array1[20] = &hf_openhpsdr_e_ddcc_ddc_sync1_20;
-       array2[20] = &hf_openhpsdr_e_ddcc_ddc_sync2_20;
-       array3[20] = &hf_openhpsdr_e_ddcc_ddc_sync3_20;
-       array4[20] = &hf_openhpsdr_e_ddcc_ddc_sync4_20;
-       array5[20] = &hf_openhpsdr_e_ddcc_ddc_sync5_20;
-       array6[20] = &hf_openhpsdr_e_ddcc_ddc_sync6_20;
-       array7[20] = &hf_openhpsdr_e_ddcc_ddc_sync7_20;
-       array0[21] = &hf_openhpsdr_e_ddcc_ddc_sync0_21;
-       array1[21] = &hf_openhpsdr_e_ddcc_ddc_sync1_21;
-       array2[21] = &hf_openhpsdr_e_ddcc_ddc_sync2_21;
-       array3[21] = &hf_openhpsdr_e_ddcc_ddc_sync3_21;
-       array4[21] = &hf_openhpsdr_e_ddcc_ddc_sync4_21;
-       array5[21] = &hf_openhpsdr_e_ddcc_ddc_sync5_21;
-       array6[21] = &hf_openhpsdr_e_ddcc_ddc_sync6_21;
-       array7[21] = &hf_openhpsdr_e_ddcc_ddc_sync7_21;
-       array0[22] = &hf_openhpsdr_e_ddcc_ddc_sync0_22;
-       array1[22] = &hf_openhpsdr_e_ddcc_ddc_sync1_22;
-       array2[22] = &hf_openhpsdr_e_ddcc_ddc_sync2_22;
-       array3[22] = &hf_openhpsdr_e_ddcc_ddc_sync3_22;
-       array4[22] = &hf_openhpsdr_e_ddcc_ddc_sync4_22;
-       array5[22] = &hf_openhpsdr_e_ddcc_ddc_sync5_22;
-       array6[22] = &hf_openhpsdr_e_ddcc_ddc_sync6_22;
-       array7[22] = &hf_openhpsdr_e_ddcc_ddc_sync7_22;
-       array0[23] = &hf_openhpsdr_e_ddcc_ddc_sync0_23;
-       array1[23] = &hf_openhpsdr_e_ddcc_ddc_sync1_23;
-       array2[23] = &hf_openhpsdr_e_ddcc_ddc_sync2_23;
-       array3[23] = &hf_openhpsdr_e_ddcc_ddc_sync3_23;
-       array4[23] = &hf_openhpsdr_e_ddcc_ddc_sync4_23;
-       array5[23] = &hf_openhpsdr_e_ddcc_ddc_sync5_23;
-       array6[23] = &hf_openhpsdr_e_ddcc_ddc_sync6_23;
-       array7[23] = &hf_openhpsdr_e_ddcc_ddc_sync7_23;
-       array0[24] = &hf_openhpsdr_e_ddcc_ddc_sync0_24;
-       array1[24] = &hf_openhpsdr_e_ddcc_ddc_sync1_24;
-       array2[24] = &hf_openhpsdr_e_ddcc_ddc_sync2_24;
-       array3[24] = &hf_openhpsdr_e_ddcc_ddc_sync3_24;
-       array4[24] = &hf_openhpsdr_e_ddcc_ddc_sync4_24;
-       array5[24] = &hf_openhpsdr_e_ddcc_ddc_sync5_24;
-       array6[24] = &hf_openhpsdr_e_ddcc_ddc_sync6_24;
-       array7[24] = &hf_openhpsdr_e_ddcc_ddc_sync7_24;
-       array0[25] = &hf_openhpsdr_e_ddcc_ddc_sync0_25;
-       array1[25] = &hf_openhpsdr_e_ddcc_ddc_sync1_25;
-       array2[25] = &hf_openhpsdr_e_ddcc_ddc_sync2_25;
-       array3[25] = &hf_openhpsdr_e_ddcc_ddc_sync3_25;
-       array4[25] = &hf_openhpsdr_e_ddcc_ddc_sync4_25;
-       array5[25] = &hf_openhpsdr_e_ddcc_ddc_sync5_25;
-       array6[25] = &hf_openhpsdr_e_ddcc_ddc_sync6_25;
-       array7[25] = &hf_openhpsdr_e_ddcc_ddc_sync7_25;
-       array0[26] = &hf_openhpsdr_e_ddcc_ddc_sync0_26;
-       array1[26] = &hf_openhpsdr_e_ddcc_ddc_sync1_26;
-       array2[26] = &hf_openhpsdr_e_ddcc_ddc_sync2_26;
-       array3[26] = &hf_openhpsdr_e_ddcc_ddc_sync3_26;
-       array4[26] = &hf_openhpsdr_e_ddcc_ddc_sync4_26;
-       array5[26] = &hf_openhpsdr_e_ddcc_ddc_sync5_26;
-       array6[26] = &hf_openhpsdr_e_ddcc_ddc_sync6_26;
-       array7[26] = &hf_openhpsdr_e_ddcc_ddc_sync7_26;
-       array0[27] = &hf_openhpsdr_e_ddcc_ddc_sync0_27;
-       array1[27] = &hf_openhpsdr_e_ddcc_ddc_sync1_27;
-       array2[27] = &hf_openhpsdr_e_ddcc_ddc_sync2_27;
-       array3[27] = &hf_openhpsdr_e_ddcc_ddc_sync3_27;
-       array4[27] = &hf_openhpsdr_e_ddcc_ddc_sync4_27;
-       array5[27] = &hf_openhpsdr_e_ddcc_ddc_sync5_27;
-       array6[27] = &hf_openhpsdr_e_ddcc_ddc_sync6_27;
-       array7[27] = &hf_openhpsdr_e_ddcc_ddc_sync7_27;
-       array0[28] = &hf_openhpsdr_e_ddcc_ddc_sync0_28;
-       array1[28] = &hf_openhpsdr_e_ddcc_ddc_sync1_28;
-       array2[28] = &hf_openhpsdr_e_ddcc_ddc_sync2_28;
-       array3[28] = &hf_openhpsdr_e_ddcc_ddc_sync3_28;
-       array4[28] = &hf_openhpsdr_e_ddcc_ddc_sync4_28;
-       array5[28] = &hf_openhpsdr_e_ddcc_ddc_sync5_28;
-       array6[28] = &hf_openhpsdr_e_ddcc_ddc_sync6_28;
-       array7[28] = &hf_openhpsdr_e_ddcc_ddc_sync7_28;
-       array0[29] = &hf_openhpsdr_e_ddcc_ddc_sync0_29;
-       array1[29] = &hf_openhpsdr_e_ddcc_ddc_sync1_29;
-       array2[29] = &hf_openhpsdr_e_ddcc_ddc_sync2_29;
-       array3[29] = &hf_openhpsdr_e_ddcc_ddc_sync3_29;
-       array4[29] = &hf_openhpsdr_e_ddcc_ddc_sync4_29;
-       array5[29] = &hf_openhpsdr_e_ddcc_ddc_sync5_29;
-       array6[29] = &hf_openhpsdr_e_ddcc_ddc_sync6_29;
-       array7[29] = &hf_openhpsdr_e_ddcc_ddc_sync7_29;
-       array0[30] = &hf_openhpsdr_e_ddcc_ddc_sync0_30;
-       array1[30] = &hf_openhpsdr_e_ddcc_ddc_sync1_30;
-       array2[30] = &hf_openhpsdr_e_ddcc_ddc_sync2_30;
-       array3[30] = &hf_openhpsdr_e_ddcc_ddc_sync3_30;
-       array4[30] = &hf_openhpsdr_e_ddcc_ddc_sync4_30;
-       array5[30] = &hf_openhpsdr_e_ddcc_ddc_sync5_30;
-       array6[30] = &hf_openhpsdr_e_ddcc_ddc_sync6_30;
-       array7[30] = &hf_openhpsdr_e_ddcc_ddc_sync7_30;
-       array0[31] = &hf_openhpsdr_e_ddcc_ddc_sync0_31;
-       array1[31] = &hf_openhpsdr_e_ddcc_ddc_sync1_31;
-       array2[31] = &hf_openhpsdr_e_ddcc_ddc_sync2_31;
-       array3[31] = &hf_openhpsdr_e_ddcc_ddc_sync3_31;
-       array4[31] = &hf_openhpsdr_e_ddcc_ddc_sync4_31;
-       array5[31] = &hf_openhpsdr_e_ddcc_ddc_sync5_31;
-       array6[31] = &hf_openhpsdr_e_ddcc_ddc_sync6_31;
-       array7[31] = &hf_openhpsdr_e_ddcc_ddc_sync7_31;
-       array0[32] = &hf_openhpsdr_e_ddcc_ddc_sync0_32;
-       array1[32] = &hf_openhpsdr_e_ddcc_ddc_sync1_32;
-       array2[32] = &hf_openhpsdr_e_ddcc_ddc_sync2_32;
-       array3[32] = &hf_openhpsdr_e_ddcc_ddc_sync3_32;
-       array4[32] = &hf_openhpsdr_e_ddcc_ddc_sync4_32;
-       array5[32] = &hf_openhpsdr_e_ddcc_ddc_sync5_32;
-       array6[32] = &hf_openhpsdr_e_ddcc_ddc_sync6_32;
-       array7[32] = &hf_openhpsdr_e_ddcc_ddc_sync7_32;
-       array0[33] = &hf_openhpsdr_e_ddcc_ddc_sync0_33;
-       array1[33] = &hf_openhpsdr_e_ddcc_ddc_sync1_33;
-       array2[33] = &hf_openhpsdr_e_ddcc_ddc_sync2_33;
-       array3[33] = &hf_openhpsdr_e_ddcc_ddc_sync3_33;
-       array4[33] = &hf_openhpsdr_e_ddcc_ddc_sync4_33;
-       array5[33] = &hf_openhpsdr_e_ddcc_ddc_sync5_33;
-       array6[33] = &hf_openhpsdr_e_ddcc_ddc_sync6_33;
-       array7[33] = &hf_openhpsdr_e_ddcc_ddc_sync7_33;
-       array0[34] = &hf_openhpsdr_e_ddcc_ddc_sync0_34;
-       array1[34] = &hf_openhpsdr_e_ddcc_ddc_sync1_34;
-       array2[34] = &hf_openhpsdr_e_ddcc_ddc_sync2_34;
-       array3[34] = &hf_openhpsdr_e_ddcc_ddc_sync3_34;
-       array4[34] = &hf_openhpsdr_e_ddcc_ddc_sync4_34;
-       array5[34] = &hf_openhpsdr_e_ddcc_ddc_sync5_34;
-       array6[34] = &hf_openhpsdr_e_ddcc_ddc_sync6_34;
-       array7[34] = &hf_openhpsdr_e_ddcc_ddc_sync7_34;
-       array0[35] = &hf_openhpsdr_e_ddcc_ddc_sync0_35;
-       array1[35] = &hf_openhpsdr_e_ddcc_ddc_sync1_35;
-       array2[35] = &hf_openhpsdr_e_ddcc_ddc_sync2_35;
-       array3[35] = &hf_openhpsdr_e_ddcc_ddc_sync3_35;
-       array4[35] = &hf_openhpsdr_e_ddcc_ddc_sync4_35;
-       array5[35] = &hf_openhpsdr_e_ddcc_ddc_sync5_35;
-       array6[35] = &hf_openhpsdr_e_ddcc_ddc_sync6_35;
-       array7[35] = &hf_openhpsdr_e_ddcc_ddc_sync7_35;
-       array0[36] = &hf_openhpsdr_e_ddcc_ddc_sync0_36;
-       array1[36] = &hf_openhpsdr_e_ddcc_ddc_sync1_36;
-       array2[36] = &hf_openhpsdr_e_ddcc_ddc_sync2_36;
-       array3[36] = &hf_openhpsdr_e_ddcc_ddc_sync3_36;
-       array4[36] = &hf_openhpsdr_e_ddcc_ddc_sync4_36;
-       array5[36] = &hf_openhpsdr_e_ddcc_ddc_sync5_36;
-       array6[36] = &hf_openhpsdr_e_ddcc_ddc_sync6_36;
-       array7[36] = &hf_openhpsdr_e_ddcc_ddc_sync7_36;
-       array0[37] = &hf_openhpsdr_e_ddcc_ddc_sync0_37;
-       array1[37] = &hf_openhpsdr_e_ddcc_ddc_sync1_37;
-       array2[37] = &hf_openhpsdr_e_ddcc_ddc_sync2_37;
-       array3[37] = &hf_openhpsdr_e_ddcc_ddc_sync3_37;
-       array4[37] = &hf_openhpsdr_e_ddcc_ddc_sync4_37;
-       array5[37] = &hf_openhpsdr_e_ddcc_ddc_sync5_37;
-       array6[37] = &hf_openhpsdr_e_ddcc_ddc_sync6_37;
-       array7[37] = &hf_openhpsdr_e_ddcc_ddc_sync7_37;
-       array0[38] = &hf_openhpsdr_e_ddcc_ddc_sync0_38;
-       array1[38] = &hf_openhpsdr_e_ddcc_ddc_sync1_38;
-       array2[38] = &hf_openhpsdr_e_ddcc_ddc_sync2_38;
-       array3[38] = &hf_openhpsdr_e_ddcc_ddc_sync3_38;
-       array4[38] = &hf_openhpsdr_e_ddcc_ddc_sync4_38;
-       array5[38] = &hf_openhpsdr_e_ddcc_ddc_sync5_38;
-       array6[38] = &hf_openhpsdr_e_ddcc_ddc_sync6_38;
-       array7[38] = &hf_openhpsdr_e_ddcc_ddc_sync7_38;
-       array0[39] = &hf_openhpsdr_e_ddcc_ddc_sync0_39;
-       array1[39] = &hf_openhpsdr_e_ddcc_ddc_sync1_39;
-       array2[39] = &hf_openhpsdr_e_ddcc_ddc_sync2_39;
-       array3[39] = &hf_openhpsdr_e_ddcc_ddc_sync3_39;
-       array4[39] = &hf_openhpsdr_e_ddcc_ddc_sync4_39;
-       array5[39] = &hf_openhpsdr_e_ddcc_ddc_sync5_39;
-       array6[39] = &hf_openhpsdr_e_ddcc_ddc_sync6_39;
-       array7[39] = &hf_openhpsdr_e_ddcc_ddc_sync7_39;
-       array0[40] = &hf_openhpsdr_e_ddcc_ddc_sync0_40;
-       array1[40] = &hf_openhpsdr_e_ddcc_ddc_sync1_40;
-       array2[40] = &hf_openhpsdr_e_ddcc_ddc_sync2_40;
-       array3[40] = &hf_openhpsdr_e_ddcc_ddc_sync3_40;
-       array4[40] = &hf_openhpsdr_e_ddcc_ddc_sync4_40;
-       array5[40] = &hf_openhpsdr_e_ddcc_ddc_sync5_40;
-       array6[40] = &hf_openhpsdr_e_ddcc_ddc_sync6_40;
-       array7[40] = &hf_openhpsdr_e_ddcc_ddc_sync7_40;
-       array0[41] = &hf_openhpsdr_e_ddcc_ddc_sync0_41;
-       array1[41] = &hf_openhpsdr_e_ddcc_ddc_sync1_41;
-       array2[41] = &hf_openhpsdr_e_ddcc_ddc_sync2_41;
-       array3[41] = &hf_openhpsdr_e_ddcc_ddc_sync3_41;
-       array4[41] = &hf_openhpsdr_e_ddcc_ddc_sync4_41;
-       array5[41] = &hf_openhpsdr_e_ddcc_ddc_sync5_41;
-       array6[41] = &hf_openhpsdr_e_ddcc_ddc_sync6_41;
-       array7[41] = &hf_openhpsdr_e_ddcc_ddc_sync7_41;
-       array0[42] = &hf_openhpsdr_e_ddcc_ddc_sync0_42;
-       array1[42] = &hf_openhpsdr_e_ddcc_ddc_sync1_42;
-       array2[42] = &hf_openhpsdr_e_ddcc_ddc_sync2_42;
-       array3[42] = &hf_openhpsdr_e_ddcc_ddc_sync3_42;
-       array4[42] = &hf_openhpsdr_e_ddcc_ddc_sync4_42;
-       array5[42] = &hf_openhpsdr_e_ddcc_ddc_sync5_42;
-       array6[42] = &hf_openhpsdr_e_ddcc_ddc_sync6_42;
-       array7[42] = &hf_openhpsdr_e_ddcc_ddc_sync7_42;
-       array0[43] = &hf_openhpsdr_e_ddcc_ddc_sync0_43;
-       array1[43] = &hf_openhpsdr_e_ddcc_ddc_sync1_43;
-       array2[43] = &hf_openhpsdr_e_ddcc_ddc_sync2_43;
-       array3[43] = &hf_openhpsdr_e_ddcc_ddc_sync3_43;
-       array4[43] = &hf_openhpsdr_e_ddcc_ddc_sync4_43;
-       array5[43] = &hf_openhpsdr_e_ddcc_ddc_sync5_43;
-       array6[43] = &hf_openhpsdr_e_ddcc_ddc_sync6_43;
-       array7[43] = &hf_openhpsdr_e_ddcc_ddc_sync7_43;
-       array0[44] = &hf_openhpsdr_e_ddcc_ddc_sync0_44;
-       array1[44] = &hf_openhpsdr_e_ddcc_ddc_sync1_44;
-       array2[44] = &hf_openhpsdr_e_ddcc_ddc_sync2_44;
-       array3[44] = &hf_openhpsdr_e_ddcc_ddc_sync3_44;
-       array4[44] = &hf_openhpsdr_e_ddcc_ddc_sync4_44;
-       array5[44] = &hf_openhpsdr_e_ddcc_ddc_sync5_44;
-       array6[44] = &hf_openhpsdr_e_ddcc_ddc_sync6_44;
-       array7[44] = &hf_openhpsdr_e_ddcc_ddc_sync7_44;
-       array0[45] = &hf_openhpsdr_e_ddcc_ddc_sync0_45;
-       array1[45] = &hf_openhpsdr_e_ddcc_ddc_sync1_45;
-       array2[45] = &hf_openhpsdr_e_ddcc_ddc_sync2_45;
-       array3[45] = &hf_openhpsdr_e_ddcc_ddc_sync3_45;
-       array4[45] = &hf_openhpsdr_e_ddcc_ddc_sync4_45;
-       array5[45] = &hf_openhpsdr_e_ddcc_ddc_sync5_45;
-       array6[45] = &hf_openhpsdr_e_ddcc_ddc_sync6_45;
-       array7[45] = &hf_openhpsdr_e_ddcc_ddc_sync7_45;
-       array0[46] = &hf_openhpsdr_e_ddcc_ddc_sync0_46;
-       array1[46] = &hf_openhpsdr_e_ddcc_ddc_sync1_46;
-       array2[46] = &hf_openhpsdr_e_ddcc_ddc_sync2_46;
-       array3[46] = &hf_openhpsdr_e_ddcc_ddc_sync3_46;
-       array4[46] = &hf_openhpsdr_e_ddcc_ddc_sync4_46;
-       array5[46] = &hf_openhpsdr_e_ddcc_ddc_sync5_46;
-       array6[46] = &hf_openhpsdr_e_ddcc_ddc_sync6_46;
-       array7[46] = &hf_openhpsdr_e_ddcc_ddc_sync7_46;
-       array0[47] = &hf_openhpsdr_e_ddcc_ddc_sync0_47;
-       array1[47] = &hf_openhpsdr_e_ddcc_ddc_sync1_47;
-       array2[47] = &hf_openhpsdr_e_ddcc_ddc_sync2_47;
-       array3[47] = &hf_openhpsdr_e_ddcc_ddc_sync3_47;
-       array4[47] = &hf_openhpsdr_e_ddcc_ddc_sync4_47;
-       array5[47] = &hf_openhpsdr_e_ddcc_ddc_sync5_47;
-       array6[47] = &hf_openhpsdr_e_ddcc_ddc_sync6_47;
-       array7[47] = &hf_openhpsdr_e_ddcc_ddc_sync7_47;
-       array0[48] = &hf_openhpsdr_e_ddcc_ddc_sync0_48;
-       array1[48] = &hf_openhpsdr_e_ddcc_ddc_sync1_48;
-       array2[48] = &hf_openhpsdr_e_ddcc_ddc_sync2_48;
-       array3[48] = &hf_openhpsdr_e_ddcc_ddc_sync3_48;
-       array4[48] = &hf_openhpsdr_e_ddcc_ddc_sync4_48;
-       array5[48] = &hf_openhpsdr_e_ddcc_ddc_sync5_48;
-       array6[48] = &hf_openhpsdr_e_ddcc_ddc_sync6_48;
-       array7[48] = &hf_openhpsdr_e_ddcc_ddc_sync7_48;
-       array0[49] = &hf_openhpsdr_e_ddcc_ddc_sync0_49;
-       array1[49] = &hf_openhpsdr_e_ddcc_ddc_sync1_49;
-       array2[49] = &hf_openhpsdr_e_ddcc_ddc_sync2_49;
-       array3[49] = &hf_openhpsdr_e_ddcc_ddc_sync3_49;
-       array4[49] = &hf_openhpsdr_e_ddcc_ddc_sync4_49;
-       array5[49] = &hf_openhpsdr_e_ddcc_ddc_sync5_49;
-       array6[49] = &hf_openhpsdr_e_ddcc_ddc_sync6_49;
-       array7[49] = &hf_openhpsdr_e_ddcc_ddc_sync7_49;
-       array0[50] = &hf_openhpsdr_e_ddcc_ddc_sync0_50;
-       array1[50] = &hf_openhpsdr_e_ddcc_ddc_sync1_50;
-       array2[50] = &hf_openhpsdr_e_ddcc_ddc_sync2_50;
-       array3[50] = &hf_openhpsdr_e_ddcc_ddc_sync3_50;
-       array4[50] = &hf_openhpsdr_e_ddcc_ddc_sync4_50;
-       array5[50] = &hf_openhpsdr_e_ddcc_ddc_sync5_50;
-       array6[50] = &hf_openhpsdr_e_ddcc_ddc_sync6_50;
-       array7[50] = &hf_openhpsdr_e_ddcc_ddc_sync7_50;
-       array0[51] = &hf_openhpsdr_e_ddcc_ddc_sync0_51;
-       array1[51] = &hf_openhpsdr_e_ddcc_ddc_sync1_51;
-       array2[51] = &hf_openhpsdr_e_ddcc_ddc_sync2_51;
-       array3[51] = &hf_openhpsdr_e_ddcc_ddc_sync3_51;
-       array4[51] = &hf_openhpsdr_e_ddcc_ddc_sync4_51;
-       array5[51] = &hf_openhpsdr_e_ddcc_ddc_sync5_51;
-       array6[51] = &hf_openhpsdr_e_ddcc_ddc_sync6_51;
-       array7[51] = &hf_openhpsdr_e_ddcc_ddc_sync7_51;
-       array0[52] = &hf_openhpsdr_e_ddcc_ddc_sync0_52;
-       array1[52] = &hf_openhpsdr_e_ddcc_ddc_sync1_52;
-       array2[52] = &hf_openhpsdr_e_ddcc_ddc_sync2_52;
-       array3[52] = &hf_openhpsdr_e_ddcc_ddc_sync3_52;
-       array4[52] = &hf_openhpsdr_e_ddcc_ddc_sync4_52;
-       array5[52] = &hf_openhpsdr_e_ddcc_ddc_sync5_52;
-       array6[52] = &hf_openhpsdr_e_ddcc_ddc_sync6_52;
-       array7[52] = &hf_openhpsdr_e_ddcc_ddc_sync7_52;
-       array0[53] = &hf_openhpsdr_e_ddcc_ddc_sync0_53;
-       array1[53] = &hf_openhpsdr_e_ddcc_ddc_sync1_53;
-       array2[53] = &hf_openhpsdr_e_ddcc_ddc_sync2_53;
-       array3[53] = &hf_openhpsdr_e_ddcc_ddc_sync3_53;
-       array4[53] = &hf_openhpsdr_e_ddcc_ddc_sync4_53;
-       array5[53] = &hf_openhpsdr_e_ddcc_ddc_sync5_53;
-       array6[53] = &hf_openhpsdr_e_ddcc_ddc_sync6_53;
-       array7[53] = &hf_openhpsdr_e_ddcc_ddc_sync7_53;
-       array0[54] = &hf_openhpsdr_e_ddcc_ddc_sync0_54;
-       array1[54] = &hf_openhpsdr_e_ddcc_ddc_sync1_54;
-       array2[54] = &hf_openhpsdr_e_ddcc_ddc_sync2_54;
-       array3[54] = &hf_openhpsdr_e_ddcc_ddc_sync3_54;
-       array4[54] = &hf_openhpsdr_e_ddcc_ddc_sync4_54;
-       array5[54] = &hf_openhpsdr_e_ddcc_ddc_sync5_54;
-       array6[54] = &hf_openhpsdr_e_ddcc_ddc_sync6_54;
-       array7[54] = &hf_openhpsdr_e_ddcc_ddc_sync7_54;
-       array0[55] = &hf_openhpsdr_e_ddcc_ddc_sync0_55;
-       array1[55] = &hf_openhpsdr_e_ddcc_ddc_sync1_55;
-       array2[55] = &hf_openhpsdr_e_ddcc_ddc_sync2_55;
-       array3[55] = &hf_openhpsdr_e_ddcc_ddc_sync3_55;
-       array4[55] = &hf_openhpsdr_e_ddcc_ddc_sync4_55;
-       array5[55] = &hf_openhpsdr_e_ddcc_ddc_sync5_55;
-       array6[55] = &hf_openhpsdr_e_ddcc_ddc_sync6_55;
-       array7[55] = &hf_openhpsdr_e_ddcc_ddc_sync7_55;
-       array0[56] = &hf_openhpsdr_e_ddcc_ddc_sync0_56;
-       array1[56] = &hf_openhpsdr_e_ddcc_ddc_sync1_56;
-       array2[56] = &hf_openhpsdr_e_ddcc_ddc_sync2_56;
-       array3[56] = &hf_openhpsdr_e_ddcc_ddc_sync3_56;
-       array4[56] = &hf_openhpsdr_e_ddcc_ddc_sync4_56;
-       array5[56] = &hf_openhpsdr_e_ddcc_ddc_sync5_56;
-       array6[56] = &hf_openhpsdr_e_ddcc_ddc_sync6_56;
-       array7[56] = &hf_openhpsdr_e_ddcc_ddc_sync7_56;
-       array0[57] = &hf_openhpsdr_e_ddcc_ddc_sync0_57;
-       array1[57] = &hf_openhpsdr_e_ddcc_ddc_sync1_57;
-       array2[57] = &hf_openhpsdr_e_ddcc_ddc_sync2_57;
-       array3[57] = &hf_openhpsdr_e_ddcc_ddc_sync3_57;
-       array4[57] = &hf_openhpsdr_e_ddcc_ddc_sync4_57;
-       array5[57] = &hf_openhpsdr_e_ddcc_ddc_sync5_57;
-       array6[57] = &hf_openhpsdr_e_ddcc_ddc_sync6_57;
-       array7[57] = &hf_openhpsdr_e_ddcc_ddc_sync7_57;
-       array0[58] = &hf_openhpsdr_e_ddcc_ddc_sync0_58;
-       array1[58] = &hf_openhpsdr_e_ddcc_ddc_sync1_58;
-       array2[58] = &hf_openhpsdr_e_ddcc_ddc_sync2_58;
-       array3[58] = &hf_openhpsdr_e_ddcc_ddc_sync3_58;
-       array4[58] = &hf_openhpsdr_e_ddcc_ddc_sync4_58;
-       array5[58] = &hf_openhpsdr_e_ddcc_ddc_sync5_58;
-       array6[58] = &hf_openhpsdr_e_ddcc_ddc_sync6_58;
-       array7[58] = &hf_openhpsdr_e_ddcc_ddc_sync7_58;
-       array0[59] = &hf_openhpsdr_e_ddcc_ddc_sync0_59;
-       array1[59] = &hf_openhpsdr_e_ddcc_ddc_sync1_59;
-       array2[59] = &hf_openhpsdr_e_ddcc_ddc_sync2_59;
-       array3[59] = &hf_openhpsdr_e_ddcc_ddc_sync3_59;
-       array4[59] = &hf_openhpsdr_e_ddcc_ddc_sync4_59;
-       array5[59] = &hf_openhpsdr_e_ddcc_ddc_sync5_59;
-       array6[59] = &hf_openhpsdr_e_ddcc_ddc_sync6_59;
-       array7[59] = &hf_openhpsdr_e_ddcc_ddc_sync7_59;
-       array0[60] = &hf_openhpsdr_e_ddcc_ddc_sync0_60;
-       array1[60] = &hf_openhpsdr_e_ddcc_ddc_sync1_60;
-       array2[60] = &hf_openhpsdr_e_ddcc_ddc_sync2_60;
-       array3[60] = &hf_openhpsdr_e_ddcc_ddc_sync3_60;
-       array4[60] = &hf_openhpsdr_e_ddcc_ddc_sync4_60;
-       array5[60] = &hf_openhpsdr_e_ddcc_ddc_sync5_60;
-       array6[60] = &hf_openhpsdr_e_ddcc_ddc_sync6_60;
-       array7[60] = &hf_openhpsdr_e_ddcc_ddc_sync7_60;
-       array0[61] = &hf_openhpsdr_e_ddcc_ddc_sync0_61;
-       array1[61] = &hf_openhpsdr_e_ddcc_ddc_sync1_61;
-       array2[61] = &hf_openhpsdr_e_ddcc_ddc_sync2_61;
-       array3[61] = &hf_openhpsdr_e_ddcc_ddc_sync3_61;
-       array4[61] = &hf_openhpsdr_e_ddcc_ddc_sync4_61;
-       array5[61] = &hf_openhpsdr_e_ddcc_ddc_sync5_61;
-       array6[61] = &hf_openhpsdr_e_ddcc_ddc_sync6_61;
-       array7[61] = &hf_openhpsdr_e_ddcc_ddc_sync7_61;
-       array0[62] = &hf_openhpsdr_e_ddcc_ddc_sync0_62;
-       array1[62] = &hf_openhpsdr_e_ddcc_ddc_sync1_62;
-       array2[62] = &hf_openhpsdr_e_ddcc_ddc_sync2_62;
-       array3[62] = &hf_openhpsdr_e_ddcc_ddc_sync3_62;
-       array4[62] = &hf_openhpsdr_e_ddcc_ddc_sync4_62;
-       array5[62] = &hf_openhpsdr_e_ddcc_ddc_sync5_62;
-       array6[62] = &hf_openhpsdr_e_ddcc_ddc_sync6_62;
-       array7[62] = &hf_openhpsdr_e_ddcc_ddc_sync7_62;
-       array0[63] = &hf_openhpsdr_e_ddcc_ddc_sync0_63;
-       array1[63] = &hf_openhpsdr_e_ddcc_ddc_sync1_63;
-       array2[63] = &hf_openhpsdr_e_ddcc_ddc_sync2_63;
-       array3[63] = &hf_openhpsdr_e_ddcc_ddc_sync3_63;
-       array4[63] = &hf_openhpsdr_e_ddcc_ddc_sync4_63;
-       array5[63] = &hf_openhpsdr_e_ddcc_ddc_sync5_63;
-       array6[63] = &hf_openhpsdr_e_ddcc_ddc_sync6_63;
-       array7[63] = &hf_openhpsdr_e_ddcc_ddc_sync7_63;
-       array0[64] = &hf_openhpsdr_e_ddcc_ddc_sync0_64;
-       array1[64] = &hf_openhpsdr_e_ddcc_ddc_sync1_64;
-       array2[64] = &hf_openhpsdr_e_ddcc_ddc_sync2_64;
-       array3[64] = &hf_openhpsdr_e_ddcc_ddc_sync3_64;
-       array4[64] = &hf_openhpsdr_e_ddcc_ddc_sync4_64;
-       array5[64] = &hf_openhpsdr_e_ddcc_ddc_sync5_64;
-       array6[64] = &hf_openhpsdr_e_ddcc_ddc_sync6_64;
-       array7[64] = &hf_openhpsdr_e_ddcc_ddc_sync7_64;
-       array0[65] = &hf_openhpsdr_e_ddcc_ddc_sync0_65;
-       array1[65] = &hf_openhpsdr_e_ddcc_ddc_sync1_65;
-       array2[65] = &hf_openhpsdr_e_ddcc_ddc_sync2_65;
-       array3[65] = &hf_openhpsdr_e_ddcc_ddc_sync3_65;
-       array4[65] = &hf_openhpsdr_e_ddcc_ddc_sync4_65;
-       array5[65] = &hf_openhpsdr_e_ddcc_ddc_sync5_65;
-       array6[65] = &hf_openhpsdr_e_ddcc_ddc_sync6_65;
-       array7[65] = &hf_openhpsdr_e_ddcc_ddc_sync7_65;
-       array0[66] = &hf_openhpsdr_e_ddcc_ddc_sync0_66;
-       array1[66] = &hf_openhpsdr_e_ddcc_ddc_sync1_66;
-       array2[66] = &hf_openhpsdr_e_ddcc_ddc_sync2_66;
-       array3[66] = &hf_openhpsdr_e_ddcc_ddc_sync3_66;
-       array4[66] = &hf_openhpsdr_e_ddcc_ddc_sync4_66;
-       array5[66] = &hf_openhpsdr_e_ddcc_ddc_sync5_66;
-       array6[66] = &hf_openhpsdr_e_ddcc_ddc_sync6_66;
-       array7[66] = &hf_openhpsdr_e_ddcc_ddc_sync7_66;
-       array0[67] = &hf_openhpsdr_e_ddcc_ddc_sync0_67;
-       array1[67] = &hf_openhpsdr_e_ddcc_ddc_sync1_67;
-       array2[67] = &hf_openhpsdr_e_ddcc_ddc_sync2_67;
-       array3[67] = &hf_openhpsdr_e_ddcc_ddc_sync3_67;
-       array4[67] = &hf_openhpsdr_e_ddcc_ddc_sync4_67;
-       array5[67] = &hf_openhpsdr_e_ddcc_ddc_sync5_67;
-       array6[67] = &hf_openhpsdr_e_ddcc_ddc_sync6_67;
-       array7[67] = &hf_openhpsdr_e_ddcc_ddc_sync7_67;
-       array0[68] = &hf_openhpsdr_e_ddcc_ddc_sync0_68;
-       array1[68] = &hf_openhpsdr_e_ddcc_ddc_sync1_68;
-       array2[68] = &hf_openhpsdr_e_ddcc_ddc_sync2_68;
-       array3[68] = &hf_openhpsdr_e_ddcc_ddc_sync3_68;
-       array4[68] = &hf_openhpsdr_e_ddcc_ddc_sync4_68;
-       array5[68] = &hf_openhpsdr_e_ddcc_ddc_sync5_68;
-       array6[68] = &hf_openhpsdr_e_ddcc_ddc_sync6_68;
-       array7[68] = &hf_openhpsdr_e_ddcc_ddc_sync7_68;
-       array0[69] = &hf_openhpsdr_e_ddcc_ddc_sync0_69;
-       array1[69] = &hf_openhpsdr_e_ddcc_ddc_sync1_69;
-       array2[69] = &hf_openhpsdr_e_ddcc_ddc_sync2_69;
-       array3[69] = &hf_openhpsdr_e_ddcc_ddc_sync3_69;
-       array4[69] = &hf_openhpsdr_e_ddcc_ddc_sync4_69;
-       array5[69] = &hf_openhpsdr_e_ddcc_ddc_sync5_69;
-       array6[69] = &hf_openhpsdr_e_ddcc_ddc_sync6_69;
-       array7[69] = &hf_openhpsdr_e_ddcc_ddc_sync7_69;
-       array0[70] = &hf_openhpsdr_e_ddcc_ddc_sync0_70;
-       array1[70] = &hf_openhpsdr_e_ddcc_ddc_sync1_70;
-       array2[70] = &hf_openhpsdr_e_ddcc_ddc_sync2_70;
-       array3[70] = &hf_openhpsdr_e_ddcc_ddc_sync3_70;
-       array4[70] = &hf_openhpsdr_e_ddcc_ddc_sync4_70;
-       array5[70] = &hf_openhpsdr_e_ddcc_ddc_sync5_70;
-       array6[70] = &hf_openhpsdr_e_ddcc_ddc_sync6_70;
-       array7[70] = &hf_openhpsdr_e_ddcc_ddc_sync7_70;
-       array0[71] = &hf_openhpsdr_e_ddcc_ddc_sync0_71;
-       array1[71] = &hf_openhpsdr_e_ddcc_ddc_sync1_71;
-       array2[71] = &hf_openhpsdr_e_ddcc_ddc_sync2_71;
-       array3[71] = &hf_openhpsdr_e_ddcc_ddc_sync3_71;
-       array4[71] = &hf_openhpsdr_e_ddcc_ddc_sync4_71;
-       array5[71] = &hf_openhpsdr_e_ddcc_ddc_sync5_71;
-       array6[71] = &hf_openhpsdr_e_ddcc_ddc_sync6_71;
-       array7[71] = &hf_openhpsdr_e_ddcc_ddc_sync7_71;
-       array0[72] = &hf_openhpsdr_e_ddcc_ddc_sync0_72;
-       array1[72] = &hf_openhpsdr_e_ddcc_ddc_sync1_72;
-       array2[72] = &hf_openhpsdr_e_ddcc_ddc_sync2_72;
-       array3[72] = &hf_openhpsdr_e_ddcc_ddc_sync3_72;
-       array4[72] = &hf_openhpsdr_e_ddcc_ddc_sync4_72;
-       array5[72] = &hf_openhpsdr_e_ddcc_ddc_sync5_72;
-       array6[72] = &hf_openhpsdr_e_ddcc_ddc_sync6_72;
-       array7[72] = &hf_openhpsdr_e_ddcc_ddc_sync7_72;
-       array0[73] = &hf_openhpsdr_e_ddcc_ddc_sync0_73;
-       array1[73] = &hf_openhpsdr_e_ddcc_ddc_sync1_73;
-       array2[73] = &hf_openhpsdr_e_ddcc_ddc_sync2_73;
-       array3[73] = &hf_openhpsdr_e_ddcc_ddc_sync3_73;
-       array4[73] = &hf_openhpsdr_e_ddcc_ddc_sync4_73;
-       array5[73] = &hf_openhpsdr_e_ddcc_ddc_sync5_73;
-       array6[73] = &hf_openhpsdr_e_ddcc_ddc_sync6_73;
-       array7[73] = &hf_openhpsdr_e_ddcc_ddc_sync7_73;
-       array0[74] = &hf_openhpsdr_e_ddcc_ddc_sync0_74;
-       array1[74] = &hf_openhpsdr_e_ddcc_ddc_sync1_74;
-       array2[74] = &hf_openhpsdr_e_ddcc_ddc_sync2_74;
-       array3[74] = &hf_openhpsdr_e_ddcc_ddc_sync3_74;
-       array4[74] = &hf_openhpsdr_e_ddcc_ddc_sync4_74;
-       array5[74] = &hf_openhpsdr_e_ddcc_ddc_sync5_74;
-       array6[74] = &hf_openhpsdr_e_ddcc_ddc_sync6_74;
-       array7[74] = &hf_openhpsdr_e_ddcc_ddc_sync7_74;
-       array0[75] = &hf_openhpsdr_e_ddcc_ddc_sync0_75;
-       array1[75] = &hf_openhpsdr_e_ddcc_ddc_sync1_75;
-       array2[75] = &hf_openhpsdr_e_ddcc_ddc_sync2_75;
-       array3[75] = &hf_openhpsdr_e_ddcc_ddc_sync3_75;
-       array4[75] = &hf_openhpsdr_e_ddcc_ddc_sync4_75;
-       array5[75] = &hf_openhpsdr_e_ddcc_ddc_sync5_75;
-       array6[75] = &hf_openhpsdr_e_ddcc_ddc_sync6_75;
-       array7[75] = &hf_openhpsdr_e_ddcc_ddc_sync7_75;
-       array0[76] = &hf_openhpsdr_e_ddcc_ddc_sync0_76;
-       array1[76] = &hf_openhpsdr_e_ddcc_ddc_sync1_76;
-       array2[76] = &hf_openhpsdr_e_ddcc_ddc_sync2_76;
-       array3[76] = &hf_openhpsdr_e_ddcc_ddc_sync3_76;
-       array4[76] = &hf_openhpsdr_e_ddcc_ddc_sync4_76;
-       array5[76] = &hf_openhpsdr_e_ddcc_ddc_sync5_76;
-       array6[76] = &hf_openhpsdr_e_ddcc_ddc_sync6_76;
-       array7[76] = &hf_openhpsdr_e_ddcc_ddc_sync7_76;
-       array0[77] = &hf_openhpsdr_e_ddcc_ddc_sync0_77;
-       array1[77] = &hf_openhpsdr_e_ddcc_ddc_sync1_77;
-       array2[77] = &hf_openhpsdr_e_ddcc_ddc_sync2_77;
-       array3[77] = &hf_openhpsdr_e_ddcc_ddc_sync3_77;
-       array4[77] = &hf_openhpsdr_e_ddcc_ddc_sync4_77;
-       array5[77] = &hf_openhpsdr_e_ddcc_ddc_sync5_77;
-       array6[77] = &hf_openhpsdr_e_ddcc_ddc_sync6_77;
-       array7[77] = &hf_openhpsdr_e_ddcc_ddc_sync7_77;
-       array0[78] = &hf_openhpsdr_e_ddcc_ddc_sync0_78;
-       array1[78] = &hf_openhpsdr_e_ddcc_ddc_sync1_78;
-       array2[78] = &hf_openhpsdr_e_ddcc_ddc_sync2_78;
-       array3[78] = &hf_openhpsdr_e_ddcc_ddc_sync3_78;
-       array4[78] = &hf_openhpsdr_e_ddcc_ddc_sync4_78;
-       array5[78] = &hf_openhpsdr_e_ddcc_ddc_sync5_78;
-       array6[78] = &hf_openhpsdr_e_ddcc_ddc_sync6_78;
-       array7[78] = &hf_openhpsdr_e_ddcc_ddc_sync7_78;
-       array0[79] = &hf_openhpsdr_e_ddcc_ddc_sync0_79;
-       array1[79] = &hf_openhpsdr_e_ddcc_ddc_sync1_79;
-       array2[79] = &hf_openhpsdr_e_ddcc_ddc_sync2_79;
-       array3[79] = &hf_openhpsdr_e_ddcc_ddc_sync3_79;
-       array4[79] = &hf_openhpsdr_e_ddcc_ddc_sync4_79;
-       array5[79] = &hf_openhpsdr_e_ddcc_ddc_sync5_79;
-       array6[79] = &hf_openhpsdr_e_ddcc_ddc_sync6_79;
-       array7[79] = &hf_openhpsdr_e_ddcc_ddc_sync7_79;
 
        sync_tree_ddcc_item = proto_tree_add_uint_format(openhpsdr_e_ddcc_tree, hf_openhpsdr_e_ddcc_sync_sub,
            tvb, offset,80, value,"DDC Synchronization");
        openhpsdr_e_ddcc_sync_tree = proto_item_add_subtree(sync_tree_ddcc_item,ett_openhpsdr_e_ddcc_sync);
 
-       for (i=0;i<=79;i++) {
-
-       value = tvb_get_guint8(tvb, offset);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array0[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array1[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array2[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array3[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array4[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array5[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array6[i], tvb,offset, 1, value);
-           proto_tree_add_boolean(openhpsdr_e_ddcc_sync_tree, *array7[i], tvb,offset, 1, value);
+       for (i=0;i<HPSDR_E_NUM_DDC;i++) {
+           proto_tree_add_bitmask_with_flags(openhpsdr_e_ddcc_sync_tree, tvb, offset,
+               hf_openhpsdr_e_ddcc_ddc_sync_flags[i], ett_openhpsdr_e_ddcc_sync_flags,
+               openhpsdr_e_ddcc_sync_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
            offset += 1;
-
        }
 
        // 3.7 Change: Per 3.7 - DDC Multiplex Removed.
@@ -13457,28 +7999,10 @@ static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
 
        openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
 
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_ddcc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is defined by its DESTINATION port.
-   // The port is defined by bytes 5 and 6 of host sent Command Reply (0x00) datagram.
-   // The default port is 1025. A 0 in bytes 5 and 6 means use the default port.
-   if ( pinfo->destport == HPSDR_E_PORT_DDC_COM ) {
-
-       dissect_openhpsdr_e_ddcc(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->destport == openhpsdr_e_cr_ddcc_port ) { // Non-default port
-
-       dissect_openhpsdr_e_ddcc(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_delta_tree(tvb, pinfo, NULL, 0, delta);
+       openhpsdr_e_budget_tree(tvb, pinfo, NULL, 0, budget);
    }
 
 }
@@ -13489,6 +8013,15 @@ dissect_openhpsdr_e_ddcc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tre
 static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_iat_info_t *iat_info = NULL;
+   openhpsdr_e_tx_info_t *tx_info = NULL;
+   openhpsdr_e_cw_info_t *cw_info = NULL;
+   openhpsdr_e_telem_t *telem = NULL;
+   guint8 tx_shown = 0;
+   guint8 ptt_byte = -1;
+   guint8 overload_byte = -1;
    guint8 value = -1;
 
    const char *placehold = NULL ;
@@ -13497,12 +8030,35 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   ptt_byte = tvb_get_guint8(tvb, 4);
+   overload_byte = tvb_get_guint8(tvb, 5);
+   col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, PTT: %s",
+       sequence_num, (ptt_byte & BOOLEAN_B0) ? "Active" : "Inactive");
+   if (overload_byte != 0) {
+       col_append_fstr(pinfo->cinfo, COL_INFO, ", ADC Overload: 0x%02x", overload_byte);
+   }
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, TRUE, HPSDR_E_DG_HPS, 0, sequence_num);
+   iat_info = openhpsdr_e_iat_analysis(pinfo, TRUE, HPSDR_E_DG_HPS, 0);
+   telem = openhpsdr_e_telem_analysis(tvb, pinfo, ( ptt_byte & BOOLEAN_B0 ) != 0);
+   // RF is Alex 0 forward power above the board ADC offset, the raw counts
+   // are never zero at idle
+   if ( ptt_byte & BOOLEAN_B0 ) { tx_shown |= HPSDR_E_TX_PTT; }
+   if ( telem != NULL && telem->forward > 0 ) { tx_shown |= HPSDR_E_TX_RF; }
+   tx_info = openhpsdr_e_tx_analysis(pinfo, HPSDR_E_DG_HPS, tx_shown);
+   cw_info = openhpsdr_e_cw_analysis(pinfo, HPSDR_E_CW_HW, ( ptt_byte & ( BOOLEAN_B1 | BOOLEAN_B2 ) ) != 0);
+   openhpsdr_e_tap_queue(pinfo, TRUE, HPSDR_E_DG_HPS, 0, sequence_num, 0, 0, seq_info, iat_info, NULL, NULL, tx_info,
+       cw_info);
+
    if (tree) {
        proto_item *parent_tree_hps_item = NULL;
 
        proto_tree *openhpsdr_e_hps_tree = NULL;
 
        proto_item *append_text_item = NULL;
+       proto_item *generated_item = NULL;
        //proto_item *ei_item = NULL;
 
        parent_tree_hps_item = proto_tree_add_item(tree, proto_openhpsdr_e, tvb, 0, -1, ENC_NA);
@@ -13512,38 +8068,38 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
            "openHPSDR Ethernet - High Priority Status");
 
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_hps_tree, offset, seq_info);
+       openhpsdr_e_iat_tree(tvb, openhpsdr_e_hps_tree, offset, iat_info);
+       openhpsdr_e_tx_tree(tvb, openhpsdr_e_hps_tree, offset, tx_info);
+       openhpsdr_e_cw_tree(tvb, pinfo, openhpsdr_e_hps_tree, offset, cw_info);
        offset += 4;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_ptt, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_dot, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_dash, tvb,offset, 1, value);
-
-       append_text_item = proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_empty, tvb,offset, 1, value);
-       proto_item_append_text(append_text_item," Not Used");
-
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_pll, tvb,offset, 1, value);
-
-       // Remove at some point ?
-       append_text_item = proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_fifo_empty, tvb,offset, 1, value);
-       proto_item_append_text(append_text_item," - As of 3.7: Not Supported");
-       append_text_item = proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_fifo_full, tvb,offset, 1, value);
-       proto_item_append_text(append_text_item," - As of 3.7: Not Supported");
+       // FIFO Empty and FIFO Full - Remove at some point ?
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hps_tree, tvb, offset,
+           hf_openhpsdr_e_hps_status_flags, ett_openhpsdr_e_hps_flags,
+           openhpsdr_e_hps_status_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc0_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc1_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc2_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc3_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc4_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc5_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc6_ol, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_adc7_ol, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hps_tree, tvb, offset,
+           hf_openhpsdr_e_hps_adc_ol_flags, ett_openhpsdr_e_hps_flags,
+           openhpsdr_e_hps_adc_ol_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
+       if ( telem != NULL ) {
+           generated_item = proto_tree_add_uint(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_cal_board, tvb,offset, 0,
+                                telem->board_id);
+           proto_item_set_generated(generated_item);
+           if ( telem->assumed ) {
+               proto_item_append_text(generated_item," (assumed, board not known)");
+           }
+       }
+
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_ex_power0, tvb,offset, 2, ENC_BIG_ENDIAN);
-// Add Exciter Power Calculation
+       if ( telem != NULL ) {
+           generated_item = proto_tree_add_double(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_ex_watts, tvb,offset, 2,
+                                telem->exciter);
+           proto_item_set_generated(generated_item);
+       }
        offset += 2;
 
        append_text_item = proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_ex_power1, tvb,offset, 2, ENC_BIG_ENDIAN);
@@ -13559,7 +8115,11 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        offset += 2;
 
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_fp_alex0, tvb,offset, 2, ENC_BIG_ENDIAN);
-// Add Forward Power Calculation
+       if ( telem != NULL ) {
+           generated_item = proto_tree_add_double(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_fp_watts, tvb,offset, 2,
+                                telem->forward);
+           proto_item_set_generated(generated_item);
+       }
        offset += 2;
 
        append_text_item = proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_fp_alex1, tvb,offset, 2, ENC_BIG_ENDIAN);
@@ -13575,7 +8135,16 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        offset += 2;
 
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_rp_alex0, tvb,offset, 2, ENC_BIG_ENDIAN);
-// Add Reverse Power Calculation
+       if ( telem != NULL ) {
+           generated_item = proto_tree_add_double(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_rp_watts, tvb,offset, 2,
+                                telem->reverse);
+           proto_item_set_generated(generated_item);
+           if ( telem->forward > 0 ) {
+               generated_item = proto_tree_add_double(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_swr, tvb,offset, 2,
+                                    telem->swr);
+               proto_item_set_generated(generated_item);
+           }
+       }
        offset += 2;
 
        append_text_item = proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_rp_alex1, tvb,offset, 2, ENC_BIG_ENDIAN);
@@ -13595,7 +8164,11 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        offset += 19;
 
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_supp_vol, tvb,offset, 2, ENC_BIG_ENDIAN);
-// Add Supply Volts Calculation
+       if ( telem != NULL ) {
+           generated_item = proto_tree_add_double(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_supply_volts, tvb,offset, 2,
+                                telem->supply);
+           proto_item_set_generated(generated_item);
+       }
        offset += 2;
 
        proto_tree_add_item(openhpsdr_e_hps_tree, hf_openhpsdr_e_hps_user_adc3, tvb,offset, 2, ENC_BIG_ENDIAN);
@@ -13623,29 +8196,9 @@ static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tre
 
        openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
 
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_hps_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-
-   // The protocol is defined by its SOURCE port.
-   // The port is defined by bytes 11 and 12 of host sent Command Reply (0x00) datagram.
-   // The default port is 1025. A 0 in bytes 11 and 12 means use the default port.
-   if ( pinfo->srcport == HPSDR_E_PORT_HP_STAT ) {
-
-       dissect_openhpsdr_e_hps(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->srcport == openhpsdr_e_cr_hps_port ) { // Non-default port
-
-       dissect_openhpsdr_e_hps(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_cw_tree(tvb, pinfo, NULL, 0, cw_info);
    }
 
 }
@@ -13656,6 +8209,10 @@ dissect_openhpsdr_e_hps_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree
 static void dissect_openhpsdr_e_ducc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_ducc_cmd_t *cmd = NULL;
+   openhpsdr_e_budget_t *budget = NULL;
    guint8 value = -1;
 
    const char *placehold = NULL ;
@@ -13664,6 +8221,22 @@ static void dissect_openhpsdr_e_ducc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   cmd = openhpsdr_e_ducc_cmd(tvb, pinfo);
+   openhpsdr_e_config_update(pinfo, HPSDR_E_DG_DUCC, cmd);
+   budget = openhpsdr_e_budget_analysis(pinfo);
+   if ( cmd != NULL ) {
+       col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, DACs: %u, DUC0: %u ksps %u bits",
+           sequence_num, cmd->dac_num, cmd->duc0_rate, cmd->duc0_bits);
+   } else {
+       col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, DACs: %u",
+           sequence_num, tvb_get_guint8(tvb, 4));
+   }
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, FALSE, HPSDR_E_DG_DUCC, 0, sequence_num);
+   openhpsdr_e_tap_queue(pinfo, FALSE, HPSDR_E_DG_DUCC, 0, sequence_num, 0, 0, seq_info, NULL, NULL, NULL, NULL, NULL);
+
    if (tree) {
        proto_item *parent_tree_ducc_item = NULL;
 
@@ -13679,6 +8252,8 @@ static void dissect_openhpsdr_e_ducc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            "openHPSDR Ethernet - DUC Command");
 
        proto_tree_add_item(openhpsdr_e_ducc_tree, hf_openhpsdr_e_ducc_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_ducc_tree, offset, seq_info);
+       openhpsdr_e_budget_tree(tvb, pinfo, openhpsdr_e_ducc_tree, offset, budget);
        offset += 4;
 
        proto_tree_add_item(openhpsdr_e_ducc_tree,hf_openhpsdr_e_ducc_dac_num, tvb,offset, 1, ENC_BIG_ENDIAN);
@@ -13767,28 +8342,9 @@ static void dissect_openhpsdr_e_ducc(tvbuff_t *tvb, packet_info *pinfo, proto_tr
 
        openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
 
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_ducc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is defined by its DESTINATION port.
-   // The port is defined by bytes 7 and 8 of host sent Command Reply (0x00) datagram.
-   // The default port is 1026. A 0 in bytes 7 and 8 means use the default port.
-   if ( pinfo->destport == HPSDR_E_PORT_DUC_COM ) {
-
-       dissect_openhpsdr_e_ducc(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->destport == openhpsdr_e_cr_ducc_port ) { // Non-default port
-
-       dissect_openhpsdr_e_ducc(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_budget_tree(tvb, pinfo, NULL, 0, budget);
    }
 
 }
@@ -13799,8 +8355,12 @@ dissect_openhpsdr_e_ducc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tre
 static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_pacing_info_t *pacing_info = NULL;
 
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
@@ -13808,6 +8368,16 @@ static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tr
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, 64 by 16 bit", sequence_num);
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, TRUE, HPSDR_E_DG_MICL, 0, sequence_num);
+   pacing_info = openhpsdr_e_pacing_analysis(pinfo, TRUE, HPSDR_E_DG_MICL, 0, HPSDR_E_MICL_SAMPLES,
+                     HPSDR_E_AUDIO_RATE, seq_info);
+   openhpsdr_e_tap_queue(pinfo, TRUE, HPSDR_E_DG_MICL, 0, sequence_num, 64, 16, seq_info, NULL, pacing_info, NULL, NULL, NULL);
+   openhpsdr_e_audio_export(tvb, pinfo, HPSDR_E_EXPORT_MICL, 1, seq_info);
+
    if (tree) {
        proto_item *parent_tree_micl_item = NULL;
 
@@ -13823,6 +8393,8 @@ static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            "openHPSDR Ethernet - Mic / Line Samples");
 
        proto_tree_add_item(openhpsdr_e_micl_tree, hf_openhpsdr_e_micl_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_micl_tree, offset, seq_info);
+       openhpsdr_e_pacing_tree(tvb, pinfo, openhpsdr_e_micl_tree, offset, pacing_info);
        offset += 4;
 
        // All the board types in version 3.7 protocol document have 64 by 16 bit
@@ -13834,7 +8406,10 @@ static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tr
        // Version 3.7 protocol document: "Corrected number of audio and mic
        // samples per packet from 720 to 64"
        // for idx 0 to 63
-       for ( idx=0; idx <= 63; idx++) {
+       sample_items = openhpsdr_e_sample_items(64);
+       openhpsdr_e_sample_summary(tvb, openhpsdr_e_micl_tree, offset, 64, 16, 1);
+
+       for ( idx=0; idx < (int)sample_items; idx++) {
            proto_tree_add_string_format(openhpsdr_e_micl_tree, hf_openhpsdr_e_micl_separator, tvb, offset, 0, placehold,
               "----------------------------------------------------------");
 
@@ -13846,33 +8421,14 @@ static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tr
 // Add calculated sample value.
        }
 
-
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_micl_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is defined by its SOURCE port.
-   // The port is defined by bytes 19 and 20 of host sent Command Reply (0x00) datagram.
-   // The default port is 1027. A 0 in bytes 19 and 20 means use the default port.
-   if ( pinfo->srcport == HPSDR_E_PORT_MICL_S ) {
-
-       dissect_openhpsdr_e_micl(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->srcport == openhpsdr_e_cr_micl_port ) { // Non-default port
-
-       dissect_openhpsdr_e_micl(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_pacing_tree(tvb, pinfo, NULL, 0, pacing_info);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,4 + (64 * 2));
+
 }
 
 // Host to Hardware
@@ -13881,9 +8437,16 @@ dissect_openhpsdr_e_micl_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tre
 static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_hpc_cmd_t *cmd = NULL;
+   openhpsdr_e_delta_t *delta = NULL;
+   openhpsdr_e_tx_info_t *tx_info = NULL;
+   openhpsdr_e_cw_info_t *cw_info = NULL;
+   guint8 run_byte = -1;
+   guint8 cwx_byte = -1;
    guint8 value = -1;
 
-   int *array0[80];
    int i = 0 ;
 
    const char *placehold = NULL ;
@@ -13892,14 +8455,29 @@ static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tre
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   cmd = openhpsdr_e_hpc_cmd(tvb, pinfo);
+   openhpsdr_e_config_update(pinfo, HPSDR_E_DG_HPC, cmd);
+   delta = openhpsdr_e_delta_analysis(pinfo, HPSDR_E_DG_HPC, cmd, sizeof(openhpsdr_e_hpc_cmd_t));
+   run_byte = (cmd != NULL) ? cmd->run_ptt : tvb_get_guint8(tvb, 4);
+   col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, Run: %s, PTT: 0x%x",
+       sequence_num, (run_byte & BOOLEAN_B0) ? "Enabled" : "Disabled", (run_byte >> 1) & 0x0F);
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, FALSE, HPSDR_E_DG_HPC, 0, sequence_num);
+   tx_info = openhpsdr_e_tx_analysis(pinfo, HPSDR_E_DG_HPC, ( (run_byte >> 1) & 0x0F ) ? HPSDR_E_TX_KEY : 0);
+   // CWX, dot or dash
+   cwx_byte = (cmd != NULL) ? cmd->cwx : tvb_get_guint8(tvb, 5);
+   cw_info = openhpsdr_e_cw_analysis(pinfo, HPSDR_E_CW_HOST, ( cwx_byte & 0x07 ) != 0);
+   openhpsdr_e_tap_queue(pinfo, FALSE, HPSDR_E_DG_HPC, 0, sequence_num, 0, 0, seq_info, NULL, NULL, NULL, tx_info,
+       cw_info);
+
    if (tree) {
        proto_item *parent_tree_hpc_item = NULL;
-       proto_item *cwx0_tree_hpc_item = NULL;
        proto_item *ddc_fp_tree_hpc_item = NULL;
        proto_item *alex0_tree_hpc_item = NULL;
 
        proto_tree *openhpsdr_e_hpc_tree = NULL;
-       proto_tree *openhpsdr_e_hpc_cwx0_tree = NULL;
        proto_tree *openhpsdr_e_hpc_ddc_fp_tree = NULL;
        proto_tree *openhpsdr_e_hpc_alex0_tree = NULL;
 
@@ -13913,24 +8491,25 @@ static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tre
            "openHPSDR Ethernet - High Priority Command");
 
        proto_tree_add_item(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_hpc_tree, offset, seq_info);
+       openhpsdr_e_delta_tree(tvb, pinfo, openhpsdr_e_hpc_tree, offset, delta);
+       openhpsdr_e_tx_tree(tvb, openhpsdr_e_hpc_tree, offset, tx_info);
+       openhpsdr_e_cw_tree(tvb, pinfo, openhpsdr_e_hpc_tree, offset, cw_info);
        offset += 4;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_run, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_ptt0, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_ptt1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_ptt2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_ptt3, tvb,offset, 1, value);
-       offset += 1;
+       if ( openhpsdr_e_hpc_delta_items(tvb, openhpsdr_e_hpc_tree, delta, cmd) ) {
+           openhpsdr_e_check_frame_length(tvb,pinfo,tree,HPSDR_E_HPC_LEN);
+           return;
+       }
 
-       cwx0_tree_hpc_item = proto_tree_add_uint_format(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_cwx0_sub,
-           tvb, offset,1, value,"CWX0");
-       openhpsdr_e_hpc_cwx0_tree = proto_item_add_subtree(cwx0_tree_hpc_item,ett_openhpsdr_e_hpc_cwx0);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_run_ptt_flags, ett_openhpsdr_e_hpc_flags,
+           openhpsdr_e_hpc_run_ptt_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
+       offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_cwx0_tree, hf_openhpsdr_e_hpc_cwx0_cwx, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_cwx0_tree, hf_openhpsdr_e_hpc_cwx0_dot, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_cwx0_tree, hf_openhpsdr_e_hpc_cwx0_dash, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_cwx0_sub, ett_openhpsdr_e_hpc_cwx0,
+           openhpsdr_e_hpc_cwx0_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
        append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_cwx1, tvb,offset, 1,
@@ -13948,93 +8527,13 @@ static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        proto_item_append_text(append_text_item," Future Use");
        offset += 1;
 
-       array0[0] = &hf_openhpsdr_e_hpc_freq_phase_ddc0;
-       array0[1] = &hf_openhpsdr_e_hpc_freq_phase_ddc1;
-       array0[2] = &hf_openhpsdr_e_hpc_freq_phase_ddc2;
-       array0[3] = &hf_openhpsdr_e_hpc_freq_phase_ddc3;
-       array0[4] = &hf_openhpsdr_e_hpc_freq_phase_ddc4;
-       array0[5] = &hf_openhpsdr_e_hpc_freq_phase_ddc5;
-       array0[6] = &hf_openhpsdr_e_hpc_freq_phase_ddc6;
-       array0[7] = &hf_openhpsdr_e_hpc_freq_phase_ddc7;
-       array0[8] = &hf_openhpsdr_e_hpc_freq_phase_ddc8;
-       array0[9] = &hf_openhpsdr_e_hpc_freq_phase_ddc9;
-       array0[10] = &hf_openhpsdr_e_hpc_freq_phase_ddc10;
-       array0[11] = &hf_openhpsdr_e_hpc_freq_phase_ddc11;
-       array0[12] = &hf_openhpsdr_e_hpc_freq_phase_ddc12;
-       array0[13] = &hf_openhpsdr_e_hpc_freq_phase_ddc13;
-       array0[14] = &hf_openhpsdr_e_hpc_freq_phase_ddc14;
-       array0[15] = &hf_openhpsdr_e_hpc_freq_phase_ddc15;
-       array0[16] = &hf_openhpsdr_e_hpc_freq_phase_ddc16;
-       array0[17] = &hf_openhpsdr_e_hpc_freq_phase_ddc17;
-       array0[18] = &hf_openhpsdr_e_hpc_freq_phase_ddc18;
-       array0[19] = &hf_openhpsdr_e_hpc_freq_phase_ddc19;
-       array0[20] = &hf_openhpsdr_e_hpc_freq_phase_ddc20;
-       array0[21] = &hf_openhpsdr_e_hpc_freq_phase_ddc21;
-       array0[22] = &hf_openhpsdr_e_hpc_freq_phase_ddc22;
-       array0[23] = &hf_openhpsdr_e_hpc_freq_phase_ddc23;
-       array0[24] = &hf_openhpsdr_e_hpc_freq_phase_ddc24;
-       array0[25] = &hf_openhpsdr_e_hpc_freq_phase_ddc25;
-       array0[26] = &hf_openhpsdr_e_hpc_freq_phase_ddc26;
-       array0[27] = &hf_openhpsdr_e_hpc_freq_phase_ddc27;
-       array0[28] = &hf_openhpsdr_e_hpc_freq_phase_ddc28;
-       array0[29] = &hf_openhpsdr_e_hpc_freq_phase_ddc29;
-       array0[30] = &hf_openhpsdr_e_hpc_freq_phase_ddc30;
-       array0[31] = &hf_openhpsdr_e_hpc_freq_phase_ddc31;
-       array0[32] = &hf_openhpsdr_e_hpc_freq_phase_ddc32;
-       array0[33] = &hf_openhpsdr_e_hpc_freq_phase_ddc33;
-       array0[34] = &hf_openhpsdr_e_hpc_freq_phase_ddc34;
-       array0[35] = &hf_openhpsdr_e_hpc_freq_phase_ddc35;
-       array0[36] = &hf_openhpsdr_e_hpc_freq_phase_ddc36;
-       array0[37] = &hf_openhpsdr_e_hpc_freq_phase_ddc37;
-       array0[38] = &hf_openhpsdr_e_hpc_freq_phase_ddc38;
-       array0[39] = &hf_openhpsdr_e_hpc_freq_phase_ddc39;
-       array0[40] = &hf_openhpsdr_e_hpc_freq_phase_ddc40;
-       array0[41] = &hf_openhpsdr_e_hpc_freq_phase_ddc41;
-       array0[42] = &hf_openhpsdr_e_hpc_freq_phase_ddc42;
-       array0[43] = &hf_openhpsdr_e_hpc_freq_phase_ddc43;
-       array0[44] = &hf_openhpsdr_e_hpc_freq_phase_ddc44;
-       array0[45] = &hf_openhpsdr_e_hpc_freq_phase_ddc45;
-       array0[46] = &hf_openhpsdr_e_hpc_freq_phase_ddc46;
-       array0[47] = &hf_openhpsdr_e_hpc_freq_phase_ddc47;
-       array0[48] = &hf_openhpsdr_e_hpc_freq_phase_ddc48;
-       array0[49] = &hf_openhpsdr_e_hpc_freq_phase_ddc49;
-       array0[50] = &hf_openhpsdr_e_hpc_freq_phase_ddc50;
-       array0[51] = &hf_openhpsdr_e_hpc_freq_phase_ddc51;
-       array0[52] = &hf_openhpsdr_e_hpc_freq_phase_ddc52;
-       array0[53] = &hf_openhpsdr_e_hpc_freq_phase_ddc53;
-       array0[54] = &hf_openhpsdr_e_hpc_freq_phase_ddc54;
-       array0[55] = &hf_openhpsdr_e_hpc_freq_phase_ddc55;
-       array0[56] = &hf_openhpsdr_e_hpc_freq_phase_ddc56;
-       array0[57] = &hf_openhpsdr_e_hpc_freq_phase_ddc57;
-       array0[58] = &hf_openhpsdr_e_hpc_freq_phase_ddc58;
-       array0[59] = &hf_openhpsdr_e_hpc_freq_phase_ddc59;
-       array0[60] = &hf_openhpsdr_e_hpc_freq_phase_ddc60;
-       array0[61] = &hf_openhpsdr_e_hpc_freq_phase_ddc61;
-       array0[62] = &hf_openhpsdr_e_hpc_freq_phase_ddc62;
-       array0[63] = &hf_openhpsdr_e_hpc_freq_phase_ddc63;
-       array0[64] = &hf_openhpsdr_e_hpc_freq_phase_ddc64;
-       array0[65] = &hf_openhpsdr_e_hpc_freq_phase_ddc65;
-       array0[66] = &hf_openhpsdr_e_hpc_freq_phase_ddc66;
-       array0[67] = &hf_openhpsdr_e_hpc_freq_phase_ddc67;
-       array0[68] = &hf_openhpsdr_e_hpc_freq_phase_ddc68;
-       array0[69] = &hf_openhpsdr_e_hpc_freq_phase_ddc69;
-       array0[70] = &hf_openhpsdr_e_hpc_freq_phase_ddc70;
-       array0[71] = &hf_openhpsdr_e_hpc_freq_phase_ddc71;
-       array0[72] = &hf_openhpsdr_e_hpc_freq_phase_ddc72;
-       array0[73] = &hf_openhpsdr_e_hpc_freq_phase_ddc73;
-       array0[74] = &hf_openhpsdr_e_hpc_freq_phase_ddc74;
-       array0[75] = &hf_openhpsdr_e_hpc_freq_phase_ddc75;
-       array0[76] = &hf_openhpsdr_e_hpc_freq_phase_ddc76;
-       array0[77] = &hf_openhpsdr_e_hpc_freq_phase_ddc77;
-       array0[78] = &hf_openhpsdr_e_hpc_freq_phase_ddc78;
-       array0[79] = &hf_openhpsdr_e_hpc_freq_phase_ddc79;
 
        ddc_fp_tree_hpc_item = proto_tree_add_uint_format(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_ddc_fp_sub,
            tvb, offset,320, value,"DDC Frequency / Phase Word");
        openhpsdr_e_hpc_ddc_fp_tree = proto_item_add_subtree(ddc_fp_tree_hpc_item,ett_openhpsdr_e_hpc_ddc_fp);
 
        for (i=0;i<=79;i++) {
-           proto_tree_add_item(openhpsdr_e_hpc_ddc_fp_tree,*array0[i], tvb,offset, 4,ENC_BIG_ENDIAN);
+           proto_tree_add_item(openhpsdr_e_hpc_ddc_fp_tree,hf_openhpsdr_e_hpc_freq_phase_ddc[i], tvb,offset, 4,ENC_BIG_ENDIAN);
            offset += 4;
        }
 
@@ -14072,33 +8571,24 @@ static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tre
            "Reserved for Future Use     : Reserved for Future Use");
        offset += 1051;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_orion2_xvtr, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_orion2_IO1, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_orion2_flags, ett_openhpsdr_e_hpc_flags,
+           openhpsdr_e_hpc_orion2_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col4, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col6, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_open_col7, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_open_col_flags, ett_openhpsdr_e_hpc_flags,
+           openhpsdr_e_hpc_open_col_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_db9_out1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_db9_out2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_db9_out3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_db9_out4, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_db9_flags, ett_openhpsdr_e_hpc_flags,
+           openhpsdr_e_hpc_db9_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_merc_att1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_merc_att2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_merc_att3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_tree, hf_openhpsdr_e_hpc_merc_att4, tvb,offset, 1, value);
+       proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_tree, tvb, offset,
+           hf_openhpsdr_e_hpc_merc_att_flags, ett_openhpsdr_e_hpc_flags,
+           openhpsdr_e_hpc_merc_att_bits, ENC_BIG_ENDIAN, BMT_NO_FALSE);
        offset += 1;
 
        append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_alex7, tvb,offset, 4,ENC_BIG_ENDIAN);
@@ -14136,103 +8626,51 @@ static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        proto_tree_add_string_format(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_cr_banner,tvb,offset,0,placehold,
            "!! Bits 8 to 11,13,14 not used on Orion MkII (ANAN-8000DLE) !!");
 
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_17_15, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_12_10, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_6m_bypass, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_red_led1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_tx_rx, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ant3, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ant2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ant1, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_160, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_80, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_60_40, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_lpf_30_20, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_yel_led1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_orion2_txrx, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_red_led0, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_att_10, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_att_20, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hf_bypass, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_bypass, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ext2, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ext1, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_ddc_xvtr_in, tvb,offset, 1, value);
-       offset += 1;
-
-       value = tvb_get_guint8(tvb, offset);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hpf_1_5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hpf_6_5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hpf_9_5, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_6m_amp, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hpf_20, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_hpf_13, tvb,offset, 1, value);
-       proto_tree_add_boolean(openhpsdr_e_hpc_alex0_tree, hf_openhpsdr_e_hpc_alex0_yel_led0, tvb,offset, 1, value);
-       offset += 1;
+       for (i=0;i<4;i++) {
+           proto_tree_add_bitmask_with_flags(openhpsdr_e_hpc_alex0_tree, tvb, offset,
+               hf_openhpsdr_e_hpc_alex0_flags[i], ett_openhpsdr_e_hpc_alex0_flags,
+               openhpsdr_e_hpc_alex0_bits[i], ENC_BIG_ENDIAN, BMT_NO_FALSE);
+           offset += 1;
+       }
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att7, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[7], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att6, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[6], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att5, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[5], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att4, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[4], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att3, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[3], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att2, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[2], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB - Future Use");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att1, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[1], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB");
        offset += 1;
 
-       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att0, tvb,offset, 1,ENC_BIG_ENDIAN);
+       append_text_item = proto_tree_add_item(openhpsdr_e_hpc_tree,hf_openhpsdr_e_hpc_att[0], tvb,offset, 1,ENC_BIG_ENDIAN);
        proto_item_append_text(append_text_item," dB");
        offset += 1;
 
        openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
 
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_hpc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is defined by its DESTINATION port.
-   // The port is defined by bytes 9 and 10 of host sent Command Reply (0x00) datagram.
-   // The default port is 1027. A 0 in bytes 9 and 10 means use the default port.
-   if ( pinfo->destport == HPSDR_E_PORT_HP_COM ) {
-
-       dissect_openhpsdr_e_hpc(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->destport == openhpsdr_e_cr_hpc_port ) { // Non-default port
-
-       dissect_openhpsdr_e_hpc(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_delta_tree(tvb, pinfo, NULL, 0, delta);
+       openhpsdr_e_cw_tree(tvb, pinfo, NULL, 0, cw_info);
    }
 
 }
@@ -14251,9 +8689,15 @@ dissect_openhpsdr_e_hpc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree
 static void dissect_openhpsdr_e_wbd(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_port_map_t *ports = NULL;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_iat_info_t *iat_info = NULL;
+   openhpsdr_e_wb_frame_t *wb_frame = NULL;
 
    long int adc_num = -1;
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
@@ -14261,6 +8705,29 @@ static void dissect_openhpsdr_e_wbd(tvbuff_t *tvb, packet_info *pinfo, proto_tre
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   ports = openhpsdr_e_frame_ports(pinfo);
+   sequence_num = tvb_get_ntohl(tvb, 0);
+
+   // Calulate which ADC the Data is from.
+   if ( pinfo->srcport >= HPSDR_E_BPORT_WB_DAT && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_WB_DAT + 7) ) { // Default port
+
+       adc_num = pinfo->srcport - (guint16)HPSDR_E_BPORT_WB_DAT;
+
+   } else if ( pinfo->srcport >= ports->wbd_base_port &&
+           pinfo->srcport <= (guint16)(ports->wbd_base_port + 7) ) {  // Non-default port
+
+       adc_num = pinfo->srcport - ports->wbd_base_port;
+
+   }
+
+   col_add_fstr(pinfo->cinfo, COL_INFO, "ADC: %ld, Seq: %u, 512 by 16 bit", adc_num, sequence_num);
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, TRUE, HPSDR_E_DG_WBD, (guint16)adc_num, sequence_num);
+   iat_info = openhpsdr_e_iat_analysis(pinfo, TRUE, HPSDR_E_DG_WBD, (guint16)adc_num);
+   openhpsdr_e_tap_queue(pinfo, TRUE, HPSDR_E_DG_WBD, (gint)adc_num, sequence_num, 512, 16, seq_info, iat_info, NULL, NULL, NULL, NULL);
+   wb_frame = openhpsdr_e_wb_analysis(tvb, pinfo, (guint16)adc_num, seq_info);
+
    if (tree) {
        proto_item *parent_tree_wbd_item = NULL;
 
@@ -14276,27 +8743,22 @@ static void dissect_openhpsdr_e_wbd(tvbuff_t *tvb, packet_info *pinfo, proto_tre
            "openHPSDR Ethernet - Wide Band Data");
 
        proto_tree_add_item(openhpsdr_e_wbd_tree, hf_openhpsdr_e_wbd_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_wbd_tree, offset, seq_info);
+       openhpsdr_e_iat_tree(tvb, openhpsdr_e_wbd_tree, offset, iat_info);
        offset += 4;
 
-       // Calulate which ADC the Data is from.
-       if ( pinfo->srcport >= HPSDR_E_BPORT_WB_DAT && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_WB_DAT + 7) ) { // Default port
-
-           adc_num = pinfo->srcport - (guint16)HPSDR_E_BPORT_WB_DAT;
-
-       } else if ( pinfo->srcport >= openhpsdr_e_cr_wbd_base_port &&
-               pinfo->srcport <= (guint16)(openhpsdr_e_cr_wbd_base_port + 7) ) {  // Non-default port
-
-           adc_num = pinfo->srcport - openhpsdr_e_cr_wbd_base_port;
-
-       }
-
        proto_tree_add_uint_format(openhpsdr_e_wbd_tree, hf_openhpsdr_e_wbd_adc, tvb, offset, 0, adc_num,
            "WBD from ADC: %ld - Calculated from source port number",adc_num);
 
        proto_tree_add_string_format(openhpsdr_e_wbd_tree, hf_openhpsdr_e_wbd_banner,tvb,offset,0,placehold,
            "Assuming 512 by 16 bit samples");
 
-       for ( idx=0; idx <= 511; idx++) {
+       openhpsdr_e_wb_tree(tvb, pinfo, openhpsdr_e_wbd_tree, offset, wb_frame);
+
+       sample_items = openhpsdr_e_sample_items(512);
+       openhpsdr_e_sample_summary(tvb, openhpsdr_e_wbd_tree, offset, 512, 16, 1);
+
+       for ( idx=0; idx < (int)sample_items; idx++) {
            proto_tree_add_string_format(openhpsdr_e_wbd_tree, hf_openhpsdr_e_wbd_separator, tvb, offset, 0, placehold,
               "----------------------------------------------------------");
 
@@ -14308,40 +8770,14 @@ static void dissect_openhpsdr_e_wbd(tvbuff_t *tvb, packet_info *pinfo, proto_tre
 
        }
 
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_wbd_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // Page 2 vers 2.6 of protocol specification document:
-   // "For the current hardware implementation an arbitrary limit of 80 DDCs and 8 ADCs has been
-   // applied. These limits will be removed as hardware that is capable of exceeding these settings
-   // becomes available."
-   //
-   // So there are 8 ADCs which means 8 UDP ports for Wide Band Data.
-
-   // The protocol is defined by its SOURCE port.
-   // The port is defined by bytes 21 and 22 of host sent Command Reply (0x00) datagram.
-   // The default port is 1027. A 0 in bytes 21 and 22 means use the default port.
-   if ( pinfo->srcport >= HPSDR_E_BPORT_WB_DAT && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_WB_DAT + 7) ) {
-
-       dissect_openhpsdr_e_wbd(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->srcport >= openhpsdr_e_cr_wbd_base_port &&
-               pinfo->srcport <= (guint16)(openhpsdr_e_cr_wbd_base_port + 7) ) {  // Non-default port
-
-       dissect_openhpsdr_e_wbd(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_wb_tree(tvb, pinfo, NULL, 0, wb_frame);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,4 + (512 * 2));
+
 }
 
 // Host to Hardware
@@ -14350,8 +8786,12 @@ dissect_openhpsdr_e_wbd_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree
 static void dissect_openhpsdr_e_ddca(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_pacing_info_t *pacing_info = NULL;
 
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
@@ -14359,6 +8799,16 @@ static void dissect_openhpsdr_e_ddca(tvbuff_t *tvb, packet_info *pinfo, proto_tr
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u, 64 by 16 bit L/R", sequence_num);
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, FALSE, HPSDR_E_DG_DDCA, 0, sequence_num);
+   pacing_info = openhpsdr_e_pacing_analysis(pinfo, FALSE, HPSDR_E_DG_DDCA, 0, HPSDR_E_DDCA_SAMPLES,
+                     HPSDR_E_AUDIO_RATE, seq_info);
+   openhpsdr_e_tap_queue(pinfo, FALSE, HPSDR_E_DG_DDCA, 0, sequence_num, 64, 16, seq_info, NULL, pacing_info, NULL, NULL, NULL);
+   openhpsdr_e_audio_export(tvb, pinfo, HPSDR_E_EXPORT_DDCA, 2, seq_info);
+
    if (tree) {
        proto_item *parent_tree_ddca_item = NULL;
 
@@ -14374,12 +8824,17 @@ static void dissect_openhpsdr_e_ddca(tvbuff_t *tvb, packet_info *pinfo, proto_tr
            "openHPSDR Ethernet - DDC Audio");
 
        proto_tree_add_item(openhpsdr_e_ddca_tree, hf_openhpsdr_e_ddca_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_ddca_tree, offset, seq_info);
+       openhpsdr_e_pacing_tree(tvb, pinfo, openhpsdr_e_ddca_tree, offset, pacing_info);
        offset += 4;
 
        proto_tree_add_string_format(openhpsdr_e_ddca_tree, hf_openhpsdr_e_ddca_banner,tvb,offset,0,placehold,
            "Assuming default 64 by 16 bits left and right samples");
 
-       for ( idx=0; idx <= 63; idx++) {
+       sample_items = openhpsdr_e_sample_items(64);
+       openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddca_tree, offset, 64, 16, 2);
+
+       for ( idx=0; idx < (int)sample_items; idx++) {
            proto_tree_add_string_format(openhpsdr_e_ddca_tree, hf_openhpsdr_e_ddca_separator, tvb, offset, 0, placehold,
               "----------------------------------------------------------");
 
@@ -14394,32 +8849,14 @@ static void dissect_openhpsdr_e_ddca(tvbuff_t *tvb, packet_info *pinfo, proto_tr
 
        }
 
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_ddca_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // The protocol is defined by its DESTINATION port.
-   // The port is defined by bytes 13 and 14 of host sent Command Reply (0x00) datagram.
-   // The default port is 1028. A 0 in bytes 13 and 14 means use the default port.
-   if ( pinfo->destport == HPSDR_E_PORT_DDC_AUD ) {
-
-       dissect_openhpsdr_e_ddca(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->destport == openhpsdr_e_cr_ddca_port ) { // Non-default port
-
-       dissect_openhpsdr_e_ddca(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_pacing_tree(tvb, pinfo, NULL, 0, pacing_info);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,4 + (64 * 4));
+
 }
 
 // Host to Hardware
@@ -14436,9 +8873,15 @@ dissect_openhpsdr_e_ddca_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tre
 static void dissect_openhpsdr_e_duciq(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_port_map_t *ports = NULL;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_fifo_info_t *fifo_info = NULL;
+   openhpsdr_e_tx_info_t *tx_info = NULL;
 
    long int duc_num = -1;
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
@@ -14446,6 +8889,31 @@ static void dissect_openhpsdr_e_duciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   ports = openhpsdr_e_frame_ports(pinfo);
+   sequence_num = tvb_get_ntohl(tvb, 0);
+
+   // Get the DUC the data is for
+   if ( pinfo->destport >= HPSDR_E_BPORT_DUC_IQ && pinfo->destport <= (guint16)(HPSDR_E_BPORT_DUC_IQ + 7)  ) {
+   // Default Port
+
+       duc_num = pinfo->destport - (guint16)HPSDR_E_BPORT_DUC_IQ;
+
+   } else if ( pinfo->destport >= ports->duciq_base_port &&
+           pinfo->destport <= (guint16)(ports->duciq_base_port + 7) ) { // Non-default port
+
+       duc_num = pinfo->destport - ports->duciq_base_port;
+
+   }
+
+   col_add_fstr(pinfo->cinfo, COL_INFO, "DUC: %ld, Seq: %u, 240 by 24 bit", duc_num, sequence_num);
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, FALSE, HPSDR_E_DG_DUCIQ, (guint16)duc_num, sequence_num);
+   fifo_info = openhpsdr_e_fifo_analysis(pinfo, (gint)duc_num, seq_info);
+   tx_info = openhpsdr_e_tx_analysis(pinfo, HPSDR_E_DG_DUCIQ, HPSDR_E_TX_DUCIQ);
+   openhpsdr_e_tap_queue(pinfo, FALSE, HPSDR_E_DG_DUCIQ, (gint)duc_num, sequence_num, 240, 24, seq_info, NULL, NULL,
+       fifo_info, tx_info, NULL);
+
    if (tree) {
        proto_item *parent_tree_duciq_item = NULL;
 
@@ -14461,28 +8929,22 @@ static void dissect_openhpsdr_e_duciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
            "openHPSDR Ethernet - DUC I&Q Data");
 
        proto_tree_add_item(openhpsdr_e_duciq_tree, hf_openhpsdr_e_duciq_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_duciq_tree, offset, seq_info);
+       openhpsdr_e_fifo_tree(tvb, pinfo, openhpsdr_e_duciq_tree, offset, fifo_info);
+       openhpsdr_e_tx_tree(tvb, openhpsdr_e_duciq_tree, offset, tx_info);
        offset += 4;
 
-       // Get the DUC the data is for
-       if ( pinfo->destport >= HPSDR_E_BPORT_DUC_IQ && pinfo->destport <= (guint16)(HPSDR_E_BPORT_DUC_IQ + 7)  ) {
-       // Default Port
-
-           duc_num = pinfo->destport - (guint16)HPSDR_E_BPORT_DUC_IQ;
-
-       } else if ( pinfo->destport >= openhpsdr_e_cr_duciq_base_port &&
-               pinfo->destport <= (guint16)(openhpsdr_e_cr_duciq_base_port + 7) ) { // Non-default port
-
-           duc_num = pinfo->destport - openhpsdr_e_cr_duciq_base_port;
-
-       }
-
        proto_tree_add_uint_format(openhpsdr_e_duciq_tree, hf_openhpsdr_e_duciq_duc, tvb, offset, 0, duc_num,
            "Data for DUC: %ld - Calculated from destination port number",duc_num);
 
        proto_tree_add_string_format(openhpsdr_e_duciq_tree, hf_openhpsdr_e_duciq_banner,tvb,offset,0,placehold,
            "Assuming default 240 by 24 bit I and Q samples");
 
-       for ( idx=0; idx <= 239; idx++) {
+       sample_items = openhpsdr_e_sample_items(240);
+       openhpsdr_e_sample_summary(tvb, openhpsdr_e_duciq_tree, offset, 240, 24, 2);
+       openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_duciq_tree, offset, 240, 24, FALSE);
+
+       for ( idx=0; idx < (int)sample_items; idx++) {
            proto_tree_add_string_format(openhpsdr_e_duciq_tree, hf_openhpsdr_e_duciq_separator, tvb, offset, 0, placehold,
               "----------------------------------------------------------");
 
@@ -14497,41 +8959,14 @@ static void dissect_openhpsdr_e_duciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
 
        }
 
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_duciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // Page 2 vers 2.6 of protocol specification document:
-   // "For the current hardware implementation an arbitrary limit of 80 DDCs and 8 ADCs has been
-   // applied. These limits will be removed as hardware that is capable of exceeding these settings
-   // becomes available."
-   //
-   // So there are 8 ADCs which means 8 UDP ports for Digital Up Converters (DUC).
-
-
-   // The protocol is defined by its DESTINATION port.
-   // The port is defined by bytes 15 and 16 of host sent Command Reply (0x00) datagram.
-   // The default base port is 1028. A 0 in bytes 15 and 16 means use the default port.
-   if ( pinfo->destport >= HPSDR_E_BPORT_DUC_IQ && pinfo->destport <= (guint16)(HPSDR_E_BPORT_DUC_IQ + 7)  ) {
-
-       dissect_openhpsdr_e_duciq(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->destport >= openhpsdr_e_cr_duciq_base_port &&
-               pinfo->destport <= (guint16)(openhpsdr_e_cr_duciq_base_port + 7) ) { // Non-default port
-
-       dissect_openhpsdr_e_duciq(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_fifo_tree(tvb, pinfo, NULL, 0, fifo_info);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,4 + (240 * 6));
+
 }
 
 // Hardware to Host
@@ -14543,27 +8978,107 @@ dissect_openhpsdr_e_duciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tr
 static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_port_map_t *ports = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   openhpsdr_e_iat_info_t *iat_info = NULL;
+   openhpsdr_e_ts_info_t *ts_info = NULL;
+   openhpsdr_e_rate_info_t *rate_info = NULL;
 
    guint16 sample_bits = -1;
    guint16 samples_num = -1;
 
    long int ddc_num = -1;
    long int total_bytes = -1;
+   long int ip_bytes = -1;
+   guint32 frame_overhead = 0;
+   gint sample_end = -1;
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
+   proto_item *ei_item = NULL;
+
    col_set_str(pinfo->cinfo, COL_PROTOCOL, "openHPSDR DDCIQ");
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   ports = openhpsdr_e_frame_ports(pinfo);
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   sample_bits = tvb_get_guint16(tvb, 12,2);
+   samples_num = tvb_get_guint16(tvb, 14,2);
+
+   // Get the DDC the Data is from
+   if ( pinfo->srcport >= HPSDR_E_BPORT_DDC_IQ && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_DDC_IQ + 79)  ) {
+   // Default Port
+
+       ddc_num = pinfo->srcport - (guint16)HPSDR_E_BPORT_DDC_IQ;
+
+   } else if ( pinfo->srcport >= ports->ddciq_base_port &&
+           pinfo->srcport <= (guint16)(ports->ddciq_base_port + 79) ) { // Non-default port
+
+       ddc_num = pinfo->srcport - ports->ddciq_base_port;
+
+   }
+
+   col_add_fstr(pinfo->cinfo, COL_INFO, "DDC: %ld, Seq: %u, %u by %u bit",
+       ddc_num, sequence_num, samples_num, sample_bits);
+
+   if ( sample_bits == 0x0008 || sample_bits == 0x0010 || sample_bits == 0x0018 || sample_bits == 0x0020 ) {
+       sample_end = 16 + (samples_num * ((sample_bits / 8) * 2));
+   } else {
+       sample_end = 16 + (240 * 6);
+   }
+
+   // Lower layer headers from this frame:
+   //    : 14 bytes Ethernet, plus 4 bytes for each 802.1Q tag
+   //    : 20 bytes IPv4 or 40 bytes IPv6, plus options or extension headers
+   //    :  8 bytes UDP
+   // 16 bytes for DDC I&Q before samples.
+   // The sample bytes are (I bytes + Q bytes) times number of samples.
+   // The IP datagram (IP, UDP, 16 bytes and samples) must be less then or equal
+   // to the MTU preference. 1500 is the standard maximum transmission unit (MTU)
+   // for Ethernet v2 frames, 9000 is common for jumbo frames.
+   frame_overhead = openhpsdr_e_frame_overhead(tvb, pinfo);
+   total_bytes = (long int) ( ( ((sample_bits / 8)*2) * samples_num ) + 16 + frame_overhead);
+   ip_bytes = (long int) ( ( ((sample_bits / 8)*2) * samples_num ) + 16 + openhpsdr_e_ip_overhead(tvb, pinfo));
+
+   if (openhpsdr_e_ddciq_mtu_check) {
+
+       if ( ip_bytes > (long int)openhpsdr_e_mtu) {
+           ei_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_cr_ei, tvb,
+                16, -1, placehold,"Larger then MTU");
+           expert_add_info_format(pinfo,ei_item,&ei_ddciq_larger_then_mtu,
+               "IP datagram will be %ld bytes larger them the MTU (%u bytes).",
+               ip_bytes - (long int)openhpsdr_e_mtu, openhpsdr_e_mtu);
+
+       }
+
+   }
+
+   // Keep the header lengths for the bandwidth budget.
+   if ( !PINFO_FD_VISITED(pinfo) ) {
+       radio = openhpsdr_e_find_radio(pinfo, FALSE);
+       if ( radio != NULL ) { radio->frame_overhead = frame_overhead; }
+   }
+
+   seq_info = openhpsdr_e_seq_analysis(pinfo, TRUE, HPSDR_E_DG_DDCIQ, (guint16)ddc_num, sequence_num);
+   iat_info = openhpsdr_e_iat_analysis(pinfo, TRUE, HPSDR_E_DG_DDCIQ, (guint16)ddc_num);
+   openhpsdr_e_tap_queue(pinfo, TRUE, HPSDR_E_DG_DDCIQ, (gint)ddc_num, sequence_num, samples_num,
+       (guint8)sample_bits, seq_info, iat_info, NULL, NULL, NULL, NULL);
+   ts_info = openhpsdr_e_ts_analysis(pinfo, (gint)ddc_num, tvb_get_ntoh64(tvb, 4), samples_num, seq_info);
+   rate_info = openhpsdr_e_rate_analysis(pinfo, (gint)ddc_num, samples_num, seq_info);
+   openhpsdr_e_ddciq_export(tvb, pinfo, (gint)ddc_num, samples_num, sample_bits, seq_info);
+
    if (tree) {
        proto_item *parent_tree_ddciq_item = NULL;
 
        proto_tree *openhpsdr_e_ddciq_tree = NULL;
 
        //proto_item *append_text_item = NULL;
-       proto_item *ei_item = NULL;
 
        parent_tree_ddciq_item = proto_tree_add_item(tree, proto_openhpsdr_e, tvb, 0, -1, ENC_NA);
        openhpsdr_e_ddciq_tree = proto_item_add_subtree(parent_tree_ddciq_item, ett_openhpsdr_e_ddciq);
@@ -14572,72 +9087,41 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
            "openHPSDR Ethernet - DDC I&Q Data");
 
        proto_tree_add_item(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_ddciq_tree, offset, seq_info);
+       openhpsdr_e_iat_tree(tvb, openhpsdr_e_ddciq_tree, offset, iat_info);
        offset += 4;
 
-       // Get the DDC the Data is from
-       if ( pinfo->srcport >= HPSDR_E_BPORT_DDC_IQ && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_DDC_IQ + 79)  ) {
-       // Default Port
-
-           ddc_num = pinfo->srcport - (guint16)HPSDR_E_BPORT_DDC_IQ;
-
-       } else if ( pinfo->srcport >= openhpsdr_e_cr_ddciq_base_port &&
-               pinfo->srcport <= (guint16)(openhpsdr_e_cr_ddciq_base_port + 79) ) { // Non-default port
-
-           ddc_num = pinfo->srcport - openhpsdr_e_cr_ddciq_base_port;
-
-       }
-
        proto_tree_add_uint_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_ddc, tvb, offset, 0, ddc_num,
            "Data from DDC      : %ld - Calculated from source port number",ddc_num);
 
 
        proto_tree_add_item(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_time_stamp, tvb, offset, 8, ENC_BIG_ENDIAN);
+       openhpsdr_e_ts_tree(tvb, pinfo, openhpsdr_e_ddciq_tree, offset, ts_info);
        offset += 8;
 
-       sample_bits = tvb_get_guint16(tvb, offset,2);
        proto_tree_add_item(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_sample_bits, tvb, offset, 2, ENC_BIG_ENDIAN);
        offset += 2;
 
-       samples_num = tvb_get_guint16(tvb, offset,2);
        proto_tree_add_item(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_samples_per_frame, tvb, offset, 2, ENC_BIG_ENDIAN);
+       openhpsdr_e_rate_tree(tvb, pinfo, openhpsdr_e_ddciq_tree, offset, (gint)ddc_num, rate_info);
        offset += 2;
 
-
-       // 42 bytes for ISO layers 1 to 3: Ethernet, IPv4, UDP
-       //    : 14 ( 0-13) bytes Ethernet
-       //    : 20 (14-33) bytes IPv4
-       //    :  8 (34-41) UDP
-       // 16 (42-57) bytes for DDC I&Q before samples.
-       // 16 + 42 = 58 bytes
-       // The sample bytes are (I bytes + Q bytes) times number of samples.
-       // 58 bytes + samples must be less then or equal to 1500 bytes.
-       // 1500 is the standard maximum transmission unit (MTU) for Ethernet v2 frames.
-       // Internet Protocol (IP) over Ethernet uses Ethernet v2 frames.
-       total_bytes = (long int) ( ( ((sample_bits / 8)*2) * samples_num ) + 58);
-
        proto_tree_add_uint_format(openhpsdr_e_ddciq_tree,
            hf_openhpsdr_e_ddciq_ethernet_frame_size, tvb, offset, 0, total_bytes,
            "Ethernet Frame Size: %ld - Calculated, not in datagram", total_bytes);
 
-
-       if (openhpsdr_e_ddciq_mtu_check) {
-
-           if ( total_bytes > 1500) {
-               ei_item = proto_tree_add_string_format(tree, hf_openhpsdr_e_cr_ei, tvb,
-                    offset, total_bytes, placehold,"Larger then MTU");
-               expert_add_info_format(pinfo,ei_item,&ei_ddciq_larger_then_mtu,
-           "Ethernet frame will be %ld bytes larger them Ethernet MTU.",total_bytes-1500);
-
-           }
-
-       }
-
        proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_banner,tvb,offset,0,placehold,
            "Assuming no synchronous or multiplexed DDC");
 
+       openhpsdr_e_config_tree(tvb, pinfo, openhpsdr_e_ddciq_tree, offset, (gint)ddc_num);
+
        if ( sample_bits == 0x0008) {  // 8 bit samples
 
-           for ( idx=0; idx <= (int)samples_num-1; idx++) {
+           sample_items = openhpsdr_e_sample_items(samples_num);
+           openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 8, 2);
+           openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 8, TRUE);
+
+           for ( idx=0; idx < (int)sample_items; idx++) {
                proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_separator, tvb, offset, 0, placehold,
                   "----------------------------------------------------------");
 
@@ -14653,7 +9137,11 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
 
        } else if ( sample_bits == 0x0010) {  // 16 bit samples
 
-           for ( idx=0; idx <= (int)samples_num-1; idx++) {
+           sample_items = openhpsdr_e_sample_items(samples_num);
+           openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 16, 2);
+           openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 16, TRUE);
+
+           for ( idx=0; idx < (int)sample_items; idx++) {
                proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_separator, tvb, offset, 0, placehold,
                   "----------------------------------------------------------");
 
@@ -14669,7 +9157,11 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
 
        } else if ( sample_bits == 0x0018) {  // 24 bit samples
 
-           for ( idx=0; idx <= (int)samples_num-1; idx++) {
+           sample_items = openhpsdr_e_sample_items(samples_num);
+           openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 24, 2);
+           openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 24, TRUE);
+
+           for ( idx=0; idx < (int)sample_items; idx++) {
                proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_separator, tvb, offset, 0, placehold,
                   "----------------------------------------------------------");
 
@@ -14685,7 +9177,11 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
 
        } else if ( sample_bits == 0x0020) {  // 32 bit samples {
 
-           for ( idx=0; idx <= (int)samples_num-1; idx++) {
+           sample_items = openhpsdr_e_sample_items(samples_num);
+           openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 32, 2);
+           openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_ddciq_tree, offset, samples_num, 32, TRUE);
+
+           for ( idx=0; idx < (int)sample_items; idx++) {
                proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_separator, tvb, offset, 0, placehold,
                   "----------------------------------------------------------");
 
@@ -14704,7 +9200,11 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
            proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_banner,tvb,offset,0,placehold,
                "Unsupported bits per sample - Assuming default 240 by 24 bit samples");
 
-           for ( idx=0; idx <= 239; idx++) {
+           sample_items = openhpsdr_e_sample_items(240);
+           openhpsdr_e_sample_summary(tvb, openhpsdr_e_ddciq_tree, offset, 240, 24, 2);
+           openhpsdr_e_iq_stats_tree(tvb, openhpsdr_e_ddciq_tree, offset, 240, 24, TRUE);
+
+           for ( idx=0; idx < (int)sample_items; idx++) {
                proto_tree_add_string_format(openhpsdr_e_ddciq_tree, hf_openhpsdr_e_ddciq_separator, tvb, offset, 0, placehold,
                   "----------------------------------------------------------");
 
@@ -14720,41 +9220,15 @@ static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_t
 
        }
 
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
-   }
-
-}
-
-static gboolean
-dissect_openhpsdr_e_ddciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
-{
-   // Page 2 vers 2.6 of protocol specification document:
-   // "For the current hardware implementation an arbitrary limit of 80 DDCs and 8 ADCs has been
-   // applied. These limits will be removed as hardware that is capable of exceeding these settings
-   // becomes available."
-   //
-   // So there are 80 Digital Up Converters (DDC) which means 80 UDP ports for DDCs.
-
-
-   // The protocol is defined by its SOURCE port.
-   // The port is defined by bytes 17 and 18 of host sent Command Reply (0x00) datagram.
-   // The default base port is 1035. A 0 in bytes 17 and 18 means use the default port.
-   if ( pinfo->srcport >= HPSDR_E_BPORT_DDC_IQ && pinfo->srcport <= (guint16)(HPSDR_E_BPORT_DDC_IQ + 79)  ) {
-
-       dissect_openhpsdr_e_ddciq(tvb, pinfo, tree);
-       return TRUE;
-
-   } else if ( pinfo->srcport >= openhpsdr_e_cr_ddciq_base_port &&
-               pinfo->srcport <= (guint16)(openhpsdr_e_cr_ddciq_base_port + 79) ) { // Non-default port
-
-       dissect_openhpsdr_e_ddciq(tvb, pinfo, tree);
-       return TRUE;
-
    } else {
-       return FALSE;
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
+       openhpsdr_e_ts_tree(tvb, pinfo, NULL, 0, ts_info);
+       openhpsdr_e_rate_tree(tvb, pinfo, NULL, 0, (gint)ddc_num, rate_info);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,sample_end);
+
 }
 
 // Memory Mapped
@@ -14765,8 +9239,13 @@ dissect_openhpsdr_e_ddciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tr
 static void dissect_openhpsdr_e_mem(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
    gint offset = 0;
+   guint32 sequence_num = -1;
+   openhpsdr_e_port_map_t *ports = NULL;
+   openhpsdr_e_seq_info_t *seq_info = NULL;
+   gboolean from_hw = FALSE;
 
    int idx = 0;
+   guint sample_items = 0;
 
    const char *placehold = NULL ;
 
@@ -14774,6 +9253,15 @@ static void dissect_openhpsdr_e_mem(tvbuff_t *tvb, packet_info *pinfo, proto_tre
    // Clear out the info column
    col_clear(pinfo->cinfo,COL_INFO);
 
+   // Tree-less header decode for the Info column.
+   ports = openhpsdr_e_frame_ports(pinfo);
+   sequence_num = tvb_get_ntohl(tvb, 0);
+   col_add_fstr(pinfo->cinfo, COL_INFO, "Seq: %u", sequence_num);
+
+   from_hw = ( pinfo->destport != ports->mem_host_port );
+   seq_info = openhpsdr_e_seq_analysis(pinfo, from_hw, HPSDR_E_DG_MEM, (guint16)from_hw, sequence_num);
+   openhpsdr_e_tap_queue(pinfo, from_hw, HPSDR_E_DG_MEM, (gint)from_hw, sequence_num, 0, 0, seq_info, NULL, NULL, NULL, NULL, NULL);
+
    if (tree) {
        proto_item *parent_tree_mem_item = NULL;
 
@@ -14788,22 +9276,26 @@ static void dissect_openhpsdr_e_mem(tvbuff_t *tvb, packet_info *pinfo, proto_tre
        proto_tree_add_string_format(openhpsdr_e_mem_tree, hf_openhpsdr_e_mem_banner,tvb,offset,0,placehold,
            "openHPSDR Ethernet - Memory Mapped");
 
-       if ( pinfo->destport == openhpsdr_e_cr_mem_host_port ) {
+       if ( pinfo->destport == ports->mem_host_port ) {
 
            proto_tree_add_string_format(openhpsdr_e_mem_tree, hf_openhpsdr_e_mem_banner,tvb,offset,0,placehold,
                "Memory Data from Host");
 
-       } else if ( pinfo->srcport == openhpsdr_e_cr_mem_hw_port ) {
+       } else if ( pinfo->srcport == ports->mem_hw_port ) {
 
            proto_tree_add_string_format(openhpsdr_e_mem_tree, hf_openhpsdr_e_mem_banner,tvb,offset,0,placehold,
                "Memory Data from Hardware");
        }
 
        proto_tree_add_item(openhpsdr_e_mem_tree, hf_openhpsdr_e_mem_sequence_num, tvb,offset, 4, ENC_BIG_ENDIAN);
+       openhpsdr_e_seq_tree(tvb, pinfo, openhpsdr_e_mem_tree, offset, seq_info);
        offset += 4;
 
 
-       for ( idx=0; idx <= 239; idx++) {
+       sample_items = openhpsdr_e_sample_items(240);
+       openhpsdr_e_sample_summary(tvb, openhpsdr_e_mem_tree, offset, 240, 0, 0);
+
+       for ( idx=0; idx < (int)sample_items; idx++) {
            proto_tree_add_string_format(openhpsdr_e_mem_tree, hf_openhpsdr_e_mem_separator, tvb, offset, 0, placehold,
               "----------------------------------------------------------");
 
@@ -14818,176 +9310,303 @@ static void dissect_openhpsdr_e_mem(tvbuff_t *tvb, packet_info *pinfo, proto_tre
 
        }
 
-       openhpsdr_e_check_frame_length(tvb,pinfo,tree,offset);
-
+   } else {
+       openhpsdr_e_seq_tree(tvb, pinfo, NULL, 0, seq_info);
    }
 
+   // Checked with or without a tree, the datagram size is fixed by the header.
+   openhpsdr_e_check_frame_length(tvb,pinfo,tree,4 + (240 * 6));
+
 }
 
-static gboolean
-dissect_openhpsdr_e_mem_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
+// Set the datagram type for a range of ports in a port lookup table.
+// A port of 0 in the Command Reply (CR) General datagram means use the default
+// port. 65535 (-1) is the value of a port that has not been learned yet.
+static void openhpsdr_e_set_port_range(guint8 *table, guint16 base_port, guint num_ports, guint8 dg_type)
 {
+   guint port = 0;
 
+   if ( base_port == 0 || base_port == 0xFFFF ) { return; }
 
-   // The protocol is defined by its port.
-   // There are two different ports. One for the Host and one for the Hardware.
-   // There is no default port.
-   // The Host port is defined by bytes 29 and 30 of host sent Command Reply (0x00) datagram.
-   // Assuming the Host port is a destination port like the other potocols.
-   // The next available port for destination ports from Host is 1037,Doc vers 2.6.
-   // The Hardware port is defined by bytes 31 and 32 of host sent Command Reply (0x00) datagram.
-   // Assuming the Hardware port is a source port like the other potocols.
-   // The next available port for destination ports from Host is 1115,Doc vers 2.6.
-   //
-   // Ports below 1024 are not allowed. They are not user ports. See ITEF RFC 6335.
-   if ( pinfo->destport == openhpsdr_e_cr_mem_host_port && pinfo->destport >= 1037 ) {
-       // Host Port
-       dissect_openhpsdr_e_mem(tvb, pinfo, tree);
-       return TRUE;
+   for ( port = base_port; port < (guint)base_port + num_ports && port < HPSDR_E_NUM_UDP_PORTS; port++) {
+       table[port] = dg_type;
+   }
 
-   } else if ( pinfo->srcport == openhpsdr_e_cr_mem_hw_port && pinfo->srcport >= 1115 ) {
-       // Hardware Port
-       dissect_openhpsdr_e_mem(tvb, pinfo, tree);
-       return TRUE;
+}
 
-   } else {
-       return FALSE;
+// Build the port lookup tables from the default ports and the
+// non-default ports of a port map, learned from a Command Reply (CR) General
+// datagram.
+//
+// The non-default ports are set first so that the default ports keep
+// precedence, the same as the per datagram heuristic dissectors did.
+//
+// The Memory Mapped (MEM) ports have no default.
+// Ports below 1024 are not allowed. They are not user ports. See ITEF RFC 6335.
+// The next available port for destination ports from Host is 1037,Doc vers 2.6.
+// The next available port for source ports from Hardware is 1115,Doc vers 2.6.
+static void openhpsdr_e_build_port_tables(openhpsdr_e_port_map_t *ports)
+{
+
+   memset(ports->dest_port_type, HPSDR_E_DG_NONE, HPSDR_E_NUM_UDP_PORTS);
+   memset(ports->src_port_type, HPSDR_E_DG_NONE, HPSDR_E_NUM_UDP_PORTS);
+
+   // Non-default ports - Host to Hardware - destination UDP port
+   openhpsdr_e_set_port_range(ports->dest_port_type, ports->ddcc_port, 1, HPSDR_E_DG_DDCC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, ports->ducc_port, 1, HPSDR_E_DG_DUCC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, ports->hpc_port, 1, HPSDR_E_DG_HPC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, ports->ddca_port, 1, HPSDR_E_DG_DDCA);
+   openhpsdr_e_set_port_range(ports->dest_port_type, ports->duciq_base_port,
+       HPSDR_E_NUM_DUCIQ_PORTS, HPSDR_E_DG_DUCIQ);
+   if ( ports->mem_host_port >= HPSDR_E_MIN_MEM_HOST_PORT ) {
+       openhpsdr_e_set_port_range(ports->dest_port_type, ports->mem_host_port, 1, HPSDR_E_DG_MEM);
    }
 
+   // Non-default ports - Hardware to Host - source UDP port
+   openhpsdr_e_set_port_range(ports->src_port_type, ports->hps_port, 1, HPSDR_E_DG_HPS);
+   openhpsdr_e_set_port_range(ports->src_port_type, ports->micl_port, 1, HPSDR_E_DG_MICL);
+   openhpsdr_e_set_port_range(ports->src_port_type, ports->wbd_base_port,
+       HPSDR_E_NUM_WB_PORTS, HPSDR_E_DG_WBD);
+   openhpsdr_e_set_port_range(ports->src_port_type, ports->ddciq_base_port,
+       HPSDR_E_NUM_DDCIQ_PORTS, HPSDR_E_DG_DDCIQ);
+   if ( ports->mem_hw_port >= HPSDR_E_MIN_MEM_HW_PORT ) {
+       openhpsdr_e_set_port_range(ports->src_port_type, ports->mem_hw_port, 1, HPSDR_E_DG_MEM);
+   }
+
+   // Default ports - Host to Hardware - destination UDP port
+   openhpsdr_e_set_port_range(ports->dest_port_type, HPSDR_E_PORT_DDC_COM, 1, HPSDR_E_DG_DDCC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, HPSDR_E_PORT_DUC_COM, 1, HPSDR_E_DG_DUCC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, HPSDR_E_PORT_HP_COM, 1, HPSDR_E_DG_HPC);
+   openhpsdr_e_set_port_range(ports->dest_port_type, HPSDR_E_PORT_DDC_AUD, 1, HPSDR_E_DG_DDCA);
+   openhpsdr_e_set_port_range(ports->dest_port_type, HPSDR_E_BPORT_DUC_IQ,
+       HPSDR_E_NUM_DUCIQ_PORTS, HPSDR_E_DG_DUCIQ);
+
+   // Default ports - Hardware to Host - source UDP port
+   openhpsdr_e_set_port_range(ports->src_port_type, HPSDR_E_PORT_HP_STAT, 1, HPSDR_E_DG_HPS);
+   openhpsdr_e_set_port_range(ports->src_port_type, HPSDR_E_PORT_MICL_S, 1, HPSDR_E_DG_MICL);
+   openhpsdr_e_set_port_range(ports->src_port_type, HPSDR_E_BPORT_WB_DAT,
+       HPSDR_E_NUM_WB_PORTS, HPSDR_E_DG_WBD);
+   openhpsdr_e_set_port_range(ports->src_port_type, HPSDR_E_BPORT_DDC_IQ,
+       HPSDR_E_NUM_DDCIQ_PORTS, HPSDR_E_DG_DDCIQ);
+
 }
 
-void
-proto_reg_handoff_openhpsdr_e(void)
+static guint openhpsdr_e_radio_hash(gconstpointer key)
 {
+   const openhpsdr_e_radio_key_t *radio_key = (const openhpsdr_e_radio_key_t *)key;
 
-   static gboolean cr_initialized = FALSE;
-   static gboolean ddcc_initialized = FALSE;
-   static gboolean hps_initialized = FALSE;
-   static gboolean ducc_initialized = FALSE;
-   static gboolean micl_initialized = FALSE;
-   static gboolean hpc_initialized = FALSE;
-   static gboolean wbd_initialized = FALSE;
-   static gboolean ddca_initialized = FALSE;
-   static gboolean duciq_initialized = FALSE;
-   static gboolean ddciq_initialized = FALSE;
-   static gboolean mem_initialized = FALSE;
+   return add_address_to_hash(add_address_to_hash(0, &radio_key->addr_lo), &radio_key->addr_hi);
+}
 
-   //static dissector_handle_t openhpsdr_e_handle;
+static gboolean openhpsdr_e_radio_equal(gconstpointer key_a, gconstpointer key_b)
+{
+   const openhpsdr_e_radio_key_t *radio_key_a = (const openhpsdr_e_radio_key_t *)key_a;
+   const openhpsdr_e_radio_key_t *radio_key_b = (const openhpsdr_e_radio_key_t *)key_b;
 
-   // Heuristic dissectors
+   return addresses_equal(&radio_key_a->addr_lo, &radio_key_b->addr_lo) &&
+          addresses_equal(&radio_key_a->addr_hi, &radio_key_b->addr_hi);
+}
 
-   // Command Reply (cr)
-   // Can not register as a normal dissector on port 1024.
-   // The HPSDR USB protocol is on port 1024 too.
-   // register as heuristic dissector
-   if (!cr_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_cr_heur,
-                          "OpenHSPDR Ethernet - P2 - Command(Host), Reply(Hardware)",
-                          "openhpsdr-e.cr", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       cr_initialized = TRUE;
-   }
+// Find the host and radio pair of a frame, from either direction.
+// create: add the pair when it is not found, on the first pass. Pairs are
+// added by:
+//    : the Command Reply (CR) General and Discovery Reply datagrams
+//    : openhpsdr_e_config_update() and openhpsdr_e_delta_analysis(), DDC
+//      Command, DUC Command and High Priority Command
+//    : openhpsdr_e_tx_analysis(), a High Priority Command that turns PTT on
+//    : openhpsdr_e_cw_analysis(), a key down
+//    : openhpsdr_e_telem_analysis(), High Priority Status
+//    : openhpsdr_e_ddciq_export() and openhpsdr_e_audio_export(), when the
+//      samples are exported
+// Every other caller only looks the pair up.
+openhpsdr_e_radio_t *openhpsdr_e_find_radio(packet_info *pinfo, gboolean create)
+{
+   openhpsdr_e_radio_key_t radio_key;
+   openhpsdr_e_radio_key_t *new_key = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
 
-   // There are two protocols on port 1025.
-   // One from the Host and a different format coming
-   // from Hardware.
-   // Also the protocol specification allow for any port.
-   if (!ddcc_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_ddcc_heur,
-                          "OpenHSPDR Ethernet - P2 - DDC Command (From Host)",
-                          "openhpsdr-e.ddc", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       ddcc_initialized = TRUE;
-   }
+   if ( openhpsdr_e_radios == NULL ) { return NULL; }
 
-   if (!hps_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_hps_heur,
-                          "OpenHSPDR Ethernet - P2 - High Priority Status (From Hardware)",
-                          "openhpsdr-e.hps", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       hps_initialized = TRUE;
+   // Shallow copy for the lookup, the addresses are copied when the pair is new.
+   if ( cmp_address(&pinfo->src, &pinfo->dst) <= 0 ) {
+       radio_key.addr_lo = pinfo->src;
+       radio_key.addr_hi = pinfo->dst;
+   } else {
+       radio_key.addr_lo = pinfo->dst;
+       radio_key.addr_hi = pinfo->src;
    }
 
-   // There are two protocols on port 1026.
-   // One from the Host and a different format coming
-   // from Hardware.
-   // Also the protocol specification allow for any port.
-   if (!ducc_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_ducc_heur,
-                          "OpenHSPDR Ethernet - P2 - DUC Command (From Host)",
-                          "openhpsdr-e.ducc", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       ducc_initialized = TRUE;
-   }
+   radio = (openhpsdr_e_radio_t *)wmem_map_lookup(openhpsdr_e_radios, &radio_key);
 
-   if (!micl_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_micl_heur,
-                          "OpenHSPDR Ethernet - P2 - Mic / Line Samples (From Hardware)",
-                          "openhpsdr-e.micl", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       micl_initialized = TRUE;
-   }
+   if ( radio == NULL && create ) {
+       new_key = wmem_new0(wmem_file_scope(), openhpsdr_e_radio_key_t);
+       copy_address_wmem(wmem_file_scope(), &new_key->addr_lo, &radio_key.addr_lo);
+       copy_address_wmem(wmem_file_scope(), &new_key->addr_hi, &radio_key.addr_hi);
 
-   // Port 1027
-   // One from the Host and a different format coming
-   // from Hardware.
-   // Also the protocol specification allow for any port.
-   if (!hpc_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_hpc_heur,
-                          "OpenHSPDR Ethernet - P2 - High Priority Command (From Host)",
-                          "openhpsdr-e.hpc", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       hpc_initialized = TRUE;
+       radio = wmem_new0(wmem_file_scope(), openhpsdr_e_radio_t);
+       radio->ports = &openhpsdr_e_default_ports;
+       radio->board_id = -1;
+       wmem_map_insert(openhpsdr_e_radios, new_key, radio);
    }
 
-   // Base Port of 1027
-   // Sourced from hardware.
-   // Ports 1027 to 1034 at time of protocol doc vers 2.6.
-   // The potocol specification allow for any port.
+   return radio;
+}
+
+// Keep the radio (hardware) address of a pair, the first one seen.
+void openhpsdr_e_radio_hw_addr(openhpsdr_e_radio_t *radio, const address *hw_addr)
+{
+   if ( radio == NULL || radio->hw_addr.type != AT_NONE ) { return; }
 
-   if (!wbd_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_wbd_heur,
-                          "OpenHSPDR Ethernet - P2 - Wide Band Data (From Hardware)",
-                          "openhpsdr-e.wbd", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       wbd_initialized = TRUE;
-   }
+   copy_address_wmem(wmem_file_scope(), &radio->hw_addr, hw_addr);
+}
+
+// The port map of a frame, as it was on the first pass.
+openhpsdr_e_port_map_t *openhpsdr_e_frame_ports(packet_info *pinfo)
+{
+   openhpsdr_e_frame_t *frame = NULL;
+
+   frame = (openhpsdr_e_frame_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+               HPSDR_E_PDATA_FRAME);
+
+   if ( frame == NULL ) { return &openhpsdr_e_default_ports; }
+
+   return frame->ports;
+}
+
+// The single heuristic dissector for all eleven datagram types.
+//
+// Command Reply (CR) is hard defined to use UDP destination or source port of 1024.
+// Since the older HPSDR USB over IP uses the same UDP port.
+// Test the first two bytes for the USB over IP id.
+// - Used packet-smb.c for an example.
+//
+// The other datagrams are found with one probe of the default port lookup
+// tables. Traffic originated by the host uses the port number as the UDP
+// destination port. Traffic originated by the hardware uses the port as the
+// source UDP port. The host and hardware ports overlap (1025 is DDCC to the
+// hardware and HPS from it), so a source port in the hardware table is taken
+// as from the hardware; the hardware always sends from its service ports, the
+// host seldom does.
+// Only when the default tables miss and a radio has non-default ports is the
+// radio looked up. Its own tables are then used, with the direction from the
+// radio address learned from a CR datagram when there is one.
+static gboolean
+dissect_openhpsdr_e_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, void *data _U_)
+{
+   guint8 dg_type = HPSDR_E_DG_NONE;
+
+   openhpsdr_e_frame_t *frame = NULL;
+   openhpsdr_e_radio_t *radio = NULL;
+   openhpsdr_e_port_map_t *ports = NULL;
+
+   frame = (openhpsdr_e_frame_t *)p_get_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e,
+               HPSDR_E_PDATA_FRAME);
+
+   if ( frame != NULL ) {
+       dg_type = frame->dg_type;
+
+   } else if ( PINFO_FD_VISITED(pinfo) ) {
+       // Not openHPSDR on the first pass. Later CR General datagrams
+       // do not change the decision.
+       return FALSE;
 
+   } else if ( (pinfo->srcport == HPSDR_E_PORT_COM_REP) || (pinfo->destport == HPSDR_E_PORT_COM_REP) ) {
+
+       if ( tvb_get_guint16(tvb, 0,2) == 0xEFFE ) {
+           return FALSE;
+       }
+       dg_type = HPSDR_E_DG_CR;
+
+   } else {
+
+       dg_type = openhpsdr_e_default_ports.src_port_type[pinfo->srcport];
+       if ( dg_type == HPSDR_E_DG_NONE ) {
+           dg_type = openhpsdr_e_default_ports.dest_port_type[pinfo->destport];
+       }
+
+       if ( dg_type == HPSDR_E_DG_NONE && openhpsdr_e_port_maps > 0 ) {
+           radio = openhpsdr_e_find_radio(pinfo, FALSE);
+           if ( radio != NULL && radio->ports != &openhpsdr_e_default_ports ) {
+               ports = radio->ports;
+               if ( radio->hw_addr.type == AT_NONE ) {
+                   dg_type = ports->src_port_type[pinfo->srcport];
+                   if ( dg_type == HPSDR_E_DG_NONE ) {
+                       dg_type = ports->dest_port_type[pinfo->destport];
+                   }
+               } else if ( addresses_equal(&pinfo->src, &radio->hw_addr) ) {
+                   dg_type = ports->src_port_type[pinfo->srcport];
+               } else {
+                   dg_type = ports->dest_port_type[pinfo->destport];
+               }
+           }
+       }
 
-   // Port 1028
-   // The potocol specification allow for any port.
-   if (!ddca_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_ddca_heur,
-                          "OpenHSPDR Ethernet - P2 - DDC Audio (From Host)",
-                          "openhpsdr-e.ddca", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       ddca_initialized = TRUE;
    }
 
-   // Base Port 1029
-   // Ports 1029 to 1036 at time of protocol doc vers 2.6.
-   // The potocol specification allow for any port.
-   if (!duciq_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_duciq_heur,
-                          "OpenHSPDR Ethernet - P2 - DUC I&Q Data (From Host)",
-                          "openhpsdr-e.duciq", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       duciq_initialized = TRUE;
+   if ( frame == NULL && dg_type != HPSDR_E_DG_NONE ) {
+       frame = wmem_new0(wmem_file_scope(), openhpsdr_e_frame_t);
+       frame->dg_type = dg_type;
+       frame->radio = radio;
+       frame->ports = ( ports != NULL ) ? ports : &openhpsdr_e_default_ports;
+       p_add_proto_data(wmem_file_scope(), pinfo, proto_openhpsdr_e, HPSDR_E_PDATA_FRAME, frame);
    }
 
-   // Base Port 1035
-   // Ports 1035 to 1114 at time of protocol doc vers 2.6.
-   // The potocol specification allow for any port.
-   if (!ddciq_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_ddciq_heur,
-                          "OpenHSPDR Ethernet - P2 - DDC I&Q Data (From Hardware)",
-                          "openhpsdr-e.ddciq", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       ddciq_initialized = TRUE;
+   switch (dg_type) {
+       case HPSDR_E_DG_CR:    dissect_openhpsdr_e_cr(tvb, pinfo, tree);    break;
+       case HPSDR_E_DG_DDCC:  dissect_openhpsdr_e_ddcc(tvb, pinfo, tree);  break;
+       case HPSDR_E_DG_HPS:   dissect_openhpsdr_e_hps(tvb, pinfo, tree);   break;
+       case HPSDR_E_DG_DUCC:  dissect_openhpsdr_e_ducc(tvb, pinfo, tree);  break;
+       case HPSDR_E_DG_MICL:  dissect_openhpsdr_e_micl(tvb, pinfo, tree);  break;
+       case HPSDR_E_DG_HPC:   dissect_openhpsdr_e_hpc(tvb, pinfo, tree);   break;
+       case HPSDR_E_DG_WBD:   dissect_openhpsdr_e_wbd(tvb, pinfo, tree);   break;
+       case HPSDR_E_DG_DDCA:  dissect_openhpsdr_e_ddca(tvb, pinfo, tree);  break;
+       case HPSDR_E_DG_DUCIQ: dissect_openhpsdr_e_duciq(tvb, pinfo, tree); break;
+       case HPSDR_E_DG_DDCIQ: dissect_openhpsdr_e_ddciq(tvb, pinfo, tree); break;
+       case HPSDR_E_DG_MEM:   dissect_openhpsdr_e_mem(tvb, pinfo, tree);   break;
+       default:
+           return FALSE;
    }
 
+   return TRUE;
 
-   // Memory Mapped - No default port
-   // The Host and Hardware may using different ports.
-   // Assuming the Host port is a destination port like the other potocols.
-   // Assuming the Hardware port is a source port like the other potocols.
-   // The protocol specification allow for any port.
-   if (!mem_initialized ) {
-       heur_dissector_add("udp", dissect_openhpsdr_e_mem_heur,
-                          "OpenHSPDR Ethernet - P2 - Memory Mapped",
-                          "openhpsdr-e.mem", proto_openhpsdr_e, HEURISTIC_ENABLE);
-       mem_initialized = TRUE;
-   }
+}
+
+void
+proto_reg_handoff_openhpsdr_e(void)
+{
+
+   static gboolean initialized = FALSE;
 
+   // Heuristic dissector
+   //
+   // Can not register as a normal dissector on port 1024.
+   // The HPSDR USB protocol is on port 1024 too.
+   // There are two protocols on ports 1025 to 1027.
+   // One from the Host and a different format coming from Hardware.
+   // Also the protocol specification allow for any port.
+   //
+   // One heuristic dissector is registered for all the datagrams.
+   // Every UDP datagram that is not openHPSDR costs one table probe
+   // instead of a pass through eleven heuristic dissectors.
+   if (!initialized ) {
+       openhpsdr_e_build_port_tables(&openhpsdr_e_default_ports);
+       heur_dissector_add("udp", dissect_openhpsdr_e_heur,
+                          "OpenHPSDR Ethernet - P2 - All Datagrams",
+                          "openhpsdr-e", proto_openhpsdr_e, HEURISTIC_ENABLE);
+
+       // The plugin is a dissector plugin, the stats tree is registered here
+       // instead of from a tap plugin registration routine.
+       stats_tree_register_plugin("hpsdr-e", "hpsdr-e,streams", "openHPSDR Ethernet/Streams", 0,
+           openhpsdr_e_stats_tree_packet, openhpsdr_e_stats_tree_init, openhpsdr_e_stats_tree_cleanup);
+       stats_tree_register_plugin("hpsdr-e", "hpsdr-e,iat", "openHPSDR Ethernet/Inter-arrival Time", 0,
+           openhpsdr_e_stats_tree_iat_packet, openhpsdr_e_stats_tree_iat_init, openhpsdr_e_stats_tree_cleanup);
+       stats_tree_register_plugin("hpsdr-e", "hpsdr-e,pacing", "openHPSDR Ethernet/Pacing", 0,
+           openhpsdr_e_stats_tree_pacing_packet, openhpsdr_e_stats_tree_pacing_init, openhpsdr_e_stats_tree_cleanup);
+       stats_tree_register_plugin("hpsdr-e", "hpsdr-e,tx", "openHPSDR Ethernet/Transmit Latency", 0,
+           openhpsdr_e_stats_tree_tx_packet, openhpsdr_e_stats_tree_tx_init, NULL);
+       stats_tree_register_plugin("hpsdr-e", "hpsdr-e,cw", "openHPSDR Ethernet/CW Keying", 0,
+           openhpsdr_e_stats_tree_cw_packet, openhpsdr_e_stats_tree_cw_init, NULL);
+       initialized = TRUE;
+   }
 
 }
@@ -40,6 +40,536 @@
 #define HPSDR_E_BPORT_DUC_IQ 1029 // DUC IQ DATA BASE PORT   -DEST   PORT (SOURCE HOST)
 #define HPSDR_E_BPORT_DDC_IQ 1035 // DDC IQ DATA BASE PORT   -SOURCE PORT (SOURCE HARDWARE)
 
+// NUMBER OF PORTS IN A SERVICE PORT RANGE
+#define HPSDR_E_NUM_WB_PORTS    8 // WIDEBAND DATA  - ONE PORT PER ADC
+#define HPSDR_E_NUM_DUCIQ_PORTS 8 // DUC IQ DATA    - ONE PORT PER DUC
+#define HPSDR_E_NUM_DDCIQ_PORTS 80 // DDC IQ DATA   - ONE PORT PER DDC
+
+// SIZE OF THE INDEXED FIELD FAMILIES (REGISTERED AT RUN TIME)
+#define HPSDR_E_NUM_DDC       80 // DDC STATE, CONFIGURATION AND FREQUENCY / PHASE
+#define HPSDR_E_NUM_ADC        8 // ADC DITHER, RANDOM, OVERLOAD AND STEP ATTEN.
+#define HPSDR_E_NUM_SYNC_BITS  8 // DDC SYNCHRONIZATION BITS PER DDC
+
+// LOWEST PORTS ALLOWED FOR THE MEMORY MAPPED (MEM) DATAGRAM
+#define HPSDR_E_MIN_MEM_HOST_PORT 1037 // NEXT FREE HOST DESTINATION PORT
+#define HPSDR_E_MIN_MEM_HW_PORT   1115 // NEXT FREE HARDWARE SOURCE PORT
+
+// DATAGRAM TYPES - VALUES STORED IN THE PORT LOOKUP TABLES
+#define HPSDR_E_DG_NONE  0  // NOT AN OPENHPSDR ETHERNET PORT
+#define HPSDR_E_DG_CR    1  // COMMAND REPLY
+#define HPSDR_E_DG_DDCC  2  // DDC COMMAND
+#define HPSDR_E_DG_HPS   3  // HIGH PRIORITY STATUS
+#define HPSDR_E_DG_DUCC  4  // DUC COMMAND
+#define HPSDR_E_DG_MICL  5  // MIC / LINE SAMPLES
+#define HPSDR_E_DG_HPC   6  // HIGH PRIORITY COMMAND
+#define HPSDR_E_DG_WBD   7  // WIDE BAND DATA
+#define HPSDR_E_DG_DDCA  8  // DDC AUDIO
+#define HPSDR_E_DG_DUCIQ 9  // DUC IQ DATA
+#define HPSDR_E_DG_DDCIQ 10 // DDC IQ DATA
+#define HPSDR_E_DG_MEM   11 // MEMORY MAPPED
+#define HPSDR_E_DG_COUNT 12
+
+#define HPSDR_E_NUM_UDP_PORTS 65536
+
+// SAMPLE CLOCK, HZ. A PHASE WORD IS THE FREQUENCY IN 1 / 2^32 OF THE CLOCK.
+#define HPSDR_E_CLOCK_HZ 122880000
+
+// SAMPLE BLOCK DISPLAY MODES (PREFERENCE)
+#define HPSDR_E_SAMPLES_FULL    0 // EVERY SAMPLE AS TREE ITEMS
+#define HPSDR_E_SAMPLES_COMPACT 1 // ONE SUMMARY ITEM, LIMITED SAMPLE ITEMS
+
+// PER FRAME DATA KEYS (p_add_proto_data)
+#define HPSDR_E_PDATA_SEQ   0 // SEQUENCE ANALYSIS RESULT
+#define HPSDR_E_PDATA_FRAME 1 // DATAGRAM TYPE, PORT MAP AND RADIO
+#define HPSDR_E_PDATA_CMD   2 // DECODED COMMAND (DDCC, DUCC, HPC)
+#define HPSDR_E_PDATA_DELTA 3 // COMPARED WITH THE PREVIOUS COMMAND
+#define HPSDR_E_PDATA_TS    4 // DDC I&Q TIMESTAMP ANALYSIS RESULT
+#define HPSDR_E_PDATA_RATE  5 // DDC I&Q DATA RATE ANALYSIS RESULT
+#define HPSDR_E_PDATA_BUDGET 6 // BANDWIDTH BUDGET OF THE CONFIGURATION
+#define HPSDR_E_PDATA_IAT   7 // INTER-ARRIVAL TIME OF A STREAM DATAGRAM
+#define HPSDR_E_PDATA_WB    8 // WIDE BAND SPECTRUM FRAME COMPLETED BY THE DATAGRAM
+#define HPSDR_E_PDATA_PACING 9 // AUDIO PACING ANALYSIS RESULT
+#define HPSDR_E_PDATA_FIFO  10 // DUC I&Q FIFO MODEL RESULT
+#define HPSDR_E_PDATA_TX    11 // TRANSMIT LATENCY MILESTONE
+#define HPSDR_E_PDATA_CW    12 // CW KEYING EDGE
+#define HPSDR_E_PDATA_TELEM 13 // HIGH PRIORITY STATUS TELEMETRY
+
+// SHORTEST CAPTURE TIME (SECONDS) FOR THE DDC SAMPLE CLOCK ESTIMATE
+#define HPSDR_E_TS_MIN_BASELINE 1.0
+
+// CAPTURE TIME (SECONDS) OF ONE DDC I&Q DATA RATE MEASUREMENT
+#define HPSDR_E_RATE_WINDOW 1.0
+
+// INTER-ARRIVAL TIME
+// Datagrams of a stream closer than HPSDR_E_BURST_GAP_US are one burst.
+#define HPSDR_E_BURST_GAP_US    20
+// Log scale histogram: values below 8 uS have a bin each, every octave above
+// has 8 linear bins. Largest value 2^31 uS.
+#define HPSDR_E_IAT_SUB_BITS    3
+#define HPSDR_E_IAT_BINS        ((32 - HPSDR_E_IAT_SUB_BITS) * 8 + 8)
+
+// DUC I&Q FIFO MODEL
+#define HPSDR_E_DUC_RATE        192 // ksps, before a DUC Command is seen
+#define HPSDR_E_FIFO_IDLE       1.0 // Seconds without DUC I&Q that end a transmission
+
+// TRANSMIT LATENCY MILESTONES, BITS
+#define HPSDR_E_TX_KEY          0x01 // High Priority Command PTT on
+#define HPSDR_E_TX_PTT          0x02 // High Priority Status PTT on
+#define HPSDR_E_TX_DUCIQ        0x04 // First DUC I&Q datagram
+#define HPSDR_E_TX_RF           0x08 // First forward power
+
+// CW KEYING ELEMENTS, ENDED BY A KEY EDGE
+#define HPSDR_E_CW_NONE         0 // First edge of the source, length unknown
+#define HPSDR_E_CW_DOT          1
+#define HPSDR_E_CW_DASH         2
+#define HPSDR_E_CW_MARK         3 // Key down, no DUC Command keyer speed
+#define HPSDR_E_CW_SPACE        4 // Space between the elements of a character
+#define HPSDR_E_CW_GAP          5 // Space between characters or words
+// CW KEY SOURCES
+#define HPSDR_E_CW_HOST         0 // High Priority Command CWX byte
+#define HPSDR_E_CW_HW           1 // High Priority Status dot and dash bits
+// ELEMENT ERROR ALLOWED, AND EDGE RESOLUTION FLAGGED, FRACTION OF A DOT
+#define HPSDR_E_CW_TOLERANCE    0.25
+// SECONDS AFTER WHICH A HOST KEY DOWN IS NOT MATCHED TO THE HARDWARE
+#define HPSDR_E_CW_IDLE         1.0
+
+// I&Q STATISTICS FIELDS, INDEX OF THE DDC I&Q AND DUC I&Q FIELD ARRAYS
+#define HPSDR_E_IQSTATS_ITEM     0
+#define HPSDR_E_IQSTATS_MEAN_I   1
+#define HPSDR_E_IQSTATS_MEAN_Q   2
+#define HPSDR_E_IQSTATS_RMS      3
+#define HPSDR_E_IQSTATS_PEAK     4
+#define HPSDR_E_IQSTATS_CLIPPED  5
+#define HPSDR_E_IQSTATS_NUM      6
+// dBFS of a block of zero samples
+#define HPSDR_E_DBFS_FLOOR       (-200.0)
+
+// BANDWIDTH BUDGET
+// Bytes added to every datagram on the wire. HPSDR_E_FRAME_OVERHEAD is used
+// until a DDC I&Q datagram of the radio shows the real header lengths.
+#define HPSDR_E_FRAME_OVERHEAD  42 // Ethernet 14, IPv4 20, UDP 8
+#define HPSDR_E_UDP_HDR_LEN     8
+#define HPSDR_E_IPV4_HDR_LEN    20
+#define HPSDR_E_IPV4_HDR_MAX    60 // Header length 15 words, with options
+#define HPSDR_E_IPV6_HDR_LEN    40
+#define HPSDR_E_IPV6_HDR_MAX    296 // Eight extension headers of 32 bytes
+#define HPSDR_E_WIRE_OVERHEAD   24 // Preamble 8, FCS 4, interframe gap 12
+// Sample bytes of a DDC I&Q or DUC I&Q datagram when the samples per
+// datagram have not been seen: 238 24 bit I&Q samples.
+#define HPSDR_E_IQ_PAYLOAD      1428
+#define HPSDR_E_DDCIQ_HDR_LEN   16
+#define HPSDR_E_DUCIQ_HDR_LEN   4
+#define HPSDR_E_DUCIQ_SAMPLES   240
+// Mic / Line and DDC Audio, 48 ksps, fixed datagram sizes
+#define HPSDR_E_AUDIO_RATE      48000
+#define HPSDR_E_MICL_SAMPLES    64
+#define HPSDR_E_MICL_LEN        132
+#define HPSDR_E_DDCA_SAMPLES    64
+#define HPSDR_E_DDCA_LEN        260
+// Wide band defaults, used when the General datagram field is 0
+#define HPSDR_E_WB_SAMPLES      512
+#define HPSDR_E_WB_BITS         16
+#define HPSDR_E_WB_RATE         70  // mS
+#define HPSDR_E_WB_DATAGRAMS    32
+
+// COMMAND DATAGRAM LENGTHS
+#define HPSDR_E_DDCC_LEN 1444
+#define HPSDR_E_DUCC_LEN 60
+#define HPSDR_E_HPC_LEN  1444
+
+// HIGH PRIORITY STATUS LENGTH THROUGH THE SUPPLY VOLTAGE
+#define HPSDR_E_HPS_TELEM_LEN 51
+
+// PORT MAP
+// The service ports learned from a Command Reply (CR) General datagram.
+// 65535 (-1) is a port that has not been learned. A new port map is made when
+// the ports change, a port map is not changed after frames point to it.
+typedef struct _openhpsdr_e_port_map {
+    guint16  ddcc_port;
+    guint16  hps_port;
+    guint16  ducc_port;
+    guint16  micl_port;
+    guint16  hpc_port;
+    guint16  wbd_base_port;
+    guint16  ddca_port;
+    guint16  duciq_base_port;
+    guint16  ddciq_base_port;
+    guint16  mem_host_port;
+    guint16  mem_hw_port;
+    // Port lookup tables, indexed by UDP port. The value is HPSDR_E_DG_*.
+    guint8  *dest_port_type;  // Host originated, destination port
+    guint8  *src_port_type;   // Hardware originated, source port
+} openhpsdr_e_port_map_t;
+
+// RADIO
+// One host and radio (hardware) address pair. The two addresses are kept in
+// cmp_address() order, the same pair is found from either direction.
+typedef struct _openhpsdr_e_radio_key {
+    address  addr_lo;
+    address  addr_hi;
+} openhpsdr_e_radio_key_t;
+
+typedef struct _openhpsdr_e_radio {
+    openhpsdr_e_port_map_t *ports;  // Current port map
+    address  hw_addr;               // Radio address of the pair, AT_NONE until a CR shows it
+    guint8   board_id;              // From the discovery reply, -1 unknown
+    wmem_tree_t *configs;           // Configuration timeline, openhpsdr_e_config_t by frame
+    // Previous decoded command of each datagram type, for the delta view
+    void    *last_cmd[HPSDR_E_DG_COUNT];
+    guint32  last_cmd_frame[HPSDR_E_DG_COUNT];
+    guint32  same_since[HPSDR_E_DG_COUNT];  // First frame with the same settings
+    // Wide band settings from the last Command Reply (CR) General datagram
+    guint8   wb_enable;             // One bit per ADC
+    guint16  wb_samples;            // Samples per datagram
+    guint8   wb_bits;               // Sample size
+    guint8   wb_rate;               // Update rate, mS
+    guint8   wb_datagrams;          // Datagrams per full spectrum
+    // Lower layer header bytes of the last DDC I&Q datagram, 0 not seen
+    guint32  frame_overhead;
+    // DDC and DUC frequencies are phase words, from the General datagram
+    gboolean phase_word;
+    // Transmit latency, the open transmit event
+    guint32  tx_events;             // Transmit events so far
+    gboolean tx_keyed;              // PTT on in the last High Priority Command
+    nstime_t tx_key_time;           // Capture time of the command that keyed
+    guint32  tx_key_frame;
+    guint8   tx_seen;               // HPSDR_E_TX_* milestones of the event
+    // CW keying, by HPSDR_E_CW_HOST and HPSDR_E_CW_HW
+    gboolean cw_valid[2];           // A datagram of the source seen
+    gboolean cw_down[2];            // Key state in the last datagram
+    gboolean cw_have_edge[2];
+    nstime_t cw_edge_time[2];       // Capture time of the last key edge
+    gdouble  cw_edge_res[2];        // Resolution of the last key edge, mS
+    nstime_t cw_last_time[2];       // Capture time of the last datagram
+    gboolean cw_pending;            // Host key down not yet seen by the hardware
+    nstime_t cw_key_time;
+    guint32  cw_key_frame;
+    // Telemetry time series export, openhpsdr_e_telem_series_t
+    void    *telem;
+    // DDC I&Q and audio export files, openhpsdr_e_export_t
+    void    *export_files;
+} openhpsdr_e_radio_t;
+
+// Decided on the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_frame {
+    guint8   dg_type;               // HPSDR_E_DG_*
+    openhpsdr_e_port_map_t *ports;  // Port map when the frame was first seen
+    openhpsdr_e_radio_t *radio;     // NULL before a CR datagram of the pair
+} openhpsdr_e_frame_t;
+
+// SEQUENCE ANALYSIS
+// A stream is one datagram type, from or to one radio, for one DDC / ADC / DUC.
+typedef struct _openhpsdr_e_stream_key {
+    address  hw_addr;  // Hardware (radio) address
+    guint8   dg_type;  // HPSDR_E_DG_*
+    guint16  index;    // DDC, ADC or DUC number. Direction for Memory Mapped.
+} openhpsdr_e_stream_key_t;
+
+typedef struct _openhpsdr_e_stream {
+    guint32  last_seq;      // Highest sequence number seen
+    guint32  packets;
+    guint32  lost;
+    guint32  duplicates;
+    guint32  out_of_order;
+    // DDC I&Q timestamps
+    gboolean ts_valid;      // last_ts and base_ts are set
+    guint64  last_ts;       // Timestamp of the last in order datagram
+    guint16  last_samples;  // Samples in that datagram
+    guint64  base_ts;       // Start of the sample clock estimate
+    nstime_t base_time;     // Capture time of base_ts
+    // DDC I&Q data rate
+    gboolean rate_valid;    // A measurement window is open
+    guint32  rate_config;   // DDC enable, rate and sample bits of the window
+    nstime_t rate_start;    // Capture time of the first datagram of the window
+    guint32  rate_count;    // Datagrams after the first one in the window
+    // Inter-arrival time
+    gboolean iat_valid;     // last_arrival is set
+    nstime_t last_arrival;  // Capture time of the previous datagram
+    guint32  burst;         // Datagrams in the current burst
+    // Wide band spectrum analysis, openhpsdr_e_wb_adc_t
+    void    *wb;
+    // Pacing, play out schedule of the jitter buffer
+    gboolean pace_valid;    // pace_base and depth_base are set
+    nstime_t pace_base;     // Capture time sample 0 is due
+    guint64  pace_samples;  // Samples due since pace_base
+    nstime_t depth_base;    // As pace_base, not moved by an under-run or over-run
+    guint64  depth_samples;
+    gdouble  late_min;      // Seconds against depth_base
+    gdouble  late_max;
+    guint32  underruns;
+    guint32  overruns;
+    // DUC I&Q FIFO model
+    gboolean fifo_valid;    // fifo_time is set
+    nstime_t fifo_time;     // Capture time of the previous datagram
+    gdouble  fifo_fill;     // Samples after the previous datagram
+    gboolean fifo_draining; // Reached the start level, the DUC is taking samples
+    guint32  fifo_underruns;
+    guint32  fifo_overflows;
+} openhpsdr_e_stream_t;
+
+// Result of the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_seq_info {
+    gboolean first;         // First datagram of the stream
+    gboolean duplicate;
+    gboolean out_of_order;
+    gboolean restart;       // Sequence number went back to zero
+    guint32  expected;
+    gint32   delta;         // Sequence number minus the previous highest
+    guint32  lost;          // Lost before this datagram
+    guint32  lost_total;    // Lost in the stream up to this datagram
+} openhpsdr_e_seq_info_t;
+
+// DDC I&Q TIMESTAMP ANALYSIS
+// The timestamp counts DDC samples. A datagram is expected to start where the
+// previous one ended. Result of the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_ts_info {
+    gboolean first;         // First timestamp of the stream, or after a reset
+    gboolean reset;         // Timestamp went back, the estimate starts again
+    gboolean lost;          // The gap is the samples of the lost datagrams
+    guint64  expected;      // Previous timestamp plus its sample count
+    gint64   delta;         // Timestamp minus expected, > 0 gap, < 0 overlap
+    guint64  back;          // Previous timestamp minus timestamp, on a reset
+    gboolean have_rate;     // Estimate baseline is HPSDR_E_TS_MIN_BASELINE or more
+    gdouble  rate;          // Sample clock in samples per second of capture time
+    gboolean have_drift;    // DDC sample rate known from a DDC Command
+    gdouble  drift_ppm;     // Estimated rate against the DDC sample rate
+} openhpsdr_e_ts_info_t;
+
+// DDC I&Q DATA RATE ANALYSIS
+// Datagrams per second over a HPSDR_E_RATE_WINDOW of capture time, against the
+// rate expected from the DDC Command in effect. Stored with p_add_proto_data
+// on the datagram closing the window.
+typedef struct _openhpsdr_e_rate_info {
+    gboolean have_expected; // DDC enabled with a sample rate in a DDC Command
+    gdouble  expected;      // Datagrams per second from the DDC sample rate
+    gdouble  observed;      // Datagrams per second in the window
+    gdouble  window;        // Seconds from the first to the last datagram
+    guint32  datagrams;     // Datagrams after the first one in the window
+    gdouble  deviation;     // Percent, observed against expected
+    gboolean out_of_range;  // Deviation larger than the tolerance preference
+} openhpsdr_e_rate_info_t;
+
+// INTER-ARRIVAL TIME RESULT
+// Result of the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_iat_info {
+    nstime_t delta;         // Since the previous datagram of the stream
+    guint32  burst;         // Position in the current burst, 1 is not in a burst
+} openhpsdr_e_iat_info_t;
+
+// PACING ANALYSIS
+// A datagram is due when the samples before it have been played at the
+// nominal sample rate. A jitter buffer of the pacing buffer preference plays
+// the samples; a datagram later than the buffer is an under-run, one earlier
+// than the buffer can hold (twice the buffer) an over-run. Both start the
+// schedule again. Result of the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_pacing_info {
+    gdouble  lateness;      // mS after the datagram was due, < 0 before
+    gdouble  depth;         // mS of jitter buffer needed for the stream so far
+    gboolean underrun;
+    gboolean overrun;
+    guint32  underruns;     // In the stream up to this datagram
+    guint32  overruns;
+} openhpsdr_e_pacing_info_t;
+
+// DUC I&Q FIFO MODEL
+// The hardware FIFO of a DUC is filled with the samples of each DUC I&Q
+// datagram and, once half full, emptied at the DUC sample rate of the DUC
+// Command in effect. The FIFO size is the DUC FIFO preference. An empty FIFO
+// is a likely under-run, the DUC then waits for half full again. Samples over
+// the FIFO size are an overflow. Lost datagrams were most likely lost by the
+// capture, their samples are counted as received. Result of the first pass,
+// stored with p_add_proto_data.
+typedef struct _openhpsdr_e_fifo_info {
+    gboolean have_rate;     // DUC sample rate from a DUC Command
+    guint32  rate;          // sps
+    gdouble  interval;      // mS since the previous datagram
+    gdouble  expected;      // mS of the samples of one datagram at the DUC rate
+    gdouble  fill;          // Samples in the FIFO after the datagram
+    gdouble  fill_ms;       // mS of samples in the FIFO
+    gboolean behind;        // Below a quarter before the datagram, the host fell behind
+    gboolean ahead;         // Above three quarters after the datagram, the host burst ahead
+    gboolean underrun;      // FIFO emptied before the datagram
+    gdouble  starved;       // mS the FIFO was empty
+    gboolean overflow;      // Samples of the datagram did not fit
+    guint32  underruns;     // In the stream up to this datagram
+    guint32  overflows;
+} openhpsdr_e_fifo_info_t;
+
+// TRANSMIT LATENCY
+// A transmit event starts with the High Priority Command that turns a PTT bit
+// on and ends with the one that turns them all off. The first High Priority
+// Status with PTT on, the first DUC I&Q datagram and the first High Priority
+// Status with forward power above the board ADC offset are timed from the
+// command. Stored with p_add_proto_data on the command and on each datagram
+// that reached a milestone, on the first pass.
+typedef struct _openhpsdr_e_tx_info {
+    guint32  event;         // Transmit event of the radio, from 1
+    guint32  key_frame;     // Frame of the High Priority Command that keyed
+    guint8   milestones;    // HPSDR_E_TX_* reached by this datagram
+    nstime_t latency;       // Since the command
+} openhpsdr_e_tx_info_t;
+
+// CW KEYING
+// The host key is the CWX byte of the High Priority Command (CWX, dot or dash
+// bit set), the hardware key the dot and dash bits of the High Priority
+// Status. Each change of a key ends a mark or a space; its length is compared
+// with the DUC Command keyer speed and weight in effect. The High Priority
+// Status is periodic, a hardware edge happened somewhere since the previous
+// one and that time is the resolution of the edge. A High Priority Command is
+// only sent on a change, a host edge has no resolution (0). A hardware key
+// down is timed from the host key down before it. Stored with p_add_proto_data
+// on the datagrams with a key edge, on the first pass.
+typedef struct _openhpsdr_e_cw_info {
+    guint8   source;        // HPSDR_E_CW_HOST, HPSDR_E_CW_HW
+    gboolean key_down;      // Key state after the edge
+    guint8   element;       // HPSDR_E_CW_* ended by the edge
+    gdouble  length;        // mS
+    gdouble  resolution;    // mS, since the previous HPS, 0 for the host key
+    gboolean have_keyer;    // DUC Command keyer speed known
+    guint8   wpm;
+    guint8   weight;
+    gdouble  expected;      // mS, 0 for a gap or no keyer
+    gdouble  error;         // mS, length less expected
+    gboolean off_timing;    // Error above the tolerance and the resolution
+    gboolean jitter;        // Resolution above the tolerance
+    gboolean have_latency;
+    guint32  key_frame;     // High Priority Command of the host key down
+    nstime_t latency;       // Host key down to hardware key down
+} openhpsdr_e_cw_info_t;
+
+// TAP RECORD
+// Queued to the "hpsdr-e" tap for every datagram of a stream, on every pass.
+typedef struct _openhpsdr_e_tap_info {
+    address  hw_addr;       // Radio (hardware) address
+    guint8   dg_type;       // HPSDR_E_DG_*
+    gint     index;         // DDC, ADC or DUC number, 0 single stream, -1 unknown
+    guint32  sequence_num;
+    guint32  samples;       // Samples in the datagram, 0 for commands and status
+    guint8   sample_bits;   // 0 for commands and status
+    guint32  frame_len;     // Bytes of the frame
+    guint32  lost;          // Lost before this datagram
+    gboolean duplicate;
+    gboolean out_of_order;
+    gboolean have_iat;      // DDC I&Q, wide band and high priority status
+    guint32  iat_us;        // Inter-arrival time, uS
+    guint32  burst;
+    gboolean have_pacing;   // Mic / Line and DDC Audio
+    gint32   lateness_us;
+    guint32  depth_us;
+    gboolean underrun;
+    gboolean overrun;       // Audio over-run, DUC FIFO overflow
+    gboolean have_fifo;     // DUC I&Q
+    guint32  fifo_fill;     // Samples
+    gboolean behind;
+    gboolean ahead;
+    guint8   tx_milestones; // HPSDR_E_TX_*, 0 none
+    guint32  tx_latency_us;
+    gboolean have_cw;       // CW key edge
+    guint8   cw_source;     // HPSDR_E_CW_HOST, HPSDR_E_CW_HW
+    guint8   cw_element;    // HPSDR_E_CW_*
+    guint32  cw_length_us;
+    guint32  cw_resolution_us; // Hardware key only
+    gboolean cw_off_timing;
+    gboolean cw_jitter;
+    gboolean have_cw_latency;
+    guint32  cw_latency_us;
+} openhpsdr_e_tap_info_t;
+
+// STATS TREE STREAM
+// Kept by the stats tree for each stream node, constant size.
+typedef struct _openhpsdr_e_st_stream {
+    guint32  carry_bits;    // Bits not yet counted in the kbit node
+    gboolean have_range;    // Histogram range node created
+    guint32  iat_count;
+    guint32  hist[HPSDR_E_IAT_BINS];
+    guint32  max_burst;
+    gint32   max_late;      // Pacing, uS
+    gboolean have_fill;
+    guint32  min_fill;      // DUC FIFO, samples
+} openhpsdr_e_st_stream_t;
+
+// BANDWIDTH BUDGET
+// Wire bandwidth (Mbit/s) of the streams implied by the configuration in
+// effect, for each direction of the full duplex link.
+// Stored with p_add_proto_data on the DDCC and DUCC datagrams.
+typedef struct _openhpsdr_e_budget {
+    gdouble  ddciq;         // Hardware to Host, enabled DDCs
+    gdouble  wbd;           // Hardware to Host, enabled wide band ADCs
+    gdouble  micl;          // Hardware to Host, Mic / Line samples
+    gdouble  hw_to_host;
+    gdouble  duciq;         // Host to Hardware, DUC I&Q (DUCC seen)
+    gdouble  ddca;          // Host to Hardware, DDC Audio
+    gdouble  host_to_hw;
+    guint32  link;          // Link speed preference, Mbit/s
+    gdouble  load;          // Percent of the link, busiest direction
+} openhpsdr_e_budget_t;
+
+// DECODED COMMANDS
+// The settings of a DDCC, DUCC or HPC datagram, decoded once and stored with
+// p_add_proto_data. Later passes and the cross packet analyses use these
+// instead of reading the bytes again.
+typedef struct _openhpsdr_e_ddcc_cmd {
+    guint8   adc_num;
+    guint8   dither;                         // ADC bits
+    guint8   random;                         // ADC bits
+    guint8   ddc_on;                         // Number of enabled DDCs
+    guint8   enable[HPSDR_E_NUM_DDC / 8];    // DDC n is bit (n % 8) of byte (n / 8)
+    guint8   adc[HPSDR_E_NUM_DDC];           // ADC assignment
+    guint16  rate[HPSDR_E_NUM_DDC];          // Sample rate, ksps
+    guint8   sample_bits[HPSDR_E_NUM_DDC];   // I&Q sample size
+    guint8   sync[HPSDR_E_NUM_DDC];          // Synchronization bits
+} openhpsdr_e_ddcc_cmd_t;
+
+typedef struct _openhpsdr_e_ducc_cmd {
+    guint8   dac_num;
+    guint8   cw_flags;
+    guint8   sidetone_level;
+    guint16  sidetone_freq;                  // Hz
+    guint8   keyer_speed;                    // WPM
+    guint8   keyer_weight;
+    guint16  hang_delay;                     // mS
+    guint8   rf_delay;                       // mS
+    guint16  duc0_rate;                      // ksps
+    guint8   duc0_bits;
+    guint8   mic_flags;
+    guint8   line_in_gain;
+} openhpsdr_e_ducc_cmd_t;
+
+typedef struct _openhpsdr_e_hpc_cmd {
+    guint8   run_ptt;
+    guint8   cwx;
+    guint32  ddc_freq[HPSDR_E_NUM_DDC];      // Frequency / phase word
+    guint32  duc_freq[4];
+    guint8   drive[4];
+    guint8   orion2;
+    guint8   open_col;
+    guint8   db9;
+    guint8   merc_att;
+    guint32  alex[8];                        // Alex 0 to 7
+    guint8   att[HPSDR_E_NUM_ADC];           // Step attenuator, ADC 0 to 7
+} openhpsdr_e_hpc_cmd_t;
+
+// CONFIGURATION TIMELINE
+// The command settings of a radio from one frame on. An entry is added on the
+// first pass when a DDCC, DUCC or HPC datagram changes the settings. The
+// entries point to the decoded commands kept with the frames.
+typedef struct _openhpsdr_e_config {
+    guint32  frame;                          // Frame of the change
+    openhpsdr_e_ddcc_cmd_t *ddcc;            // NULL before the first DDCC
+    openhpsdr_e_ducc_cmd_t *ducc;            // NULL before the first DUCC
+    openhpsdr_e_hpc_cmd_t  *hpc;             // NULL before the first HPC
+} openhpsdr_e_config_t;
+
+// DELTA VIEW
+// A DDCC or HPC datagram compared with the previous one of the same radio.
+// Result of the first pass, stored with p_add_proto_data.
+typedef struct _openhpsdr_e_delta {
+    gboolean changed;                        // Differs from the previous command
+    guint32  prev_frame;                     // 0 for the first command
+    guint32  same_since;                     // First frame with these settings
+    void    *prev_cmd;                       // NULL for the first command
+} openhpsdr_e_delta_t;
+
 //GENERIC BITMAKS
 #define ZERO_MASK      0x00
 #define BOOLEAN_MASK   0x08   // ???? CORRECT ????
@@ -67,33 +597,125 @@
 
 gint cr_packet_end_pad(tvbuff_t *tvb, proto_tree *tree, gint offset, gint size);
 guint8 gc_discovery_reply(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset);
+void cr_general_ports(tvbuff_t *tvb, packet_info *pinfo, gint offset);
+static void openhpsdr_e_set_hf(hf_register_info *hf_entry, int *p_id, char *name, char *abbrev,
+   enum ftenum type, int display, const void *strings, guint64 bitmask);
+static void openhpsdr_e_register_indexed_fields(void);
 void openhpsdr_e_check_frame_length(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset);
+guint openhpsdr_e_sample_items(guint num_samples);
+void openhpsdr_e_sample_summary(tvbuff_t *tvb, proto_tree *tree, gint offset, guint num_samples,
+    guint sample_bits, guint channels);
+void openhpsdr_e_iq_stats_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, guint samples_num,
+    guint sample_bits, gboolean from_hw);
+openhpsdr_e_seq_info_t *openhpsdr_e_seq_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, guint32 sequence_num);
+void openhpsdr_e_seq_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_seq_info_t *seq_info);
+openhpsdr_e_ddcc_cmd_t *openhpsdr_e_ddcc_cmd(tvbuff_t *tvb, packet_info *pinfo);
+openhpsdr_e_ducc_cmd_t *openhpsdr_e_ducc_cmd(tvbuff_t *tvb, packet_info *pinfo);
+openhpsdr_e_hpc_cmd_t *openhpsdr_e_hpc_cmd(tvbuff_t *tvb, packet_info *pinfo);
+void openhpsdr_e_config_update(packet_info *pinfo, guint8 dg_type, void *cmd);
+openhpsdr_e_config_t *openhpsdr_e_config_at(packet_info *pinfo);
+void openhpsdr_e_config_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset, gint ddc_num);
+openhpsdr_e_delta_t *openhpsdr_e_delta_analysis(packet_info *pinfo, guint8 dg_type, void *cmd, gsize cmd_size);
+void openhpsdr_e_delta_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_delta_t *delta);
+gboolean openhpsdr_e_ddcc_delta_items(tvbuff_t *tvb, proto_tree *tree, openhpsdr_e_delta_t *delta,
+    openhpsdr_e_ddcc_cmd_t *cmd);
+gboolean openhpsdr_e_hpc_delta_items(tvbuff_t *tvb, proto_tree *tree, openhpsdr_e_delta_t *delta,
+    openhpsdr_e_hpc_cmd_t *cmd);
+openhpsdr_e_ts_info_t *openhpsdr_e_ts_analysis(packet_info *pinfo, gint ddc_num, guint64 time_stamp,
+    guint16 samples_num, openhpsdr_e_seq_info_t *seq_info);
+void openhpsdr_e_ts_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_ts_info_t *ts_info);
+static gdouble openhpsdr_e_wire_mbps(gdouble datagrams_per_sec, guint32 datagram_len, guint32 overhead);
+guint32 openhpsdr_e_frame_overhead(tvbuff_t *tvb, packet_info *pinfo);
+guint32 openhpsdr_e_ip_overhead(tvbuff_t *tvb, packet_info *pinfo);
+openhpsdr_e_budget_t *openhpsdr_e_budget_analysis(packet_info *pinfo);
+void openhpsdr_e_budget_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_budget_t *budget);
+openhpsdr_e_rate_info_t *openhpsdr_e_rate_analysis(packet_info *pinfo, gint ddc_num, guint16 samples_num,
+    openhpsdr_e_seq_info_t *seq_info);
+void openhpsdr_e_rate_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    gint ddc_num, openhpsdr_e_rate_info_t *rate_info);
+void openhpsdr_e_ddciq_export(tvbuff_t *tvb, packet_info *pinfo, gint ddc_num, guint16 samples_num,
+    guint16 sample_bits, openhpsdr_e_seq_info_t *seq_info);
+openhpsdr_e_iat_info_t *openhpsdr_e_iat_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index);
+void openhpsdr_e_iat_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, openhpsdr_e_iat_info_t *iat_info);
+guint openhpsdr_e_wb_fft_len(openhpsdr_e_radio_t *radio);
+openhpsdr_e_wb_frame_t *openhpsdr_e_wb_analysis(tvbuff_t *tvb, packet_info *pinfo, guint16 adc_num,
+    openhpsdr_e_seq_info_t *seq_info);
+void openhpsdr_e_wb_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_wb_frame_t *frame);
+void openhpsdr_e_audio_export(tvbuff_t *tvb, packet_info *pinfo, guint stream, guint channels,
+    openhpsdr_e_seq_info_t *seq_info);
+openhpsdr_e_pacing_info_t *openhpsdr_e_pacing_analysis(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, guint32 samples_num, guint32 sample_rate, openhpsdr_e_seq_info_t *seq_info);
+void openhpsdr_e_pacing_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_pacing_info_t *pacing_info);
+openhpsdr_e_fifo_info_t *openhpsdr_e_fifo_analysis(packet_info *pinfo, gint duc_num,
+    openhpsdr_e_seq_info_t *seq_info);
+void openhpsdr_e_fifo_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_fifo_info_t *fifo_info);
+openhpsdr_e_tx_info_t *openhpsdr_e_tx_analysis(packet_info *pinfo, guint8 dg_type, guint8 shown);
+void openhpsdr_e_tx_tree(tvbuff_t *tvb, proto_tree *tree, gint offset, openhpsdr_e_tx_info_t *tx_info);
+openhpsdr_e_cw_info_t *openhpsdr_e_cw_analysis(packet_info *pinfo, guint8 source, gboolean key_down);
+openhpsdr_e_telem_t *openhpsdr_e_telem_analysis(tvbuff_t *tvb, packet_info *pinfo, gboolean ptt);
+void openhpsdr_e_cw_tree(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, gint offset,
+    openhpsdr_e_cw_info_t *cw_info);
+void openhpsdr_e_tap_queue(packet_info *pinfo, gboolean from_hw, guint8 dg_type, gint index,
+    guint32 sequence_num, guint32 samples, guint8 sample_bits, openhpsdr_e_seq_info_t *seq_info,
+    openhpsdr_e_iat_info_t *iat_info, openhpsdr_e_pacing_info_t *pacing_info,
+    openhpsdr_e_fifo_info_t *fifo_info, openhpsdr_e_tx_info_t *tx_info, openhpsdr_e_cw_info_t *cw_info);
+static guint openhpsdr_e_iat_bin(guint32 value);
+static guint32 openhpsdr_e_iat_bin_value(guint bin);
+static void openhpsdr_e_st_data_init(stats_tree *st);
+static openhpsdr_e_st_stream_t *openhpsdr_e_st_stream(stats_tree *st, int node);
+static gchar *openhpsdr_e_st_stream_name(packet_info *pinfo, const openhpsdr_e_tap_info_t *tap_info);
+static void openhpsdr_e_stats_tree_iat_init(stats_tree *st);
+static tap_packet_status openhpsdr_e_stats_tree_iat_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt,
+    const void *p);
+static void openhpsdr_e_stats_tree_pacing_init(stats_tree *st);
+static tap_packet_status openhpsdr_e_stats_tree_pacing_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt,
+    const void *p);
+static void openhpsdr_e_stats_tree_tx_init(stats_tree *st);
+static tap_packet_status openhpsdr_e_stats_tree_cw_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt,
+    const void *p);
+static void openhpsdr_e_stats_tree_cw_init(stats_tree *st);
+static tap_packet_status openhpsdr_e_stats_tree_tx_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt,
+    const void *p);
+static void openhpsdr_e_stats_tree_init(stats_tree *st);
+static tap_packet_status openhpsdr_e_stats_tree_packet(stats_tree *st, packet_info *pinfo, epan_dissect_t *edt,
+    const void *p);
+static void openhpsdr_e_stats_tree_cleanup(stats_tree *st);
+static openhpsdr_e_stream_t *openhpsdr_e_lookup_stream(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index);
+static openhpsdr_e_stream_t *openhpsdr_e_find_stream(packet_info *pinfo, gboolean from_hw, guint8 dg_type,
+    guint16 index, gboolean *created);
+static guint openhpsdr_e_stream_hash(gconstpointer key);
+static gboolean openhpsdr_e_stream_equal(gconstpointer key_a, gconstpointer key_b);
+static void openhpsdr_e_init(void);
+static void openhpsdr_e_cleanup(void);
 void proto_register_hpsdr_u(void);
 static void dissect_openhpsdr_e_cr(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_cr_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_ddcc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_ddcc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_hps(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_hps_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_ducc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_ducc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_wbd(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_wbd_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_hpc(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_hpc_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_duciq(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_duciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_ddciq(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_ddciq_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
-    void *data);
 static void dissect_openhpsdr_e_mem(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
-static gboolean dissect_openhpsdr_e_mem_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
+static void dissect_openhpsdr_e_micl(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
+static void dissect_openhpsdr_e_ddca(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree);
+static void openhpsdr_e_set_port_range(guint8 *table, guint16 base_port, guint num_ports, guint8 dg_type);
+static void openhpsdr_e_build_port_tables(openhpsdr_e_port_map_t *ports);
+static guint openhpsdr_e_radio_hash(gconstpointer key);
+static gboolean openhpsdr_e_radio_equal(gconstpointer key_a, gconstpointer key_b);
+openhpsdr_e_radio_t *openhpsdr_e_find_radio(packet_info *pinfo, gboolean create);
+void openhpsdr_e_radio_hw_addr(openhpsdr_e_radio_t *radio, const address *hw_addr);
+openhpsdr_e_port_map_t *openhpsdr_e_frame_ports(packet_info *pinfo);
+static gboolean dissect_openhpsdr_e_heur(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree,
     void *data);
 void proto_reg_handoff_openhpsdr_e(void);